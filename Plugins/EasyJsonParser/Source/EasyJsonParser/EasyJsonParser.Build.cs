@@ -17,7 +17,8 @@ public class EasyJsonParser : ModuleRules
 			"Engine",
 			"Slate",
 			"SlateCore",
-			"Json"
+			"Json",
+			"EasyJsonParserV2"
 		});
 	}
 }
@@ -23,26 +23,34 @@ UEasyJsonAsyncLoadFromFile* UEasyJsonAsyncLoadFromFile::AsyncLoadFromFile(UObjec
 
 void UEasyJsonAsyncLoadFromFile::Activate()
 {
-	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this]()
+	// The task may outlive the action, so it only holds a weak reference and copies of the inputs
+	TWeakObjectPtr<UEasyJsonAsyncLoadFromFile> WeakThis(this);
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, JsonFile = _JsonFile, IsAblolute = _IsAblolute]()
 		{
 			auto manager = NewObject<UEasyJsonParseManager>();
 			EEasyJsonParserErrorCode _isSuccessed;
-			auto rootElement = manager->LoadFromFile(_JsonFile, _IsAblolute, _isSuccessed);
+			auto rootElement = manager->LoadFromFile(JsonFile, IsAblolute, _isSuccessed);
 
 			if (_isSuccessed == EEasyJsonParserErrorCode::Successed)
 			{
-				AsyncTask(ENamedThreads::GameThread, [this, rootElement]()
+				AsyncTask(ENamedThreads::GameThread, [WeakThis, rootElement]()
 					{
-						Successed.Broadcast(rootElement);
-						SetReadyToDestroy();
+						if (UEasyJsonAsyncLoadFromFile* Action = WeakThis.Get())
+						{
+							Action->Successed.Broadcast(rootElement);
+							Action->SetReadyToDestroy();
+						}
 					});
 			}
 			else
 			{
-				AsyncTask(ENamedThreads::GameThread, [this]()
+				AsyncTask(ENamedThreads::GameThread, [WeakThis]()
 					{
-						Failed.Broadcast(nullptr);
-						SetReadyToDestroy();
+						if (UEasyJsonAsyncLoadFromFile* Action = WeakThis.Get())
+						{
+							Action->Failed.Broadcast(nullptr);
+							Action->SetReadyToDestroy();
+						}
 					});
 			}
 
@@ -22,27 +22,35 @@ UEasyJsonAsyncLoadFromString* UEasyJsonAsyncLoadFromString::AsyncLoadFromString(
 
 void UEasyJsonAsyncLoadFromString::Activate()
 {
-	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this]()
+	// The task may outlive the action, so it only holds a weak reference and a copy of the input
+	TWeakObjectPtr<UEasyJsonAsyncLoadFromString> WeakThis(this);
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis, JsonString = _JsonString]()
 		{
 			auto manager = NewObject<UEasyJsonParseManager>();
 			EEasyJsonParserErrorCode _isSuccessed;
 
-			auto rootElement = manager->LoadFromString(_JsonString, _isSuccessed);
+			auto rootElement = manager->LoadFromString(JsonString, _isSuccessed);
 			
 			if (_isSuccessed == EEasyJsonParserErrorCode::Successed)
 			{
-				AsyncTask(ENamedThreads::GameThread, [this, rootElement]()
+				AsyncTask(ENamedThreads::GameThread, [WeakThis, rootElement]()
 					{
-						Successed.Broadcast(rootElement);
-						SetReadyToDestroy();
+						if (UEasyJsonAsyncLoadFromString* Action = WeakThis.Get())
+						{
+							Action->Successed.Broadcast(rootElement);
+							Action->SetReadyToDestroy();
+						}
 					});
 			}
 			else
 			{
-				AsyncTask(ENamedThreads::GameThread, [this]()
+				AsyncTask(ENamedThreads::GameThread, [WeakThis]()
 					{
-						Failed.Broadcast(nullptr);
-						SetReadyToDestroy();
+						if (UEasyJsonAsyncLoadFromString* Action = WeakThis.Get())
+						{
+							Action->Failed.Broadcast(nullptr);
+							Action->SetReadyToDestroy();
+						}
 					});
 			}
 
@@ -1,6 +1,6 @@
 // Copyright 2019 ayumax. All Rights Reserved.
 #include "EasyJsonObject.h"
-#include "Internationalization/Regex.h"
+#include "AdvancedAccessParser.h"
 
 UEasyJsonObject* UEasyJsonObject::CreateEasyJsonObject(TSharedPtr<FJsonObject> JsonObject)
 {
@@ -148,18 +148,12 @@ UEasyJsonValue* UEasyJsonObject::ReadEasyJsonValue(const FString& AccessString)
 
 bool UEasyJsonObject::IsAccessAsArray(const FString& AccessName, FString& ElementName, int32& ArrayIndex)
 {
-	const FRegexPattern pattern = FRegexPattern(FString(TEXT("(.*)\\[([0-9]+)\\]$")));
-	FRegexMatcher matcher(pattern, AccessName);
-
-	while (matcher.FindNext())
+	// "<name>[<digits>]" is tokenized like the V2 access strings; with several index groups the last one is used
+	FAccessToken token;
+	if (FAccessStringTokenizer::TokenizeComponent(AccessName, token) && token.IsArrayAccess())
 	{
-		ElementName = matcher.GetCaptureGroup(1);
-
-		FString numStr = matcher.GetCaptureGroup(2);
-		if (numStr.IsNumeric())
-		{
-			ArrayIndex = (FCString::Atoi(*numStr));
-		}
+		ElementName = FString(token.PropertyName);
+		ArrayIndex = token.ArrayIndices.Last();
 
 		return true;
 	}
@@ -4,6 +4,7 @@
 #include "EasyJsonObject.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
+#include "EasyJsonFastParserV2.h"
 
 EasyJsonObjectMaker::EasyJsonObjectMaker()
 {
@@ -15,6 +16,24 @@ EasyJsonObjectMaker::~EasyJsonObjectMaker()
 
 UEasyJsonObject* EasyJsonObjectMaker::Parse(FString jsonString, FString &ErrorMessage)
 {
+	// try the fast parser first; an array root is wrapped in a "root" field like below
+	TSharedPtr<FJsonValue> rootValue;
+	FString fastParseError;
+	if (FEasyJsonFastParserV2::ParseValue(jsonString, rootValue, fastParseError))
+	{
+		if (rootValue->Type == EJson::Object)
+		{
+			return UEasyJsonObject::CreateEasyJsonObject(rootValue->AsObject());
+		}
+
+		if (rootValue->Type == EJson::Array)
+		{
+			TSharedPtr<FJsonObject> rootObject = MakeShareable(new FJsonObject());
+			rootObject->SetField(TEXT("root"), rootValue);
+			return UEasyJsonObject::CreateEasyJsonObject(rootObject);
+		}
+	}
+
 	jsonString = jsonString.TrimStartAndEnd();
 
 	if (jsonString[0] == TEXT('['))
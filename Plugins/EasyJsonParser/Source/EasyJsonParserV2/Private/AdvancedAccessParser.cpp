@@ -2,7 +2,320 @@
 
 #include "AdvancedAccessParser.h"
 #include "EasyJsonParserV2Debug.h"
-#include "Internationalization/Regex.h"
+#include "Hash/CityHash.h"
+#include "Misc/ScopeLock.h"
+
+namespace EasyJsonAccessStringTokenizer
+{
+	FORCEINLINE bool IsDigit(TCHAR Char)
+	{
+		return Char >= TEXT('0') && Char <= TEXT('9');
+	}
+	
+	FORCEINLINE bool IsIdentifierStart(TCHAR Char)
+	{
+		return (Char >= TEXT('a') && Char <= TEXT('z')) || (Char >= TEXT('A') && Char <= TEXT('Z')) || Char == TEXT('_');
+	}
+	
+	FORCEINLINE bool IsIdentifierChar(TCHAR Char)
+	{
+		return IsIdentifierStart(Char) || IsDigit(Char);
+	}
+	
+	FORCEINLINE int32 SkipWhitespace(FStringView View, int32 Pos)
+	{
+		while (Pos < View.Len() && FChar::IsWhitespace(View[Pos]))
+		{
+			++Pos;
+		}
+		return Pos;
+	}
+	
+	FStringView TrimWhitespace(FStringView View)
+	{
+		int32 Start = 0;
+		int32 End = View.Len();
+		while (Start < End && FChar::IsWhitespace(View[Start]))
+		{
+			++Start;
+		}
+		while (End > Start && FChar::IsWhitespace(View[End - 1]))
+		{
+			--End;
+		}
+		return View.Mid(Start, End - Start);
+	}
+}
+
+void FAccessStringTokenizer::Tokenize(FStringView AccessString, FAccessTokenArray& OutTokens, bool bAllowSelectors)
+{
+	OutTokens.Reset();
+	
+	FAccessToken Token;
+	int32 ComponentStart = 0;
+	for (int32 Index = 0; Index <= AccessString.Len(); ++Index)
+	{
+		if (Index == AccessString.Len() || AccessString[Index] == TEXT('.'))
+		{
+			if (TokenizeComponent(AccessString.Mid(ComponentStart, Index - ComponentStart), Token, bAllowSelectors))
+			{
+				OutTokens.Add(Token);
+			}
+			ComponentStart = Index + 1;
+		}
+	}
+}
+
+bool FAccessStringTokenizer::TokenizeComponent(FStringView Component, FAccessToken& OutToken, bool bAllowSelectors)
+{
+	using namespace EasyJsonAccessStringTokenizer;
+	
+	OutToken.ArrayIndices.Reset();
+	OutToken.bWellFormed = IsWellFormedComponent(Component);
+	OutToken.bIndicesValid = true;
+	
+	const FStringView Trimmed = TrimWhitespace(Component);
+	const int32 Len = Trimmed.Len();
+	
+	int32 FirstBracketIndex = INDEX_NONE;
+	Trimmed.FindChar(TEXT('['), FirstBracketIndex);
+	
+	if (FirstBracketIndex != INDEX_NONE)
+	{
+		// Collect every "[digits]" group (and "[*]" with selectors) after the property name
+		int32 Pos = FirstBracketIndex;
+		while (Pos < Len)
+		{
+			if (Trimmed[Pos] != TEXT('['))
+			{
+				OutToken.bIndicesValid &= FChar::IsWhitespace(Trimmed[Pos]);
+				++Pos;
+				continue;
+			}
+			
+			int32 Cursor = SkipWhitespace(Trimmed, Pos + 1);
+			const int32 DigitsStart = Cursor;
+			int64 Value = 0;
+			if (bAllowSelectors && Cursor < Len && Trimmed[Cursor] == TEXT('*'))
+			{
+				Value = AnyIndex;
+				++Cursor;
+			}
+			else
+			{
+				while (Cursor < Len && IsDigit(Trimmed[Cursor]))
+				{
+					Value = FMath::Min<int64>(Value * 10 + (Trimmed[Cursor] - TEXT('0')), MAX_int32);
+					++Cursor;
+				}
+			}
+			const bool bHasDigits = Cursor > DigitsStart;
+			Cursor = SkipWhitespace(Trimmed, Cursor);
+			
+			if (bHasDigits && Cursor < Len && Trimmed[Cursor] == TEXT(']'))
+			{
+				OutToken.ArrayIndices.Add(static_cast<int32>(Value));
+				Pos = Cursor + 1;
+			}
+			else
+			{
+				OutToken.bIndicesValid = false;
+				++Pos;
+			}
+		}
+	}
+	
+	// Components without any valid index keep their full text as property name
+	OutToken.PropertyName = OutToken.ArrayIndices.Num() > 0 ? TrimWhitespace(Trimmed.Left(FirstBracketIndex)) : Trimmed;
+	return !OutToken.PropertyName.IsEmpty() || (bAllowSelectors && OutToken.ArrayIndices.Num() > 0);
+}
+
+bool FAccessStringTokenizer::IsWellFormedComponent(FStringView Component)
+{
+	using namespace EasyJsonAccessStringTokenizer;
+	
+	const int32 Len = Component.Len();
+	if (Len == 0 || !IsIdentifierStart(Component[0]))
+	{
+		return false;
+	}
+	
+	int32 Pos = 1;
+	while (Pos < Len && IsIdentifierChar(Component[Pos]))
+	{
+		++Pos;
+	}
+	
+	while (Pos < Len)
+	{
+		if (Component[Pos] != TEXT('['))
+		{
+			return false;
+		}
+		
+		const int32 DigitsStart = ++Pos;
+		while (Pos < Len && IsDigit(Component[Pos]))
+		{
+			++Pos;
+		}
+		
+		if (Pos == DigitsStart || Pos >= Len || Component[Pos] != TEXT(']'))
+		{
+			return false;
+		}
+		++Pos;
+	}
+	
+	return true;
+}
+
+namespace EasyJsonAccessStringCache
+{
+	// Number of independently locked shards
+	constexpr int32 NumShards = 16;
+	
+	struct FEntry
+	{
+		uint64 Hash = 0;
+		FString AccessString;
+		TSharedPtr<const TArray<FAccessStep>, ESPMode::ThreadSafe> Steps;
+		
+		// Neighbours in the LRU list (INDEX_NONE terminates)
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+	};
+	
+	/**
+	 * One bounded LRU shard. Entries live in a flat array and are linked from most recently used (Head)
+	 * to least recently used (Tail), so eviction reuses slots instead of allocating.
+	 */
+	struct FShard
+	{
+		FCriticalSection Lock;
+		TArray<FEntry> Entries;
+		TMap<uint64, int32> EntryIndexByHash;
+		int32 Head = INDEX_NONE;
+		int32 Tail = INDEX_NONE;
+		int32 Capacity = 0;
+		uint64 Hits = 0;
+		uint64 Misses = 0;
+		uint64 Evictions = 0;
+		
+		void Unlink(int32 EntryIndex)
+		{
+			FEntry& Entry = Entries[EntryIndex];
+			if (Entry.Prev != INDEX_NONE) Entries[Entry.Prev].Next = Entry.Next; else Head = Entry.Next;
+			if (Entry.Next != INDEX_NONE) Entries[Entry.Next].Prev = Entry.Prev; else Tail = Entry.Prev;
+			Entry.Prev = INDEX_NONE;
+			Entry.Next = INDEX_NONE;
+		}
+		
+		void LinkAsHead(int32 EntryIndex)
+		{
+			FEntry& Entry = Entries[EntryIndex];
+			Entry.Prev = INDEX_NONE;
+			Entry.Next = Head;
+			if (Head != INDEX_NONE) Entries[Head].Prev = EntryIndex;
+			Head = EntryIndex;
+			if (Tail == INDEX_NONE) Tail = EntryIndex;
+		}
+		
+		const FEntry* FindAndTouch(uint64 Hash, const FString& AccessString)
+		{
+			const int32* EntryIndex = EntryIndexByHash.Find(Hash);
+			if (!EntryIndex || !Entries[*EntryIndex].AccessString.Equals(AccessString, ESearchCase::CaseSensitive))
+			{
+				return nullptr;
+			}
+			
+			if (*EntryIndex != Head)
+			{
+				const int32 TouchedIndex = *EntryIndex;
+				Unlink(TouchedIndex);
+				LinkAsHead(TouchedIndex);
+			}
+			return &Entries[*EntryIndex];
+		}
+		
+		void Add(uint64 Hash, const FString& AccessString, const FAccessStepsRef& Steps)
+		{
+			if (Capacity <= 0)
+			{
+				return;
+			}
+			
+			int32 EntryIndex = INDEX_NONE;
+			if (const int32* ExistingIndex = EntryIndexByHash.Find(Hash))
+			{
+				// Same hash (or a colliding string): reuse the slot
+				EntryIndex = *ExistingIndex;
+				Unlink(EntryIndex);
+			}
+			else if (Entries.Num() < Capacity)
+			{
+				EntryIndex = Entries.AddDefaulted();
+			}
+			else
+			{
+				// Evict the least recently used entry
+				EntryIndex = Tail;
+				Unlink(EntryIndex);
+				EntryIndexByHash.Remove(Entries[EntryIndex].Hash);
+				++Evictions;
+			}
+			
+			FEntry& Entry = Entries[EntryIndex];
+			Entry.Hash = Hash;
+			Entry.AccessString = AccessString;
+			Entry.Steps = Steps;
+			EntryIndexByHash.Add(Hash, EntryIndex);
+			LinkAsHead(EntryIndex);
+		}
+		
+		void Reset(int32 InCapacity)
+		{
+			Entries.Empty(InCapacity);
+			EntryIndexByHash.Empty(InCapacity);
+			Head = INDEX_NONE;
+			Tail = INDEX_NONE;
+			Capacity = InCapacity;
+			Hits = 0;
+			Misses = 0;
+			Evictions = 0;
+		}
+	};
+	
+	struct FCache
+	{
+		FShard Shards[NumShards];
+		
+		FCache()
+		{
+			Reset(FAdvancedAccessParser::DefaultCacheCapacity);
+		}
+		
+		void Reset(int32 MaxEntries)
+		{
+			const int32 ShardCapacity = MaxEntries > 0 ? FMath::DivideAndRoundUp(MaxEntries, NumShards) : 0;
+			for (FShard& Shard : Shards)
+			{
+				FScopeLock ScopeLock(&Shard.Lock);
+				Shard.Reset(ShardCapacity);
+			}
+		}
+	};
+	
+	FCache& Get()
+	{
+		static FCache Cache;
+		return Cache;
+	}
+	
+	uint64 HashAccessString(const FString& AccessString)
+	{
+		return CityHash64(reinterpret_cast<const char*>(*AccessString), AccessString.Len() * sizeof(TCHAR));
+	}
+}
 
 TArray<FAccessStep> FAdvancedAccessParser::ParseAccessString(const FString& AccessString)
 {
@@ -16,23 +329,20 @@ TArray<FAccessStep> FAdvancedAccessParser::ParseAccessString(const FString& Acce
 		return Steps;
 	}
 	
-	// Sanitize the access string first
-	FString SanitizedString = SanitizeAccessString(AccessString);
-	
-	// Split by dots to get components
-	TArray<FString> Components;
-	SanitizedString.ParseIntoArray(Components, TEXT("."), true);
+	// Tokenize in a single pass (whitespace around dots and brackets is skipped)
+	FAccessTokenArray Tokens;
+	FAccessStringTokenizer::Tokenize(AccessString, Tokens);
 	
-	// Parse each component
-	for (const FString& Component : Components)
+	Steps.Reserve(Tokens.Num());
+	for (const FAccessToken& Token : Tokens)
 	{
-		if (!Component.IsEmpty())
+		if (Token.IsArrayAccess())
 		{
-			FAccessStep Step = ParseAccessComponent(Component);
-			if (!Step.PropertyName.IsEmpty())
-			{
-				Steps.Add(Step);
-			}
+			Steps.Add(FAccessStep(FString(Token.PropertyName), TArray<int32>(Token.ArrayIndices)));
+		}
+		else
+		{
+			Steps.Add(FAccessStep(FString(Token.PropertyName)));
 		}
 	}
 	
@@ -40,34 +350,81 @@ TArray<FAccessStep> FAdvancedAccessParser::ParseAccessString(const FString& Acce
 	return Steps;
 }
 
-bool FAdvancedAccessParser::IsValidAccessString(const FString& AccessString)
+FAccessStepsRef FAdvancedAccessParser::ParseAccessStringCached(const FString& AccessString)
 {
-	if (AccessString.IsEmpty())
+	using namespace EasyJsonAccessStringCache;
+	
+	const uint64 Hash = HashAccessString(AccessString);
+	FShard& Shard = Get().Shards[Hash % NumShards];
+	
 	{
-		return false;
+		FScopeLock ScopeLock(&Shard.Lock);
+		if (const FEntry* Entry = Shard.FindAndTouch(Hash, AccessString))
+		{
+			++Shard.Hits;
+			return Entry->Steps.ToSharedRef();
+		}
+		++Shard.Misses;
 	}
 	
-	// Check basic syntax rules
-	if (AccessString.StartsWith(TEXT(".")) || AccessString.EndsWith(TEXT(".")))
+	// Parse outside the lock so other threads hitting this shard are not blocked
+	FAccessStepsRef Steps = MakeShared<const TArray<FAccessStep>, ESPMode::ThreadSafe>(ParseAccessString(AccessString));
+	
 	{
-		return false;
+		FScopeLock ScopeLock(&Shard.Lock);
+		if (const FEntry* Entry = Shard.FindAndTouch(Hash, AccessString))
+		{
+			// Another thread parsed the same string meanwhile
+			return Entry->Steps.ToSharedRef();
+		}
+		Shard.Add(Hash, AccessString, Steps);
 	}
 	
-	// Check for consecutive dots
-	if (AccessString.Contains(TEXT("..")))
+	return Steps;
+}
+
+FAccessStringCacheStats FAdvancedAccessParser::GetCacheStats()
+{
+	using namespace EasyJsonAccessStringCache;
+	
+	FAccessStringCacheStats Stats;
+	for (FShard& Shard : Get().Shards)
+	{
+		FScopeLock ScopeLock(&Shard.Lock);
+		Stats.Hits += Shard.Hits;
+		Stats.Misses += Shard.Misses;
+		Stats.Evictions += Shard.Evictions;
+		Stats.NumEntries += Shard.Entries.Num();
+		Stats.Capacity += Shard.Capacity;
+	}
+	return Stats;
+}
+
+void FAdvancedAccessParser::ResetCache(int32 MaxEntries)
+{
+	EasyJsonAccessStringCache::Get().Reset(MaxEntries);
+}
+
+bool FAdvancedAccessParser::IsValidAccessString(const FString& AccessString)
+{
+	if (AccessString.IsEmpty())
 	{
 		return false;
 	}
 	
-	// Split by dots and validate each component
-	TArray<FString> Components;
-	AccessString.ParseIntoArray(Components, TEXT("."), true);
-	
-	for (const FString& Component : Components)
+	// Every dot separated component must be well formed; leading, trailing
+	// and consecutive dots produce empty components and fail here
+	const FStringView View(AccessString);
+	int32 ComponentStart = 0;
+	for (int32 Index = 0; Index <= View.Len(); ++Index)
 	{
-		if (!ValidateBracketSyntax(Component))
+		if (Index == View.Len() || View[Index] == TEXT('.'))
 		{
-			return false;
+			if (!FAccessStringTokenizer::IsWellFormedComponent(View.Mid(ComponentStart, Index - ComponentStart)))
+			{
+				return false;
+			}
+			ComponentStart = Index + 1;
 		}
 	}
 	
@@ -104,8 +461,8 @@ int32 FAdvancedAccessParser::GetMaxArrayDepth(const FString& AccessString)
 {
 	int32 MaxDepth = 0;
 	
-	TArray<FAccessStep> Steps = ParseAccessString(AccessString);
-	for (const FAccessStep& Step : Steps)
+	FAccessStepsRef Steps = ParseAccessStringCached(AccessString);
+	for (const FAccessStep& Step : *Steps)
 	{
 		if (Step.bIsArrayAccess)
 		{
@@ -127,7 +484,7 @@ FAccessStep FAdvancedAccessParser::ParseAccessComponent(const FString& Component
 	}
 	else
 	{
-		return FAccessStep(Component);
+		return FAccessStep(PropertyName);
 	}
 }
 
@@ -135,87 +492,16 @@ bool FAdvancedAccessParser::ExtractArrayIndices(const FString& Component, FStrin
 {
 	OutIndices.Empty();
 	
-	// Find the first bracket
-	int32 FirstBracketIndex = Component.Find(TEXT("["));
-	if (FirstBracketIndex == INDEX_NONE)
-	{
-		OutPropertyName = Component;
-		return false;
-	}
-	
-	// Extract property name (everything before the first bracket)
-	OutPropertyName = Component.Left(FirstBracketIndex);
+	FAccessToken Token;
+	FAccessStringTokenizer::TokenizeComponent(Component, Token);
 	
-	// Extract all bracket pairs using regex
-	FString BracketPart = Component.Mid(FirstBracketIndex);
-	
-	// Regex pattern to match [number] patterns
-	const FRegexPattern Pattern = FRegexPattern(TEXT("\\[(\\d+)\\]"));
-	FRegexMatcher Matcher(Pattern, BracketPart);
-	
-	// Find all matches
-	while (Matcher.FindNext())
-	{
-		FString IndexStr = Matcher.GetCaptureGroup(1);
-		if (IndexStr.IsNumeric())
-		{
-			int32 Index = FCString::Atoi(*IndexStr);
-			OutIndices.Add(Index);
-		}
-	}
+	OutPropertyName = FString(Token.PropertyName);
+	OutIndices.Append(Token.ArrayIndices);
 	
 	return OutIndices.Num() > 0;
 }
 
 bool FAdvancedAccessParser::ValidateBracketSyntax(const FString& Component)
 {
-	if (Component.IsEmpty())
-	{
-		return false;
-	}
-	
-	// Count brackets
-	int32 OpenBrackets = 0;
-	int32 CloseBrackets = 0;
-	
-	for (int32 i = 0; i < Component.Len(); i++)
-	{
-		TCHAR Char = Component[i];
-		if (Char == TEXT('['))
-		{
-			OpenBrackets++;
-		}
-		else if (Char == TEXT(']'))
-		{
-			CloseBrackets++;
-			
-			// Check if we have more close brackets than open brackets at any point
-			if (CloseBrackets > OpenBrackets)
-			{
-				return false;
-			}
-		}
-	}
-	
-	// Must have equal number of open and close brackets
-	if (OpenBrackets != CloseBrackets)
-	{
-		return false;
-	}
-	
-	// If there are brackets, validate the pattern
-	if (OpenBrackets > 0)
-	{
-		// Use regex to validate that all brackets contain valid indices
-		const FRegexPattern Pattern = FRegexPattern(TEXT("^([a-zA-Z_][a-zA-Z0-9_]*)(\\[\\d+\\])*$"));
-		FRegexMatcher Matcher(Pattern, Component);
-		
-		return Matcher.FindNext();
-	}
-	
-	// No brackets, just validate property name
-	const FRegexPattern PropertyPattern = FRegexPattern(TEXT("^[a-zA-Z_][a-zA-Z0-9_]*$"));
-	FRegexMatcher PropertyMatcher(PropertyPattern, Component);
-	
-	return PropertyMatcher.FindNext();
-}
\ No newline at end of file
+	return FAccessStringTokenizer::IsWellFormedComponent(Component);
+}
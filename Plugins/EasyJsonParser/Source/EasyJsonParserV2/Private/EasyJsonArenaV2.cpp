@@ -0,0 +1,136 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonArenaV2.h"
+
+FEasyJsonArenaV2::FEasyJsonArenaV2(SIZE_T InitialBlockSize)
+	: NextBlockSize(FMath::Max<SIZE_T>(InitialBlockSize, 1))
+{
+}
+
+FEasyJsonArenaV2::~FEasyJsonArenaV2()
+{
+	FreeBlocks(CurrentBlock);
+}
+
+FEasyJsonArenaV2::FEasyJsonArenaV2(FEasyJsonArenaV2&& Other)
+	: CurrentBlock(Other.CurrentBlock)
+	, Cursor(Other.Cursor)
+	, End(Other.End)
+	, NextBlockSize(Other.NextBlockSize)
+	, UsedInPreviousBlocks(Other.UsedInPreviousBlocks)
+{
+	Other.CurrentBlock = nullptr;
+	Other.Cursor = nullptr;
+	Other.End = nullptr;
+	Other.NextBlockSize = DefaultBlockSize;
+	Other.UsedInPreviousBlocks = 0;
+}
+
+FEasyJsonArenaV2& FEasyJsonArenaV2::operator=(FEasyJsonArenaV2&& Other)
+{
+	if (this != &Other)
+	{
+		FreeBlocks(CurrentBlock);
+		CurrentBlock = Other.CurrentBlock;
+		Cursor = Other.Cursor;
+		End = Other.End;
+		NextBlockSize = Other.NextBlockSize;
+		UsedInPreviousBlocks = Other.UsedInPreviousBlocks;
+		
+		Other.CurrentBlock = nullptr;
+		Other.Cursor = nullptr;
+		Other.End = nullptr;
+		Other.NextBlockSize = DefaultBlockSize;
+		Other.UsedInPreviousBlocks = 0;
+	}
+	return *this;
+}
+
+void* FEasyJsonArenaV2::Allocate(SIZE_T Size, SIZE_T Alignment)
+{
+	checkSlow(FMath::IsPowerOfTwo(Alignment) && Alignment <= alignof(FBlock));
+	
+	if (Size == 0)
+	{
+		return nullptr;
+	}
+	
+	uint8* Result = Align(Cursor, Alignment);
+	if (CurrentBlock == nullptr || Result + Size > End)
+	{
+		// Blocks start 16-byte aligned, so the new block needs no padding
+		AddBlock(Size);
+		Result = Cursor;
+	}
+	
+	Cursor = Result + Size;
+	return Result;
+}
+
+void FEasyJsonArenaV2::Reset()
+{
+	if (CurrentBlock == nullptr)
+	{
+		return;
+	}
+	
+	FreeBlocks(CurrentBlock->Previous);
+	CurrentBlock->Previous = nullptr;
+	Cursor = reinterpret_cast<uint8*>(CurrentBlock + 1);
+	UsedInPreviousBlocks = 0;
+}
+
+SIZE_T FEasyJsonArenaV2::GetAllocatedSize() const
+{
+	SIZE_T Total = 0;
+	for (const FBlock* Block = CurrentBlock; Block != nullptr; Block = Block->Previous)
+	{
+		Total += Block->Size;
+	}
+	return Total;
+}
+
+SIZE_T FEasyJsonArenaV2::GetUsedSize() const
+{
+	return CurrentBlock != nullptr ? UsedInPreviousBlocks + (Cursor - reinterpret_cast<const uint8*>(CurrentBlock + 1)) : 0;
+}
+
+int32 FEasyJsonArenaV2::GetNumBlocks() const
+{
+	int32 Count = 0;
+	for (const FBlock* Block = CurrentBlock; Block != nullptr; Block = Block->Previous)
+	{
+		++Count;
+	}
+	return Count;
+}
+
+void FEasyJsonArenaV2::AddBlock(SIZE_T MinUsableSize)
+{
+	if (CurrentBlock != nullptr)
+	{
+		UsedInPreviousBlocks += Cursor - reinterpret_cast<uint8*>(CurrentBlock + 1);
+	}
+	
+	const SIZE_T UsableSize = FMath::Max(NextBlockSize, MinUsableSize);
+	FBlock* Block = static_cast<FBlock*>(FMemory::Malloc(sizeof(FBlock) + UsableSize, alignof(FBlock)));
+	Block->Previous = CurrentBlock;
+	Block->Size = sizeof(FBlock) + UsableSize;
+	
+	CurrentBlock = Block;
+	Cursor = reinterpret_cast<uint8*>(Block + 1);
+	End = Cursor + UsableSize;
+	
+	// Grow geometrically so many small requests need few blocks
+	NextBlockSize = FMath::Max(UsableSize * 2, DefaultBlockSize);
+}
+
+void FEasyJsonArenaV2::FreeBlocks(FBlock* Block)
+{
+	while (Block != nullptr)
+	{
+		FBlock* Previous = Block->Previous;
+		FMemory::Free(Block);
+		Block = Previous;
+	}
+}
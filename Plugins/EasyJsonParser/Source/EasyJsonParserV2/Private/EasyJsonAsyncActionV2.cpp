@@ -0,0 +1,37 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonAsyncActionV2.h"
+
+void UEasyJsonAsyncActionV2::Cancel()
+{
+	if (!CancelFlag->AtomicSet(true))
+	{
+		SetReadyToDestroy();
+	}
+}
+
+bool UEasyJsonAsyncActionV2::IsCancelled() const
+{
+	return *CancelFlag;
+}
+
+void UEasyJsonAsyncActionV2::BeginDestroy()
+{
+	// Work that has not started yet can skip its I/O
+	CancelFlag->AtomicSet(true);
+	
+	Super::BeginDestroy();
+}
+
+ENamedThreads::Type UEasyJsonAsyncActionV2::GetWorkerThread() const
+{
+	switch (Priority)
+	{
+	case EEasyJsonAsyncPriorityV2::Low:
+		return ENamedThreads::AnyBackgroundThreadNormalTask;
+	case EEasyJsonAsyncPriorityV2::High:
+		return ENamedThreads::AnyHiPriThreadHiPriTask;
+	default:
+		return ENamedThreads::AnyNormalThreadNormalTask;
+	}
+}
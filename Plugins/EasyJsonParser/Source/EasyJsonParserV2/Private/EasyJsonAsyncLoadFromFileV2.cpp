@@ -0,0 +1,53 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonAsyncLoadFromFileV2.h"
+#include "EasyJsonParseManagerV2.h"
+#include "Async/Async.h"
+
+UEasyJsonAsyncLoadFromFileV2* UEasyJsonAsyncLoadFromFileV2::AsyncLoadFromFile(UObject* WorldContextObject, const FString& FilePath, bool IsAbsolute, EEasyJsonAsyncPriorityV2 Priority, bool bMemoryMapped)
+{
+	UEasyJsonAsyncLoadFromFileV2* Action = NewObject<UEasyJsonAsyncLoadFromFileV2>();
+	Action->RegisterWithGameInstance(WorldContextObject);
+	Action->JsonFile = FilePath;
+	Action->bIsAbsolute = IsAbsolute;
+	Action->bUseMemoryMapping = bMemoryMapped;
+	Action->Priority = Priority;
+	
+	return Action;
+}
+
+void UEasyJsonAsyncLoadFromFileV2::Activate()
+{
+	// The worker only sees copies, the cancel flag and a weak reference
+	TWeakObjectPtr<UEasyJsonAsyncLoadFromFileV2> WeakThis(this);
+	AsyncTask(GetWorkerThread(), [WeakThis, CancelFlag = CancelFlag, FilePath = JsonFile, IsAbsolute = bIsAbsolute, bMemoryMapped = bUseMemoryMapping]()
+	{
+		if (*CancelFlag)
+		{
+			return;
+		}
+		
+		bool bSuccess = false;
+		FString ErrorMessage;
+		FEasyJsonObjectV2 JsonObject = UEasyJsonParseManagerV2::LoadFromFile(FilePath, IsAbsolute, bSuccess, ErrorMessage, bMemoryMapped);
+		
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, CancelFlag, bSuccess, JsonObject = MoveTemp(JsonObject), ErrorMessage = MoveTemp(ErrorMessage)]()
+		{
+			UEasyJsonAsyncLoadFromFileV2* Action = WeakThis.Get();
+			if (Action == nullptr || *CancelFlag)
+			{
+				return;
+			}
+			
+			if (bSuccess)
+			{
+				Action->OnCompleted.Broadcast(JsonObject, FString());
+			}
+			else
+			{
+				Action->OnFailed.Broadcast(FEasyJsonObjectV2(), ErrorMessage);
+			}
+			Action->SetReadyToDestroy();
+		});
+	});
+}
@@ -0,0 +1,64 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonAsyncSaveToFileV2.h"
+#include "EasyJsonParseManagerV2.h"
+#include "EasyJsonDocumentV2.h"
+#include "Async/Async.h"
+
+UEasyJsonAsyncSaveToFileV2* UEasyJsonAsyncSaveToFileV2::AsyncSaveToFile(UObject* WorldContextObject, const FEasyJsonObjectV2& JsonObject, const FString& FilePath, bool IsAbsolute, EEasyJsonAsyncPriorityV2 Priority)
+{
+	UEasyJsonAsyncSaveToFileV2* Action = NewObject<UEasyJsonAsyncSaveToFileV2>();
+	Action->RegisterWithGameInstance(WorldContextObject);
+	
+	// The worker writes an immutable snapshot taken here, so Blueprint can keep editing the object meanwhile.
+	// Document views are immutable already; a tree is copied into a document.
+	if (JsonObject.IsDocumentView())
+	{
+		Action->JsonObject = JsonObject;
+	}
+	else if (JsonObject.IsValid())
+	{
+		Action->JsonObject = FEasyJsonObjectV2::CreateFromDocument(FEasyJsonDocumentV2::FromJsonValue(MakeShared<FJsonValueObject>(JsonObject.ToJsonObject())));
+	}
+	
+	Action->JsonFile = FilePath;
+	Action->bIsAbsolute = IsAbsolute;
+	Action->Priority = Priority;
+	
+	return Action;
+}
+
+void UEasyJsonAsyncSaveToFileV2::Activate()
+{
+	// The worker only sees the snapshot, the cancel flag and a weak reference
+	TWeakObjectPtr<UEasyJsonAsyncSaveToFileV2> WeakThis(this);
+	AsyncTask(GetWorkerThread(), [WeakThis, CancelFlag = CancelFlag, Object = MoveTemp(JsonObject), FilePath = JsonFile, IsAbsolute = bIsAbsolute]()
+	{
+		if (*CancelFlag)
+		{
+			return;
+		}
+		
+		FString ErrorMessage;
+		const bool bSuccess = UEasyJsonParseManagerV2::SaveToFile(Object, FilePath, IsAbsolute, ErrorMessage);
+		
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, CancelFlag, bSuccess, ErrorMessage = MoveTemp(ErrorMessage)]()
+		{
+			UEasyJsonAsyncSaveToFileV2* Action = WeakThis.Get();
+			if (Action == nullptr || *CancelFlag)
+			{
+				return;
+			}
+			
+			if (bSuccess)
+			{
+				Action->OnCompleted.Broadcast(FString());
+			}
+			else
+			{
+				Action->OnFailed.Broadcast(ErrorMessage);
+			}
+			Action->SetReadyToDestroy();
+		});
+	});
+}
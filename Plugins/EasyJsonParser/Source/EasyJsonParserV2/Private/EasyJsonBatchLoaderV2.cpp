@@ -0,0 +1,148 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonBatchLoaderV2.h"
+#include "EasyJsonParseManagerV2.h"
+#include "EasyJsonParserV2Debug.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include <atomic>
+
+namespace EasyJsonBatchLoader
+{
+	// Bytes of one file, filled in on the thread pool
+	struct FFileRead
+	{
+		TArray<uint8> Bytes;
+		FString ErrorMessage;
+		bool bSuccess = false;
+		double Seconds = 0.0;
+	};
+	
+	typedef TSharedRef<FFileRead, ESPMode::ThreadSafe> FFileReadRef;
+	
+	// Start reading a file on the thread pool
+	TFuture<void> StartRead(const FString& FilePath, const FFileReadRef& Read)
+	{
+		return Async(EAsyncExecution::ThreadPool, [FilePath, Read]()
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			if (!FPlatformFileManager::Get().GetPlatformFile().FileExists(*FilePath))
+			{
+				Read->ErrorMessage = FString::Printf(TEXT("File not found: %s"), *FilePath);
+			}
+			else if (!FFileHelper::LoadFileToArray(Read->Bytes, *FilePath))
+			{
+				Read->ErrorMessage = FString::Printf(TEXT("Failed to read file: %s"), *FilePath);
+			}
+			else
+			{
+				Read->bSuccess = true;
+			}
+			Read->Seconds = FPlatformTime::Seconds() - StartTime;
+		});
+	}
+}
+
+FEasyJsonBatchLoaderV2::FEasyJsonBatchLoaderV2(int32 InMaxConcurrency)
+	: MaxConcurrency(InMaxConcurrency > 0 ? InMaxConcurrency : FTaskGraphInterface::Get().GetNumWorkerThreads() + 1)
+{
+}
+
+TArray<FEasyJsonBatchFileResultV2> FEasyJsonBatchLoaderV2::LoadAll(const TArray<FString>& FilePaths) const
+{
+	TArray<FEasyJsonBatchFileResultV2> Results;
+	Results.SetNum(FilePaths.Num());
+	
+	// Every file has its own slot, so workers never write to the same element
+	Load(FilePaths, [&Results](FEasyJsonBatchFileResultV2&& Result)
+	{
+		Results[Result.FileIndex] = MoveTemp(Result);
+	});
+	
+	return Results;
+}
+
+bool FEasyJsonBatchLoaderV2::Load(const TArray<FString>& FilePaths, TFunctionRef<void(FEasyJsonBatchFileResultV2&& Result)> OnFileLoaded) const
+{
+	using namespace EasyJsonBatchLoader;
+	
+	const int32 NumFiles = FilePaths.Num();
+	std::atomic<int32> NextFile(0);
+	std::atomic<bool> bAllLoaded(true);
+	
+	ParallelFor(FMath::Min(MaxConcurrency, NumFiles), [&](int32 WorkerIndex)
+	{
+		int32 FileIndex = NextFile++;
+		if (FileIndex >= NumFiles)
+		{
+			return;
+		}
+		
+		FFileReadRef Read = MakeShared<FFileRead, ESPMode::ThreadSafe>();
+		TFuture<void> PendingRead = StartRead(FilePaths[FileIndex], Read);
+		
+		while (FileIndex < NumFiles)
+		{
+			PendingRead.Wait();
+			const FFileReadRef CurrentRead = Read;
+			
+			// Read the next file while this one is parsed
+			const int32 NextFileIndex = NextFile++;
+			if (NextFileIndex < NumFiles)
+			{
+				Read = MakeShared<FFileRead, ESPMode::ThreadSafe>();
+				PendingRead = StartRead(FilePaths[NextFileIndex], Read);
+			}
+			
+			FEasyJsonBatchFileResultV2 Result;
+			Result.FileIndex = FileIndex;
+			Result.FilePath = FilePaths[FileIndex];
+			Result.FileSize = CurrentRead->Bytes.Num();
+			Result.ReadSeconds = CurrentRead->Seconds;
+			if (CurrentRead->bSuccess)
+			{
+				const double StartTime = FPlatformTime::Seconds();
+				Result.Object = UEasyJsonParseManagerV2::LoadFromFileBytes(CurrentRead->Bytes, Result.bSuccess, Result.ErrorMessage);
+				Result.ParseSeconds = FPlatformTime::Seconds() - StartTime;
+			}
+			else
+			{
+				Result.ErrorMessage = CurrentRead->ErrorMessage;
+			}
+			
+			if (!Result.bSuccess)
+			{
+				bAllLoaded.store(false, std::memory_order_relaxed);
+			}
+			OnFileLoaded(MoveTemp(Result));
+			
+			FileIndex = NextFileIndex;
+		}
+	}, EParallelForFlags::Unbalanced);
+	
+	return bAllLoaded.load();
+}
+
+void FEasyJsonBatchLoaderV2::LogTimings(const TArray<FEasyJsonBatchFileResultV2>& Results, int32 MaxFiles)
+{
+	TArray<const FEasyJsonBatchFileResultV2*> Slowest;
+	Slowest.Reserve(Results.Num());
+	for (const FEasyJsonBatchFileResultV2& Result : Results)
+	{
+		Slowest.Add(&Result);
+	}
+	Slowest.Sort([](const FEasyJsonBatchFileResultV2& A, const FEasyJsonBatchFileResultV2& B)
+	{
+		return A.ReadSeconds + A.ParseSeconds > B.ReadSeconds + B.ParseSeconds;
+	});
+	
+	for (int32 Index = 0; Index < FMath::Min(MaxFiles, Slowest.Num()); ++Index)
+	{
+		const FEasyJsonBatchFileResultV2& Result = *Slowest[Index];
+		FEasyJsonV2DebugLogger::LogPerformance(FString::Printf(TEXT("BatchLoad %s (%lld bytes, read %.3fms, parse %.3fms)"),
+			*Result.FilePath, Result.FileSize, Result.ReadSeconds * 1000.0, Result.ParseSeconds * 1000.0), Result.ReadSeconds + Result.ParseSeconds);
+	}
+}
@@ -0,0 +1,215 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonBuilderV2.h"
+#include "EasyJsonTextV2.h"
+
+FEasyJsonBuilderV2::FEasyJsonBuilderV2(int32 InitialCapacity)
+{
+	Reserve(InitialCapacity);
+}
+
+FEasyJsonBuilderV2& FEasyJsonBuilderV2::BeginObject()
+{
+	if (BeginValue())
+	{
+		WriteChar('{');
+		Containers.Add({true, false});
+	}
+	return *this;
+}
+
+FEasyJsonBuilderV2& FEasyJsonBuilderV2::EndObject()
+{
+	if (bError || Containers.Num() == 0 || !Containers.Last().bObject || bAfterKey)
+	{
+		bError = true;
+		return *this;
+	}
+	
+	Containers.Pop();
+	WriteChar('}');
+	return *this;
+}
+
+FEasyJsonBuilderV2& FEasyJsonBuilderV2::BeginArray()
+{
+	if (BeginValue())
+	{
+		WriteChar('[');
+		Containers.Add({false, false});
+	}
+	return *this;
+}
+
+FEasyJsonBuilderV2& FEasyJsonBuilderV2::EndArray()
+{
+	if (bError || Containers.Num() == 0 || Containers.Last().bObject)
+	{
+		bError = true;
+		return *this;
+	}
+	
+	Containers.Pop();
+	WriteChar(']');
+	return *this;
+}
+
+FEasyJsonBuilderV2& FEasyJsonBuilderV2::Key(FStringView Name)
+{
+	if (bError || Containers.Num() == 0 || !Containers.Last().bObject || bAfterKey)
+	{
+		bError = true;
+		return *this;
+	}
+	
+	FContainer& Object = Containers.Last();
+	if (Object.bHasMembers)
+	{
+		WriteChar(',');
+	}
+	Object.bHasMembers = true;
+	
+	WriteString(Name);
+	WriteChar(':');
+	bAfterKey = true;
+	return *this;
+}
+
+FEasyJsonBuilderV2& FEasyJsonBuilderV2::Value(FStringView String)
+{
+	if (BeginValue())
+	{
+		WriteString(String);
+	}
+	return *this;
+}
+
+FEasyJsonBuilderV2& FEasyJsonBuilderV2::Value(bool bValue)
+{
+	if (BeginValue())
+	{
+		bValue ? WriteAnsi("true", 4) : WriteAnsi("false", 5);
+	}
+	return *this;
+}
+
+FEasyJsonBuilderV2& FEasyJsonBuilderV2::Value(int64 Number)
+{
+	if (BeginValue())
+	{
+		ANSICHAR Chars[32];
+		WriteAnsi(Chars, FCStringAnsi::Snprintf(Chars, UE_ARRAY_COUNT(Chars), "%lld", static_cast<long long>(Number)));
+	}
+	return *this;
+}
+
+FEasyJsonBuilderV2& FEasyJsonBuilderV2::Value(uint64 Number)
+{
+	if (BeginValue())
+	{
+		ANSICHAR Chars[32];
+		WriteAnsi(Chars, FCStringAnsi::Snprintf(Chars, UE_ARRAY_COUNT(Chars), "%llu", static_cast<unsigned long long>(Number)));
+	}
+	return *this;
+}
+
+FEasyJsonBuilderV2& FEasyJsonBuilderV2::Value(double Number)
+{
+	if (BeginValue())
+	{
+		ANSICHAR Chars[32];
+		const int32 Length = EasyJsonText::FormatNumber(Number, Chars);
+		Length > 0 ? WriteAnsi(Chars, Length) : WriteAnsi("null", 4);
+	}
+	return *this;
+}
+
+FEasyJsonBuilderV2& FEasyJsonBuilderV2::Null()
+{
+	if (BeginValue())
+	{
+		WriteAnsi("null", 4);
+	}
+	return *this;
+}
+
+void FEasyJsonBuilderV2::Reserve(int32 Bytes)
+{
+	if (Bytes > 0 && BufferNum + Bytes > Buffer.Num())
+	{
+		Buffer.SetNumUninitialized(BufferNum + Bytes);
+	}
+}
+
+void FEasyJsonBuilderV2::Reset()
+{
+	BufferNum = 0;
+	Containers.Reset();
+	bAfterKey = false;
+	bHasRoot = false;
+	bError = false;
+}
+
+FString FEasyJsonBuilderV2::ToString() const
+{
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Buffer.GetData()), BufferNum);
+	return FString(Converted.Length(), Converted.Get());
+}
+
+bool FEasyJsonBuilderV2::BeginValue()
+{
+	if (bError)
+	{
+		return false;
+	}
+	
+	if (Containers.Num() == 0)
+	{
+		// One root value per document
+		bError = bHasRoot;
+		bHasRoot = true;
+	}
+	else if (Containers.Last().bObject)
+	{
+		// Object members need a key first
+		bError = !bAfterKey;
+		bAfterKey = false;
+	}
+	else
+	{
+		FContainer& Array = Containers.Last();
+		if (Array.bHasMembers)
+		{
+			WriteChar(',');
+		}
+		Array.bHasMembers = true;
+	}
+	return !bError;
+}
+
+void FEasyJsonBuilderV2::WriteString(FStringView String)
+{
+	const TCHAR* Chars = String.GetData();
+	const int32 Length = String.Len();
+	
+	// Quotes plus the common case of one byte per character; longer spellings grow the buffer as they come
+	Grow(Length + 2);
+	
+	WriteChar('"');
+	for (int32 CharIndex = 0; CharIndex < Length; ++CharIndex)
+	{
+		BufferNum += EasyJsonText::EncodeCharacter(Chars, Length, CharIndex, Grow(EasyJsonText::MaxCharacterBytes));
+	}
+	WriteChar('"');
+}
+
+void FEasyJsonBuilderV2::GrowBuffer(int32 Count)
+{
+	Buffer.SetNumUninitialized(FMath::Max3(BufferNum + Count, Buffer.Num() * 2, 256));
+}
+
+void FEasyJsonBuilderV2::WriteAnsi(const ANSICHAR* Chars, int32 Count)
+{
+	FMemory::Memcpy(Grow(Count), Chars, Count);
+	BufferNum += Count;
+}
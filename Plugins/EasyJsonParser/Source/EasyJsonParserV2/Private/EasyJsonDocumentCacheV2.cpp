@@ -0,0 +1,162 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonDocumentCacheV2.h"
+#include "EasyJsonDocumentV2.h"
+#include "EasyJsonParseManagerV2.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+FEasyJsonDocumentCacheV2::FEasyJsonDocumentCacheV2(int64 InMaxBytes)
+	: MaxBytes(InMaxBytes)
+{
+}
+
+FEasyJsonObjectV2 FEasyJsonDocumentCacheV2::LoadFile(const FString& FilePath, bool& bSuccess, FString& ErrorMessage)
+{
+	bSuccess = false;
+	ErrorMessage.Empty();
+	
+	const FString Key = MakeKey(FilePath);
+	const FFileStatData StatData = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*Key);
+	if (!StatData.bIsValid || StatData.bIsDirectory)
+	{
+		Invalidate(Key);
+		ErrorMessage = FString::Printf(TEXT("File not found: %s"), *Key);
+		return FEasyJsonObjectV2();
+	}
+	
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (FEntry* Entry = Entries.Find(Key))
+		{
+			if (Entry->FileSize == StatData.FileSize && Entry->ModificationTime == StatData.ModificationTime)
+			{
+				Entry->LastUse = ++UseCounter;
+				++NumHits;
+				bSuccess = true;
+				return Entry->Object;
+			}
+		}
+		++NumMisses;
+	}
+	
+	// Parse outside the lock; two threads missing the same file both parse it and the last one is kept
+	FEasyJsonObjectV2 Object = UEasyJsonParseManagerV2::LoadDocumentFromFile(Key, true, bSuccess, ErrorMessage);
+	if (!bSuccess || !Object.IsDocumentView())
+	{
+		Invalidate(Key);
+		return Object;
+	}
+	
+	FEntry NewEntry;
+	NewEntry.Object = Object;
+	NewEntry.FileSize = StatData.FileSize;
+	NewEntry.ModificationTime = StatData.ModificationTime;
+	NewEntry.Bytes = static_cast<int64>(Object.GetDocument()->GetAllocatedSize());
+	
+	FScopeLock ScopeLock(&Lock);
+	if (const FEntry* OldEntry = Entries.Find(Key))
+	{
+		UsedBytes -= OldEntry->Bytes;
+		Entries.Remove(Key);
+	}
+	
+	// A document larger than the whole budget is handed out without being kept
+	if (NewEntry.Bytes <= MaxBytes)
+	{
+		NewEntry.LastUse = ++UseCounter;
+		UsedBytes += NewEntry.Bytes;
+		Entries.Add(Key, MoveTemp(NewEntry));
+		EvictToBudget();
+	}
+	
+	return Object;
+}
+
+void FEasyJsonDocumentCacheV2::Invalidate(const FString& FilePath)
+{
+	const FString Key = MakeKey(FilePath);
+	
+	FScopeLock ScopeLock(&Lock);
+	if (const FEntry* Entry = Entries.Find(Key))
+	{
+		UsedBytes -= Entry->Bytes;
+		Entries.Remove(Key);
+	}
+}
+
+void FEasyJsonDocumentCacheV2::Clear()
+{
+	FScopeLock ScopeLock(&Lock);
+	Entries.Empty();
+	UsedBytes = 0;
+}
+
+void FEasyJsonDocumentCacheV2::SetMaxBytes(int64 InMaxBytes)
+{
+	FScopeLock ScopeLock(&Lock);
+	MaxBytes = InMaxBytes;
+	EvictToBudget();
+}
+
+int64 FEasyJsonDocumentCacheV2::GetMaxBytes() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return MaxBytes;
+}
+
+int64 FEasyJsonDocumentCacheV2::GetUsedBytes() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return UsedBytes;
+}
+
+int32 FEasyJsonDocumentCacheV2::Num() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Entries.Num();
+}
+
+int64 FEasyJsonDocumentCacheV2::GetNumHits() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return NumHits;
+}
+
+int64 FEasyJsonDocumentCacheV2::GetNumMisses() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return NumMisses;
+}
+
+FEasyJsonDocumentCacheV2& FEasyJsonDocumentCacheV2::Get()
+{
+	static FEasyJsonDocumentCacheV2 Cache;
+	return Cache;
+}
+
+FString FEasyJsonDocumentCacheV2::MakeKey(const FString& FilePath)
+{
+	FString Key = FPaths::ConvertRelativePathToFull(FilePath);
+	FPaths::NormalizeFilename(Key);
+	return Key;
+}
+
+void FEasyJsonDocumentCacheV2::EvictToBudget()
+{
+	while (UsedBytes > MaxBytes && Entries.Num() > 0)
+	{
+		const TPair<FString, FEntry>* Oldest = nullptr;
+		for (const TPair<FString, FEntry>& Pair : Entries)
+		{
+			if (Oldest == nullptr || Pair.Value.LastUse < Oldest->Value.LastUse)
+			{
+				Oldest = &Pair;
+			}
+		}
+		
+		UsedBytes -= Oldest->Value.Bytes;
+		Entries.Remove(FString(Oldest->Key));
+	}
+}
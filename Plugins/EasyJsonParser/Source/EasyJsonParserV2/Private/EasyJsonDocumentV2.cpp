@@ -0,0 +1,747 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonDocumentV2.h"
+#include "EasyJsonFastParserV2.h"
+#include "EasyJsonStructuralIndexV2.h"
+#include "EasyJsonStructuralParserV2.h"
+#include "EasyJsonLazyIndexV2.h"
+
+namespace EasyJsonDocument
+{
+	/**
+	 * Stage 2 handler that appends every value to the tape of a document
+	 */
+	template <typename CharType>
+	class TTapeBuilder
+	{
+	public:
+		explicit TTapeBuilder(FEasyJsonDocumentV2& InDocument)
+			: Document(InDocument)
+		{
+		}
+		
+		/**
+		 * Size the document for an input, so the tape and string buffer never grow
+		 * @param NumPositions Number of positions in the structural index of the input
+		 * @param Length Number of characters in the input
+		 * @return false if the document could not be addressed with 32-bit offsets
+		 */
+		bool AllocateStorage(int32 NumPositions, int32 Length)
+		{
+			// Every indexed position adds at most one entry. A number adds a second one, but each number
+			// is followed by a separator or closing bracket, which add none, unless it is the last value parsed.
+			const int64 MaxEntries = static_cast<int64>(NumPositions) + 1;
+			
+			// Unescaped (and converted) strings are never longer than their source text,
+			// and every string has exactly one indexed opening quote
+			const int64 MaxChars = static_cast<int64>(Length) + static_cast<int64>(NumPositions) * FEasyJsonDocumentV2::LengthPrefixChars;
+			
+			if (MaxEntries > MAX_int32 || MaxChars > MAX_int32)
+			{
+				return false;
+			}
+			
+			Document.AllocateStorage(static_cast<int32>(MaxEntries), static_cast<int32>(MaxChars));
+			return true;
+		}
+		
+		bool OnBeginObject()
+		{
+			return BeginContainer(EEasyJsonTapeType::Object);
+		}
+		
+		bool OnEndObject()
+		{
+			return EndContainer();
+		}
+		
+		bool OnBeginArray()
+		{
+			return BeginContainer(EEasyJsonTapeType::Array);
+		}
+		
+		bool OnEndArray()
+		{
+			return EndContainer();
+		}
+		
+		bool OnKey(TStringView<CharType> Key)
+		{
+			if constexpr (sizeof(CharType) == 1)
+			{
+				// Convert into the string buffer; the characters are only kept if the spelling is new
+				const int32 ConvertedLength = FPlatformString::ConvertedLength<TCHAR>(Key.GetData(), Key.Len());
+				TCHAR* Chars = Document.GetNextStringChars(ConvertedLength);
+				FPlatformString::Convert(Chars, ConvertedLength, Key.GetData(), Key.Len());
+				Document.AppendKey(FStringView(Chars, ConvertedLength));
+			}
+			else
+			{
+				Document.AppendKey(Key);
+			}
+			return true;
+		}
+		
+		bool OnString(TStringView<CharType> Value)
+		{
+			CountValue();
+			AppendString(Value);
+			return true;
+		}
+		
+		bool OnNumber(double Value, TStringView<CharType> Text)
+		{
+			CountValue();
+			Document.AppendNumber(Value);
+			return true;
+		}
+		
+		bool OnBool(bool Value)
+		{
+			CountValue();
+			Document.AddEntry(FEasyJsonDocumentV2::MakeEntry(Value ? EEasyJsonTapeType::True : EEasyJsonTapeType::False, 0));
+			return true;
+		}
+		
+		bool OnNull()
+		{
+			CountValue();
+			Document.AddEntry(FEasyJsonDocumentV2::MakeEntry(EEasyJsonTapeType::Null, 0));
+			return true;
+		}
+	
+	private:
+		// Container being filled
+		struct FFrame
+		{
+			int32 StartIndex;
+			int32 Count;
+		};
+		
+		FORCEINLINE void CountValue()
+		{
+			if (Stack.Num() > 0)
+			{
+				++Stack.Last().Count;
+			}
+		}
+		
+		bool BeginContainer(EEasyJsonTapeType Type)
+		{
+			CountValue();
+			Stack.Add({ Document.TapeNum, 0 });
+			Document.AddEntry(FEasyJsonDocumentV2::MakeEntry(Type, 0));
+			return true;
+		}
+		
+		bool EndContainer()
+		{
+			const FFrame Frame = Stack.Pop();
+			Document.CloseContainer(Frame.StartIndex, Frame.Count);
+			return true;
+		}
+		
+		void AppendString(TStringView<CharType> View)
+		{
+			if constexpr (sizeof(CharType) == 1)
+			{
+				// Convert straight into the string buffer
+				const int32 ConvertedLength = FPlatformString::ConvertedLength<TCHAR>(View.GetData(), View.Len());
+				FPlatformString::Convert(Document.AppendUninitializedString(ConvertedLength), ConvertedLength, View.GetData(), View.Len());
+			}
+			else
+			{
+				Document.AppendString(View.GetData(), View.Len());
+			}
+		}
+		
+		FEasyJsonDocumentV2& Document;
+		TArray<FFrame, TInlineAllocator<32>> Stack;
+	};
+	
+	// Unused reserved room below which a parsed document keeps its block instead of copying into a smaller one
+	constexpr SIZE_T MinShrinkBytes = 64 * 1024;
+	
+	// Count the tape entries, strings and string characters needed to store a value
+	void CountJsonValue(const TSharedPtr<FJsonValue>& Value, int64& OutEntries, int64& OutStrings, int64& OutChars)
+	{
+		switch (Value.IsValid() ? Value->Type : EJson::Null)
+		{
+		case EJson::Number:
+			OutEntries += 2;
+			break;
+		case EJson::String:
+		{
+			FString String;
+			Value->TryGetString(String);
+			++OutEntries;
+			++OutStrings;
+			OutChars += String.Len();
+			break;
+		}
+		case EJson::Array:
+			++OutEntries;
+			for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+			{
+				CountJsonValue(Element, OutEntries, OutStrings, OutChars);
+			}
+			break;
+		case EJson::Object:
+		{
+			++OutEntries;
+			const TSharedPtr<FJsonObject> Object = Value->AsObject();
+			if (Object.IsValid())
+			{
+				for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Object->Values)
+				{
+					++OutEntries;
+					++OutStrings;
+					OutChars += Pair.Key.Len();
+					CountJsonValue(Pair.Value, OutEntries, OutStrings, OutChars);
+				}
+			}
+			break;
+		}
+		default:
+			++OutEntries;
+			break;
+		}
+	}
+	
+	template <typename CharType>
+	TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> Parse(TStringView<CharType> Json, FString& OutErrorMessage)
+	{
+		if (Json.IsEmpty())
+		{
+			OutErrorMessage = TEXT("Empty JSON string");
+			return nullptr;
+		}
+		
+		FEasyJsonStructuralIndexV2 Index;
+		if (!Index.Build(Json.GetData(), Json.Len(), FEasyJsonFastParserV2::GetSimdLevel()))
+		{
+			OutErrorMessage = TEXT("Unterminated string");
+			return nullptr;
+		}
+		
+		TSharedRef<FEasyJsonDocumentV2, ESPMode::ThreadSafe> Document = MakeShared<FEasyJsonDocumentV2, ESPMode::ThreadSafe>();
+		TTapeBuilder<CharType> Builder(*Document);
+		if (!Builder.AllocateStorage(Index.Num(), Json.Len()))
+		{
+			OutErrorMessage = TEXT("Document is too large");
+			return nullptr;
+		}
+		
+		TEasyJsonStructuralParserV2<CharType, TTapeBuilder<CharType>> Parser(Json.GetData(), Json.Len(), Index, Builder);
+		if (!Parser.Parse())
+		{
+			OutErrorMessage = Parser.GetErrorMessage();
+			return nullptr;
+		}
+		
+		Document->ShrinkStorage();
+		return Document;
+	}
+}
+
+TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> FEasyJsonDocumentV2::Parse(FStringView Json, FString& OutErrorMessage)
+{
+	return EasyJsonDocument::Parse(Json, OutErrorMessage);
+}
+
+TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> FEasyJsonDocumentV2::Parse(FUtf8StringView Json, FString& OutErrorMessage)
+{
+	return EasyJsonDocument::Parse(Json, OutErrorMessage);
+}
+
+TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> FEasyJsonDocumentV2::FromJsonValue(const TSharedPtr<FJsonValue>& Value)
+{
+	if (!Value.IsValid())
+	{
+		return nullptr;
+	}
+	
+	// Size the storage up front (repeated keys make it an upper bound), so the copy is a single allocation
+	int64 NumEntries = 0;
+	int64 NumStrings = 0;
+	int64 NumChars = 0;
+	EasyJsonDocument::CountJsonValue(Value, NumEntries, NumStrings, NumChars);
+	NumChars += NumStrings * LengthPrefixChars;
+	if (NumEntries > MAX_int32 || NumChars > MAX_int32)
+	{
+		return nullptr;
+	}
+	
+	TSharedRef<FEasyJsonDocumentV2, ESPMode::ThreadSafe> Document = MakeShared<FEasyJsonDocumentV2, ESPMode::ThreadSafe>();
+	Document->AllocateStorage(static_cast<int32>(NumEntries), static_cast<int32>(NumChars));
+	Document->AppendJsonValue(Value);
+	return Document;
+}
+
+TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> FEasyJsonDocumentV2::ParseLazy(FString&& Json, FString& OutErrorMessage)
+{
+	TUniquePtr<FEasyJsonLazyIndexV2> LazyIndex = FEasyJsonLazyIndexV2::Build(MoveTemp(Json), OutErrorMessage);
+	if (!LazyIndex.IsValid())
+	{
+		return nullptr;
+	}
+	
+	TSharedRef<FEasyJsonDocumentV2, ESPMode::ThreadSafe> Document = MakeShared<FEasyJsonDocumentV2, ESPMode::ThreadSafe>();
+	Document->Lazy = MoveTemp(LazyIndex);
+	return Document;
+}
+
+TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> FEasyJsonDocumentV2::ParseLazy(const TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe>& Source, FString& OutErrorMessage)
+{
+	TUniquePtr<FEasyJsonLazyIndexV2> LazyIndex = FEasyJsonLazyIndexV2::Build(Source, OutErrorMessage);
+	if (!LazyIndex.IsValid())
+	{
+		return nullptr;
+	}
+	
+	TSharedRef<FEasyJsonDocumentV2, ESPMode::ThreadSafe> Document = MakeShared<FEasyJsonDocumentV2, ESPMode::ThreadSafe>();
+	Document->Lazy = MoveTemp(LazyIndex);
+	return Document;
+}
+
+FEasyJsonDocumentV2::~FEasyJsonDocumentV2()
+{
+}
+
+EEasyJsonTapeType FEasyJsonDocumentV2::GetLazyType(int32 Index) const
+{
+	return Lazy->GetType(Index);
+}
+
+int32 FEasyJsonDocumentV2::GetLazyEndIndex(int32 Index) const
+{
+	return Lazy->GetEndIndex(Index);
+}
+
+int32 FEasyJsonDocumentV2::GetNextIndex(int32 Index) const
+{
+	if (IsLazy())
+	{
+		return Lazy->GetNextIndex(Index);
+	}
+	
+	switch (GetType(Index))
+	{
+	case EEasyJsonTapeType::Number:
+		return Index + 2;
+	case EEasyJsonTapeType::Array:
+	case EEasyJsonTapeType::Object:
+		return GetEndIndex(Index);
+	default:
+		return Index + 1;
+	}
+}
+
+double FEasyJsonDocumentV2::GetNumber(int32 Index) const
+{
+	double Number = 0.0;
+	return TryGetNumber(Index, Number) ? Number : 0.0;
+}
+
+bool FEasyJsonDocumentV2::TryGetNumber(int32 Index, double& OutNumber) const
+{
+	if (IsLazy())
+	{
+		const TSharedPtr<FJsonValue> Value = Lazy->ParseValue(Index);
+		return Value.IsValid() && Value->Type == EJson::Number && Value->TryGetNumber(OutNumber);
+	}
+	
+	FMemory::Memcpy(&OutNumber, &Tape[Index + 1], sizeof(double));
+	return true;
+}
+
+FStringView FEasyJsonDocumentV2::GetString(int32 Index) const
+{
+	check(!IsLazy());
+	return GetStringAt(static_cast<int32>(Tape[Index] & 0xFFFFFFFFull));
+}
+
+FString FEasyJsonDocumentV2::GetStringValue(int32 Index) const
+{
+	FString String;
+	return TryGetStringValue(Index, String) ? String : FString();
+}
+
+bool FEasyJsonDocumentV2::TryGetStringValue(int32 Index, FString& OutString) const
+{
+	if (IsLazy())
+	{
+		const TSharedPtr<FJsonValue> Value = Lazy->ParseValue(Index);
+		return Value.IsValid() && Value->Type == EJson::String && Value->TryGetString(OutString);
+	}
+	
+	OutString = FString(GetString(Index));
+	return true;
+}
+
+FStringView FEasyJsonDocumentV2::GetStringAt(int32 Offset) const
+{
+	uint32 Length;
+	FMemory::Memcpy(&Length, &Strings[Offset], sizeof(uint32));
+	return FStringView(Strings + Offset + LengthPrefixChars, static_cast<int32>(Length));
+}
+
+int32 FEasyJsonDocumentV2::GetNum(int32 Index) const
+{
+	if (IsLazy())
+	{
+		return Lazy->GetNum(Index);
+	}
+	
+	const EEasyJsonTapeType Type = GetType(Index);
+	if (Type != EEasyJsonTapeType::Array && Type != EEasyJsonTapeType::Object)
+	{
+		return 0;
+	}
+	
+	const uint32 StoredCount = static_cast<uint32>(GetPayload(Index) >> 32);
+	if (StoredCount < MaxStoredCount)
+	{
+		return static_cast<int32>(StoredCount);
+	}
+	
+	// Saturated count: walk the container
+	int32 Count = 0;
+	const int32 EndIndex = GetEndIndex(Index);
+	for (int32 ChildIndex = GetFirstChildIndex(Index); ChildIndex < EndIndex; ++Count)
+	{
+		if (Type == EEasyJsonTapeType::Object)
+		{
+			// Skip the key
+			++ChildIndex;
+		}
+		ChildIndex = GetNextIndex(ChildIndex);
+	}
+	return Count;
+}
+
+int32 FEasyJsonDocumentV2::FindField(int32 ObjectIndex, FStringView FieldName, uint32 FieldNameHash) const
+{
+	if (IsLazy())
+	{
+		return Lazy->FindField(ObjectIndex, FieldName);
+	}
+	
+	if (GetType(ObjectIndex) != EEasyJsonTapeType::Object)
+	{
+		return INDEX_NONE;
+	}
+	
+	// A key that no object in the document has is rejected without scanning
+	const int32 KeyId = FindKeyId(FieldName, FieldNameHash);
+	if (KeyId == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+	
+	const uint32 StoredKeyId = FMath::Min(static_cast<uint32>(KeyId), MaxStoredKeyId);
+	int32 FoundIndex = INDEX_NONE;
+	const int32 EndIndex = GetEndIndex(ObjectIndex);
+	for (int32 KeyIndex = GetFirstChildIndex(ObjectIndex); KeyIndex < EndIndex; )
+	{
+		const int32 ValueIndex = KeyIndex + 1;
+		if (GetStoredKeyId(KeyIndex) == StoredKeyId && (StoredKeyId != MaxStoredKeyId || GetString(KeyIndex).Equals(FieldName, ESearchCase::IgnoreCase)))
+		{
+			FoundIndex = ValueIndex;
+		}
+		KeyIndex = GetNextIndex(ValueIndex);
+	}
+	return FoundIndex;
+}
+
+int32 FEasyJsonDocumentV2::GetArrayElement(int32 ArrayIndex, int32 ElementIndex) const
+{
+	if (GetType(ArrayIndex) != EEasyJsonTapeType::Array || ElementIndex < 0)
+	{
+		return INDEX_NONE;
+	}
+	
+	const int32 EndIndex = GetEndIndex(ArrayIndex);
+	int32 ChildIndex = GetFirstChildIndex(ArrayIndex);
+	for (int32 Skipped = 0; Skipped < ElementIndex && ChildIndex < EndIndex; ++Skipped)
+	{
+		ChildIndex = GetNextIndex(ChildIndex);
+	}
+	return ChildIndex < EndIndex ? ChildIndex : INDEX_NONE;
+}
+
+TSharedPtr<FJsonValue> FEasyJsonDocumentV2::ToJsonValue(int32 Index) const
+{
+	if (IsLazy())
+	{
+		// Values that fail to parse read as null
+		const TSharedPtr<FJsonValue> Value = Lazy->ParseValue(Index);
+		return Value.IsValid() ? Value : MakeShared<FJsonValueNull>();
+	}
+	
+	switch (GetType(Index))
+	{
+	case EEasyJsonTapeType::True:
+		return MakeShared<FJsonValueBoolean>(true);
+	case EEasyJsonTapeType::False:
+		return MakeShared<FJsonValueBoolean>(false);
+	case EEasyJsonTapeType::Number:
+		return MakeShared<FJsonValueNumber>(GetNumber(Index));
+	case EEasyJsonTapeType::String:
+		return MakeShared<FJsonValueString>(FString(GetString(Index)));
+	case EEasyJsonTapeType::Array:
+	{
+		TArray<TSharedPtr<FJsonValue>> Array;
+		Array.Reserve(GetNum(Index));
+		const int32 EndIndex = GetEndIndex(Index);
+		for (int32 ChildIndex = GetFirstChildIndex(Index); ChildIndex < EndIndex; ChildIndex = GetNextIndex(ChildIndex))
+		{
+			Array.Add(ToJsonValue(ChildIndex));
+		}
+		return MakeShared<FJsonValueArray>(MoveTemp(Array));
+	}
+	case EEasyJsonTapeType::Object:
+		return MakeShared<FJsonValueObject>(ToJsonObject(Index));
+	default:
+		return MakeShared<FJsonValueNull>();
+	}
+}
+
+TSharedPtr<FJsonObject> FEasyJsonDocumentV2::ToJsonObject(int32 Index) const
+{
+	if (GetType(Index) != EEasyJsonTapeType::Object)
+	{
+		return nullptr;
+	}
+	
+	if (IsLazy())
+	{
+		const TSharedPtr<FJsonValue> Value = Lazy->ParseValue(Index);
+		return Value.IsValid() ? Value->AsObject() : nullptr;
+	}
+	
+	TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+	const int32 EndIndex = GetEndIndex(Index);
+	for (int32 KeyIndex = GetFirstChildIndex(Index); KeyIndex < EndIndex; )
+	{
+		const int32 ValueIndex = KeyIndex + 1;
+		
+		// Duplicate keys keep the last value, like FJsonObject::SetField
+		Object->Values.Add(FString(GetString(KeyIndex)), ToJsonValue(ValueIndex));
+		KeyIndex = GetNextIndex(ValueIndex);
+	}
+	return Object;
+}
+
+SIZE_T FEasyJsonDocumentV2::GetAllocatedSize() const
+{
+	return Arena.GetAllocatedSize() + Keys.GetAllocatedSize() + KeyBuckets.GetAllocatedSize() + (IsLazy() ? Lazy->GetAllocatedSize() : 0);
+}
+
+void FEasyJsonDocumentV2::AllocateStorage(int32 MaxEntries, int32 MaxChars)
+{
+	// One block holds both buffers; the tape comes first so the strings need no padding
+	Arena = FEasyJsonArenaV2(static_cast<SIZE_T>(MaxEntries) * sizeof(uint64) + static_cast<SIZE_T>(MaxChars) * sizeof(TCHAR));
+	Tape = Arena.AllocateArray<uint64>(MaxEntries);
+	TapeMax = MaxEntries;
+	Strings = Arena.AllocateArray<TCHAR>(MaxChars);
+	StringsMax = MaxChars;
+}
+
+void FEasyJsonDocumentV2::ShrinkStorage()
+{
+	const SIZE_T UsedBytes = static_cast<SIZE_T>(TapeNum) * sizeof(uint64) + static_cast<SIZE_T>(StringsNum) * sizeof(TCHAR);
+	const SIZE_T ReservedBytes = static_cast<SIZE_T>(TapeMax) * sizeof(uint64) + static_cast<SIZE_T>(StringsMax) * sizeof(TCHAR);
+	if (ReservedBytes - UsedBytes <= FMath::Max(UsedBytes / 2, EasyJsonDocument::MinShrinkBytes))
+	{
+		return;
+	}
+	
+	// Keep the old block alive until the contents are copied
+	const FEasyJsonArenaV2 OldArena = MoveTemp(Arena);
+	const uint64* OldTape = Tape;
+	const TCHAR* OldStrings = Strings;
+	
+	AllocateStorage(TapeNum, StringsNum);
+	FMemory::Memcpy(Tape, OldTape, TapeNum * sizeof(uint64));
+	FMemory::Memcpy(Strings, OldStrings, StringsNum * sizeof(TCHAR));
+}
+
+void FEasyJsonDocumentV2::AppendNumber(double Value)
+{
+	uint64 Bits;
+	FMemory::Memcpy(&Bits, &Value, sizeof(double));
+	AddEntry(MakeEntry(EEasyJsonTapeType::Number, 0));
+	AddEntry(Bits);
+}
+
+void FEasyJsonDocumentV2::AppendString(const TCHAR* Chars, int32 Length)
+{
+	FMemory::Memcpy(AppendUninitializedString(Length), Chars, Length * sizeof(TCHAR));
+}
+
+TCHAR* FEasyJsonDocumentV2::GetNextStringChars(int32 Length) const
+{
+	check(StringsNum + LengthPrefixChars + Length <= StringsMax);
+	return Strings + StringsNum + LengthPrefixChars;
+}
+
+void FEasyJsonDocumentV2::AppendKey(FStringView Key)
+{
+	if (KeyBuckets.Num() == 0)
+	{
+		RehashKeys(64);
+	}
+	
+	const uint32 Hash = GetTypeHash(Key);
+	const int32 Mask = KeyBuckets.Num() - 1;
+	int32 Id = INDEX_NONE;
+	int32 Bucket = static_cast<int32>(Hash) & Mask;
+	for (; KeyBuckets[Bucket] != INDEX_NONE; Bucket = (Bucket + 1) & Mask)
+	{
+		const FKeyRecord& Record = Keys[KeyBuckets[Bucket]];
+		if (Record.Hash != Hash)
+		{
+			continue;
+		}
+		
+		const FStringView Existing = GetStringAt(Record.StringOffset);
+		if (Existing.Equals(Key, ESearchCase::CaseSensitive))
+		{
+			// Known spelling: only the tape entry is added
+			AddEntry(MakeEntry(EEasyJsonTapeType::Key, (static_cast<uint64>(FMath::Min(static_cast<uint32>(Record.Id), MaxStoredKeyId)) << 32) | static_cast<uint64>(Record.StringOffset)));
+			return;
+		}
+		if (Id == INDEX_NONE && Existing.Equals(Key, ESearchCase::IgnoreCase))
+		{
+			Id = Record.Id;
+		}
+	}
+	
+	// New spelling: store its characters (they may already have been written in place)
+	TCHAR* Chars = GetNextStringChars(Key.Len());
+	if (Chars != Key.GetData())
+	{
+		FMemory::Memcpy(Chars, Key.GetData(), Key.Len() * sizeof(TCHAR));
+	}
+	
+	const int32 Offset = StringsNum;
+	const uint32 StoredLength = static_cast<uint32>(Key.Len());
+	FMemory::Memcpy(Strings + Offset, &StoredLength, sizeof(uint32));
+	StringsNum += LengthPrefixChars + Key.Len();
+	
+	if (Id == INDEX_NONE)
+	{
+		Id = NumKeyIds++;
+	}
+	KeyBuckets[Bucket] = Keys.Add({ Offset, Hash, Id });
+	AddEntry(MakeEntry(EEasyJsonTapeType::Key, (static_cast<uint64>(FMath::Min(static_cast<uint32>(Id), MaxStoredKeyId)) << 32) | static_cast<uint64>(Offset)));
+	
+	// Keep the table at most half full
+	if (Keys.Num() * 2 > KeyBuckets.Num())
+	{
+		RehashKeys(KeyBuckets.Num() * 2);
+	}
+}
+
+int32 FEasyJsonDocumentV2::FindKeyId(FStringView Key, uint32 KeyHash) const
+{
+	if (KeyBuckets.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+	
+	const int32 Mask = KeyBuckets.Num() - 1;
+	for (int32 Bucket = static_cast<int32>(KeyHash) & Mask; KeyBuckets[Bucket] != INDEX_NONE; Bucket = (Bucket + 1) & Mask)
+	{
+		const FKeyRecord& Record = Keys[KeyBuckets[Bucket]];
+		if (Record.Hash == KeyHash && GetStringAt(Record.StringOffset).Equals(Key, ESearchCase::IgnoreCase))
+		{
+			return Record.Id;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void FEasyJsonDocumentV2::RehashKeys(int32 NumBuckets)
+{
+	KeyBuckets.Init(INDEX_NONE, NumBuckets);
+	const int32 Mask = NumBuckets - 1;
+	for (int32 KeyIndex = 0; KeyIndex < Keys.Num(); ++KeyIndex)
+	{
+		int32 Bucket = static_cast<int32>(Keys[KeyIndex].Hash) & Mask;
+		while (KeyBuckets[Bucket] != INDEX_NONE)
+		{
+			Bucket = (Bucket + 1) & Mask;
+		}
+		KeyBuckets[Bucket] = KeyIndex;
+	}
+}
+
+TCHAR* FEasyJsonDocumentV2::AppendUninitializedString(int32 Length)
+{
+	check(StringsNum + LengthPrefixChars + Length <= StringsMax);
+	
+	const int32 Offset = StringsNum;
+	const uint32 StoredLength = static_cast<uint32>(Length);
+	FMemory::Memcpy(Strings + Offset, &StoredLength, sizeof(uint32));
+	StringsNum += LengthPrefixChars + Length;
+	AddEntry(MakeEntry(EEasyJsonTapeType::String, static_cast<uint64>(Offset)));
+	return Strings + Offset + LengthPrefixChars;
+}
+
+void FEasyJsonDocumentV2::AppendJsonValue(const TSharedPtr<FJsonValue>& Value)
+{
+	switch (Value.IsValid() ? Value->Type : EJson::Null)
+	{
+	case EJson::Boolean:
+		AddEntry(MakeEntry(Value->AsBool() ? EEasyJsonTapeType::True : EEasyJsonTapeType::False, 0));
+		break;
+	case EJson::Number:
+		AppendNumber(Value->AsNumber());
+		break;
+	case EJson::String:
+	{
+		const FString String = Value->AsString();
+		AppendString(*String, String.Len());
+		break;
+	}
+	case EJson::Array:
+	{
+		const int32 StartIndex = TapeNum;
+		AddEntry(MakeEntry(EEasyJsonTapeType::Array, 0));
+		const TArray<TSharedPtr<FJsonValue>>& Array = Value->AsArray();
+		for (const TSharedPtr<FJsonValue>& Element : Array)
+		{
+			AppendJsonValue(Element);
+		}
+		CloseContainer(StartIndex, Array.Num());
+		break;
+	}
+	case EJson::Object:
+	{
+		const int32 StartIndex = TapeNum;
+		AddEntry(MakeEntry(EEasyJsonTapeType::Object, 0));
+		const TSharedPtr<FJsonObject> Object = Value->AsObject();
+		if (Object.IsValid())
+		{
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Object->Values)
+			{
+				AppendKey(Pair.Key);
+				AppendJsonValue(Pair.Value);
+			}
+		}
+		CloseContainer(StartIndex, Object.IsValid() ? Object->Values.Num() : 0);
+		break;
+	}
+	default:
+		AddEntry(MakeEntry(EEasyJsonTapeType::Null, 0));
+		break;
+	}
+}
+
+void FEasyJsonDocumentV2::CloseContainer(int32 Index, int32 Count)
+{
+	const uint64 StoredCount = FMath::Min(static_cast<uint32>(Count), MaxStoredCount);
+	Tape[Index] = MakeEntry(GetType(Index), (StoredCount << 32) | static_cast<uint64>(TapeNum));
+}
@@ -0,0 +1,566 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonFastParserV2.h"
+#include "EasyJsonStructuralIndexV2.h"
+#include "EasyJsonStructuralParserV2.h"
+#include "EasyJsonSourceValuesV2.h"
+#include "EasyJsonParserV2Debug.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Containers/StringConv.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/App.h"
+#include <atomic>
+
+namespace EasyJsonFastParser
+{
+	std::atomic<uint8> MaxSimdLevel(static_cast<uint8>(EEasyJsonSimdLevel::AVX2));
+	std::atomic<int32> ParallelThreshold(FEasyJsonFastParserV2::DefaultParallelThreshold);
+	
+	EEasyJsonSimdLevel GetDetectedSimdLevel()
+	{
+		static const EEasyJsonSimdLevel DetectedLevel = FEasyJsonStructuralIndexV2::DetectSimdLevel();
+		return DetectedLevel;
+	}
+	
+	FORCEINLINE FString ToFString(FStringView View)
+	{
+		return FString(View);
+	}
+	
+	FORCEINLINE FString ToFString(FUtf8StringView View)
+	{
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(View.GetData()), View.Len());
+		return FString(Converted.Length(), Converted.Get());
+	}
+	
+	using FSourceRef = TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe>;
+	using FSourcePtr = TSharedPtr<FEasyJsonSourceV2, ESPMode::ThreadSafe>;
+	
+	/**
+	 * How a large document is split for parallel parsing.
+	 * Large arrays are cut into chunks of consecutive elements that worker threads parse on
+	 * their own; the main pass steps over those arrays and stitches the chunks back in.
+	 */
+	struct FParallelPlan
+	{
+		// A run of elements parsed by one task
+		struct FChunk
+		{
+			// Index entry of the first element and of the separator after the last one
+			int32 Begin;
+			int32 End;
+			
+			// Nesting depth of the array
+			int32 Depth;
+		};
+		
+		// Split arrays in input order
+		TArray<FEasyJsonSkippedRangeV2> Ranges;
+		
+		// First chunk of each range (plus one past the last chunk)
+		TArray<int32> RangeChunks;
+		
+		TArray<FChunk> Chunks;
+		
+		// Elements parsed from each chunk
+		TArray<TArray<TSharedPtr<FJsonValue>>> ChunkValues;
+	};
+	
+	/**
+	 * Stage 2 handler that builds the engine's FJsonValue tree.
+	 * With a source, unescaped strings and numbers become views into the source bytes.
+	 */
+	template <typename CharType>
+	class TDomBuilder
+	{
+	public:
+		TDomBuilder() = default;
+		explicit TDomBuilder(const FSourcePtr& InSource) : Source(InSource) {}
+		
+		bool OnBeginObject()
+		{
+			FFrame& Frame = Stack.AddDefaulted_GetRef();
+			Frame.Object = MakeShared<FJsonObject>();
+			return true;
+		}
+		
+		bool OnEndObject()
+		{
+			FFrame Frame = Stack.Pop();
+			AddValue(MakeShared<FJsonValueObject>(Frame.Object));
+			return true;
+		}
+		
+		bool OnBeginArray()
+		{
+			Stack.AddDefaulted();
+			return true;
+		}
+		
+		bool OnEndArray()
+		{
+			FFrame Frame = Stack.Pop();
+			AddValue(MakeShared<FJsonValueArray>(MoveTemp(Frame.Array)));
+			return true;
+		}
+		
+		bool OnKey(TStringView<CharType> Key)
+		{
+			Stack.Last().Key = ToFString(Key);
+			return true;
+		}
+		
+		bool OnString(TStringView<CharType> Value)
+		{
+			if constexpr (sizeof(CharType) == 1)
+			{
+				// Escaped strings were decoded into scratch memory and must be copied
+				if (Source.IsValid() && Source->Contains(Value.GetData(), Value.Len()))
+				{
+					AddValue(MakeShared<FEasyJsonSourceStringValue>(Source.ToSharedRef(), Value));
+					return true;
+				}
+			}
+			
+			AddValue(MakeShared<FJsonValueString>(ToFString(Value)));
+			return true;
+		}
+		
+		bool OnNumber(double Value, TStringView<CharType> Text)
+		{
+			if constexpr (sizeof(CharType) == 1)
+			{
+				if (Source.IsValid() && Text.Len() < 128)
+				{
+					AddValue(MakeShared<FEasyJsonSourceNumberValue>(Source.ToSharedRef(), Text));
+					return true;
+				}
+			}
+			
+			AddValue(MakeShared<FJsonValueNumber>(Value));
+			return true;
+		}
+		
+		bool OnBool(bool Value)
+		{
+			AddValue(MakeShared<FJsonValueBoolean>(Value));
+			return true;
+		}
+		
+		bool OnNull()
+		{
+			AddValue(MakeShared<FJsonValueNull>());
+			return true;
+		}
+		
+		// Stitch in the elements the workers parsed for a split array
+		bool OnSkippedRange(int32 RangeIndex)
+		{
+			check(Plan != nullptr);
+			
+			const int32 FirstChunk = Plan->RangeChunks[RangeIndex];
+			const int32 LastChunk = Plan->RangeChunks[RangeIndex + 1];
+			
+			int32 NumElements = 0;
+			for (int32 ChunkIndex = FirstChunk; ChunkIndex < LastChunk; ++ChunkIndex)
+			{
+				NumElements += Plan->ChunkValues[ChunkIndex].Num();
+			}
+			
+			TArray<TSharedPtr<FJsonValue>> Elements;
+			Elements.Reserve(NumElements);
+			for (int32 ChunkIndex = FirstChunk; ChunkIndex < LastChunk; ++ChunkIndex)
+			{
+				Elements.Append(MoveTemp(Plan->ChunkValues[ChunkIndex]));
+			}
+			AddValue(MakeShared<FJsonValueArray>(MoveTemp(Elements)));
+			return true;
+		}
+		
+		FORCEINLINE void SetParallelPlan(FParallelPlan* InPlan) { Plan = InPlan; }
+		
+		// Elements collected by a builder that was started with OnBeginArray for a chunk
+		FORCEINLINE TArray<TSharedPtr<FJsonValue>> TakeElements() { return MoveTemp(Stack.Last().Array); }
+		
+		FORCEINLINE const TSharedPtr<FJsonValue>& GetRoot() const { return Root; }
+		FORCEINLINE const FSourcePtr& GetSource() const { return Source; }
+	
+	private:
+		// Container being filled (Object is null for arrays)
+		struct FFrame
+		{
+			TSharedPtr<FJsonObject> Object;
+			TArray<TSharedPtr<FJsonValue>> Array;
+			FString Key;
+		};
+		
+		void AddValue(TSharedPtr<FJsonValue>&& Value)
+		{
+			if (Stack.Num() == 0)
+			{
+				Root = MoveTemp(Value);
+				return;
+			}
+			
+			FFrame& Top = Stack.Last();
+			if (Top.Object.IsValid())
+			{
+				// Duplicate keys keep the last value, like FJsonObject::SetField
+				Top.Object->Values.Add(MoveTemp(Top.Key), MoveTemp(Value));
+			}
+			else
+			{
+				Top.Array.Add(MoveTemp(Value));
+			}
+		}
+		
+		TArray<FFrame> Stack;
+		TSharedPtr<FJsonValue> Root;
+		FSourcePtr Source;
+		FParallelPlan* Plan = nullptr;
+	};
+	
+	/**
+	 * Find the arrays worth parsing in parallel and cut them into chunks.
+	 * Only documents above the parallel threshold are split. Starting at the root, an array
+	 * that covers at least an eighth of the index and has several elements is split; objects
+	 * and single-element arrays are searched for such arrays one level further down.
+	 * @return false if the document should be parsed sequentially (including malformed input,
+	 *         which the sequential pass reports)
+	 */
+	template <typename CharType>
+	bool PlanParallelParse(const CharType* Json, const FEasyJsonStructuralIndexV2& Index, FParallelPlan& OutPlan)
+	{
+		const int32 NumPositions = Index.Num();
+		if (NumPositions < FMath::Max(ParallelThreshold.load(std::memory_order_relaxed), 2) || !FApp::ShouldUseThreadingForPerformance())
+		{
+			return false;
+		}
+		
+		auto CharAt = [Json, &Index](int32 Position) { return Json[Index[Position]]; };
+		
+		// Matching bracket of every opening bracket
+		TArray<int32> Matches;
+		Matches.SetNumUninitialized(NumPositions);
+		{
+			TArray<int32, TInlineAllocator<64>> Stack;
+			for (int32 Position = 0; Position < NumPositions; ++Position)
+			{
+				const CharType Char = CharAt(Position);
+				if (Char == '{' || Char == '[')
+				{
+					if (Stack.Num() >= FEasyJsonFastParserV2::MaxDepth)
+					{
+						return false;
+					}
+					Stack.Add(Position);
+				}
+				else if (Char == '}' || Char == ']')
+				{
+					if (Stack.Num() == 0 || CharAt(Stack.Last()) != (Char == '}' ? '{' : '['))
+					{
+						return false;
+					}
+					Matches[Stack.Pop()] = Position;
+				}
+			}
+			if (Stack.Num() > 0)
+			{
+				return false;
+			}
+		}
+		
+		auto IsOpen = [&CharAt](int32 Position) { const CharType Char = CharAt(Position); return Char == '{' || Char == '['; };
+		auto ValueEnd = [&Matches, &IsOpen](int32 Position) { return (IsOpen(Position) ? Matches[Position] : Position) + 1; };
+		
+		// Pick the arrays to split (opening bracket and depth)
+		const int32 MinSplitSpan = NumPositions / 8;
+		TArray<FIntPoint> SplitArrays;
+		TArray<FIntPoint, TInlineAllocator<16>> Pending;
+		if (IsOpen(0))
+		{
+			Pending.Add(FIntPoint(0, 1));
+		}
+		while (Pending.Num() > 0)
+		{
+			const FIntPoint Container = Pending.Pop();
+			const int32 Open = Container.X;
+			const int32 Close = Matches[Open];
+			if (Close - Open < MinSplitSpan)
+			{
+				continue;
+			}
+			
+			if (CharAt(Open) == '[')
+			{
+				const int32 First = Open + 1;
+				if (ValueEnd(First) < Close)
+				{
+					SplitArrays.Add(Container);
+				}
+				else if (IsOpen(First))
+				{
+					Pending.Add(FIntPoint(First, Container.Y + 1));
+				}
+				continue;
+			}
+			
+			// Member values of an object ("key" : value ,)
+			for (int32 Member = Open + 1; Member + 2 < Close; Member = ValueEnd(Member + 2) + 1)
+			{
+				if (IsOpen(Member + 2))
+				{
+					Pending.Add(FIntPoint(Member + 2, Container.Y + 1));
+				}
+			}
+		}
+		
+		if (SplitArrays.Num() == 0)
+		{
+			return false;
+		}
+		SplitArrays.Sort([](const FIntPoint& A, const FIntPoint& B) { return A.X < B.X; });
+		
+		// Roughly four chunks per thread across the whole document
+		const int32 NumThreads = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+		const int32 ChunkSpan = FMath::Max(NumPositions / (NumThreads * 4), 1);
+		
+		for (const FIntPoint& Array : SplitArrays)
+		{
+			const int32 Open = Array.X;
+			const int32 Close = Matches[Open];
+			
+			OutPlan.Ranges.Add({Open, Close});
+			OutPlan.RangeChunks.Add(OutPlan.Chunks.Num());
+			
+			int32 ChunkBegin = Open + 1;
+			for (int32 Element = Open + 1; ; )
+			{
+				const int32 Separator = ValueEnd(Element);
+				if (Separator > Close || (Separator < Close && CharAt(Separator) != ','))
+				{
+					return false;
+				}
+				
+				if (Separator == Close || Separator - ChunkBegin >= ChunkSpan)
+				{
+					OutPlan.Chunks.Add({ChunkBegin, Separator, Array.Y});
+					ChunkBegin = Separator + 1;
+				}
+				
+				if (Separator == Close)
+				{
+					break;
+				}
+				Element = Separator + 1;
+			}
+		}
+		OutPlan.RangeChunks.Add(OutPlan.Chunks.Num());
+		
+		return OutPlan.Chunks.Num() > 1;
+	}
+	
+	// Parse every chunk of the plan on worker threads
+	template <typename CharType>
+	bool ParseChunks(TStringView<CharType> Json, const FEasyJsonStructuralIndexV2& Index, const FSourcePtr& Source, FParallelPlan& Plan)
+	{
+		Plan.ChunkValues.SetNum(Plan.Chunks.Num());
+		
+		std::atomic<bool> bFailed(false);
+		ParallelFor(Plan.Chunks.Num(), [&](int32 ChunkIndex)
+		{
+			if (bFailed.load(std::memory_order_relaxed))
+			{
+				return;
+			}
+			
+			const FParallelPlan::FChunk& Chunk = Plan.Chunks[ChunkIndex];
+			TDomBuilder<CharType> ChunkBuilder(Source);
+			ChunkBuilder.OnBeginArray();
+			
+			TEasyJsonStructuralParserV2<CharType, TDomBuilder<CharType>> Parser(Json.GetData(), Json.Len(), Index, ChunkBuilder);
+			if (!Parser.ParseElements(Chunk.Begin, Chunk.End, Chunk.Depth))
+			{
+				bFailed.store(true, std::memory_order_relaxed);
+				return;
+			}
+			Plan.ChunkValues[ChunkIndex] = ChunkBuilder.TakeElements();
+		});
+		
+		return !bFailed.load();
+	}
+	
+	template <typename CharType>
+	bool ParseValue(TStringView<CharType> Json, TDomBuilder<CharType>& Builder, TSharedPtr<FJsonValue>& OutValue, FString& OutErrorMessage)
+	{
+		OutValue.Reset();
+		
+		if (Json.IsEmpty())
+		{
+			OutErrorMessage = TEXT("Empty JSON string");
+			return false;
+		}
+		
+		FEasyJsonStructuralIndexV2 Index;
+		if (!Index.Build(Json.GetData(), Json.Len(), FEasyJsonFastParserV2::GetSimdLevel()))
+		{
+			OutErrorMessage = TEXT("Unterminated string");
+			return false;
+		}
+		
+		TEasyJsonStructuralParserV2<CharType, TDomBuilder<CharType>> Parser(Json.GetData(), Json.Len(), Index, Builder);
+		
+		// Large arrays are parsed on worker threads first; if any chunk fails, the sequential
+		// pass below runs over the whole input so the error is the one it would always report
+		FParallelPlan Plan;
+		if (PlanParallelParse(Json.GetData(), Index, Plan) && ParseChunks(Json, Index, Builder.GetSource(), Plan))
+		{
+			Builder.SetParallelPlan(&Plan);
+			Parser.SetSkippedRanges(Plan.Ranges);
+		}
+		
+		if (!Parser.Parse())
+		{
+			OutErrorMessage = Parser.GetErrorMessage();
+			return false;
+		}
+		
+		OutValue = Builder.GetRoot();
+		return true;
+	}
+	
+	template <typename CharType>
+	bool ParseValue(TStringView<CharType> Json, TSharedPtr<FJsonValue>& OutValue, FString& OutErrorMessage)
+	{
+		TDomBuilder<CharType> Builder;
+		return ParseValue(Json, Builder, OutValue, OutErrorMessage);
+	}
+	
+	// Source bytes without the UTF-8 byte order mark
+	FUtf8StringView GetSourceText(const FSourceRef& Source)
+	{
+		TArrayView<const uint8> Bytes = Source->GetBytes();
+		if (Bytes.Num() >= 3 && Bytes[0] == 0xEF && Bytes[1] == 0xBB && Bytes[2] == 0xBF)
+		{
+			Bytes = Bytes.Slice(3, Bytes.Num() - 3);
+		}
+		return FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Bytes.GetData()), Bytes.Num());
+	}
+	
+	template <typename CharType>
+	bool ParseObject(TStringView<CharType> Json, TSharedPtr<FJsonObject>& OutObject, FString& OutErrorMessage)
+	{
+		OutObject.Reset();
+		
+		TSharedPtr<FJsonValue> Value;
+		if (!ParseValue(Json, Value, OutErrorMessage))
+		{
+			return false;
+		}
+		
+		if (Value->Type != EJson::Object)
+		{
+			OutErrorMessage = TEXT("Root value is not an object");
+			return false;
+		}
+		
+		OutObject = Value->AsObject();
+		return true;
+	}
+}
+
+bool FEasyJsonFastParserV2::ParseValue(FStringView Json, TSharedPtr<FJsonValue>& OutValue, FString& OutErrorMessage)
+{
+	return EasyJsonFastParser::ParseValue(Json, OutValue, OutErrorMessage);
+}
+
+bool FEasyJsonFastParserV2::ParseValue(FUtf8StringView Json, TSharedPtr<FJsonValue>& OutValue, FString& OutErrorMessage)
+{
+	return EasyJsonFastParser::ParseValue(Json, OutValue, OutErrorMessage);
+}
+
+bool FEasyJsonFastParserV2::ParseValue(const TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe>& Source, TSharedPtr<FJsonValue>& OutValue, FString& OutErrorMessage)
+{
+	EasyJsonFastParser::TDomBuilder<UTF8CHAR> Builder(Source);
+	return EasyJsonFastParser::ParseValue(EasyJsonFastParser::GetSourceText(Source), Builder, OutValue, OutErrorMessage);
+}
+
+bool FEasyJsonFastParserV2::ParseObject(FStringView Json, TSharedPtr<FJsonObject>& OutObject, FString& OutErrorMessage)
+{
+	return EasyJsonFastParser::ParseObject(Json, OutObject, OutErrorMessage);
+}
+
+bool FEasyJsonFastParserV2::ParseObject(FUtf8StringView Json, TSharedPtr<FJsonObject>& OutObject, FString& OutErrorMessage)
+{
+	return EasyJsonFastParser::ParseObject(Json, OutObject, OutErrorMessage);
+}
+
+bool FEasyJsonFastParserV2::ParseObjectWithFallback(const FString& Json, TSharedPtr<FJsonObject>& OutObject)
+{
+	FString ErrorMessage;
+	if (ParseObject(Json, OutObject, ErrorMessage))
+	{
+		return true;
+	}
+	
+	EASYJSON_DEBUG_LOG(TEXT("FastParse"), TEXT("Fallback"), ErrorMessage);
+	
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+	return FJsonSerializer::Deserialize(Reader, OutObject) && OutObject.IsValid();
+}
+
+bool FEasyJsonFastParserV2::ParseObjectWithFallback(FUtf8StringView Json, TSharedPtr<FJsonObject>& OutObject)
+{
+	FString ErrorMessage;
+	if (ParseObject(Json, OutObject, ErrorMessage))
+	{
+		return true;
+	}
+	
+	EASYJSON_DEBUG_LOG(TEXT("FastParse"), TEXT("Fallback"), ErrorMessage);
+	
+	// The engine reader needs TCHAR input, so only the fallback pays for widening
+	return ParseObjectWithFallback(EasyJsonFastParser::ToFString(Json), OutObject);
+}
+
+bool FEasyJsonFastParserV2::ParseObjectWithFallback(const TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe>& Source, TSharedPtr<FJsonObject>& OutObject)
+{
+	OutObject.Reset();
+	
+	TSharedPtr<FJsonValue> Value;
+	FString ErrorMessage;
+	if (ParseValue(Source, Value, ErrorMessage))
+	{
+		if (Value->Type == EJson::Object)
+		{
+			OutObject = Value->AsObject();
+			return true;
+		}
+		ErrorMessage = TEXT("Root value is not an object");
+	}
+	
+	EASYJSON_DEBUG_LOG(TEXT("FastParse"), TEXT("Fallback"), ErrorMessage);
+	
+	// The fallback copies every value, so nothing refers to the source afterwards
+	return ParseObjectWithFallback(EasyJsonFastParser::ToFString(EasyJsonFastParser::GetSourceText(Source)), OutObject);
+}
+
+EEasyJsonSimdLevel FEasyJsonFastParserV2::GetSimdLevel()
+{
+	using namespace EasyJsonFastParser;
+	
+	const uint8 Detected = static_cast<uint8>(GetDetectedSimdLevel());
+	return static_cast<EEasyJsonSimdLevel>(FMath::Min(Detected, MaxSimdLevel.load(std::memory_order_relaxed)));
+}
+
+void FEasyJsonFastParserV2::SetMaxSimdLevel(EEasyJsonSimdLevel MaxLevel)
+{
+	EasyJsonFastParser::MaxSimdLevel.store(static_cast<uint8>(MaxLevel), std::memory_order_relaxed);
+}
+
+void FEasyJsonFastParserV2::SetParallelThreshold(int32 MinIndexEntries)
+{
+	EasyJsonFastParser::ParallelThreshold.store(MinIndexEntries, std::memory_order_relaxed);
+}
@@ -0,0 +1,205 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonFileWatcherV2.h"
+#include "EasyJsonParseManagerV2.h"
+#include "EasyJsonParserV2Debug.h"
+#include "Async/Async.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeRWLock.h"
+
+TSharedRef<FEasyJsonFileWatcherV2, ESPMode::ThreadSafe> FEasyJsonFileWatcherV2::Create(float PollInterval)
+{
+	return MakeShareable(new FEasyJsonFileWatcherV2(PollInterval));
+}
+
+FEasyJsonFileWatcherV2::FEasyJsonFileWatcherV2(float InPollInterval)
+	: PollInterval(InPollInterval)
+	, bCheckInFlight(false)
+{
+}
+
+FEasyJsonFileWatcherV2::~FEasyJsonFileWatcherV2()
+{
+	Stop();
+}
+
+bool FEasyJsonFileWatcherV2::Watch(const FString& FilePath, FString& ErrorMessage)
+{
+	const FString Key = MakeKey(FilePath);
+	
+	FWatchedFile File;
+	const FFileStatData StatData = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*Key);
+	bool bSuccess = false;
+	File.Snapshot = UEasyJsonParseManagerV2::LoadDocumentFromFile(Key, true, bSuccess, ErrorMessage);
+	if (!bSuccess)
+	{
+		return false;
+	}
+	File.FileSize = StatData.FileSize;
+	File.ModificationTime = StatData.ModificationTime;
+	
+	FWriteScopeLock ScopeLock(Lock);
+	Files.Add(Key, MoveTemp(File));
+	return true;
+}
+
+void FEasyJsonFileWatcherV2::Unwatch(const FString& FilePath)
+{
+	const FString Key = MakeKey(FilePath);
+	
+	FWriteScopeLock ScopeLock(Lock);
+	Files.Remove(Key);
+}
+
+FEasyJsonObjectV2 FEasyJsonFileWatcherV2::GetSnapshot(const FString& FilePath, int32* OutVersion) const
+{
+	const FString Key = MakeKey(FilePath);
+	
+	FReadScopeLock ScopeLock(Lock);
+	const FWatchedFile* File = Files.Find(Key);
+	if (OutVersion != nullptr)
+	{
+		*OutVersion = File != nullptr ? File->Version : INDEX_NONE;
+	}
+	return File != nullptr ? File->Snapshot : FEasyJsonObjectV2();
+}
+
+FString FEasyJsonFileWatcherV2::GetLastError(const FString& FilePath) const
+{
+	const FString Key = MakeKey(FilePath);
+	
+	FReadScopeLock ScopeLock(Lock);
+	const FWatchedFile* File = Files.Find(Key);
+	return File != nullptr ? File->LastError : FString();
+}
+
+void FEasyJsonFileWatcherV2::Start()
+{
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FEasyJsonFileWatcherV2::Tick), PollInterval);
+	}
+}
+
+void FEasyJsonFileWatcherV2::Stop()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+}
+
+TArray<FString> FEasyJsonFileWatcherV2::CheckForChanges()
+{
+	struct FKnownState
+	{
+		FString Key;
+		int64 FileSize;
+		FDateTime ModificationTime;
+	};
+	
+	TArray<FKnownState> KnownStates;
+	{
+		FReadScopeLock ScopeLock(Lock);
+		KnownStates.Reserve(Files.Num());
+		for (const TPair<FString, FWatchedFile>& Pair : Files)
+		{
+			KnownStates.Add({Pair.Key, Pair.Value.FileSize, Pair.Value.ModificationTime});
+		}
+	}
+	
+	TArray<FString> Reloaded;
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	for (const FKnownState& Known : KnownStates)
+	{
+		const FFileStatData StatData = PlatformFile.GetStatData(*Known.Key);
+		if (!StatData.bIsValid || (StatData.FileSize == Known.FileSize && StatData.ModificationTime == Known.ModificationTime))
+		{
+			// Unchanged, or missing for the moment (e.g. while an editor replaces it)
+			continue;
+		}
+		
+		// Parse without holding the lock; readers keep getting the previous snapshot meanwhile
+		bool bSuccess = false;
+		FString ErrorMessage;
+		FEasyJsonObjectV2 Snapshot = UEasyJsonParseManagerV2::LoadDocumentFromFile(Known.Key, true, bSuccess, ErrorMessage);
+		
+		FWriteScopeLock ScopeLock(Lock);
+		FWatchedFile* File = Files.Find(Known.Key);
+		if (File == nullptr)
+		{
+			// Unwatched during the parse
+			continue;
+		}
+		
+		// A file that fails to parse (e.g. saved half-written) keeps its snapshot and is retried once it changes again
+		File->FileSize = StatData.FileSize;
+		File->ModificationTime = StatData.ModificationTime;
+		if (!bSuccess)
+		{
+			File->LastError = ErrorMessage;
+			EASYJSON_DEBUG_LOG(TEXT("FileWatcher"), TEXT("ReloadFailed"), FString::Printf(TEXT("%s: %s"), *Known.Key, *ErrorMessage));
+			continue;
+		}
+		
+		File->Snapshot = MoveTemp(Snapshot);
+		File->LastError.Empty();
+		++File->Version;
+		Reloaded.Add(Known.Key);
+	}
+	
+	return Reloaded;
+}
+
+bool FEasyJsonFileWatcherV2::Tick(float DeltaTime)
+{
+	if (bCheckInFlight.exchange(true))
+	{
+		return true;
+	}
+	
+	TWeakPtr<FEasyJsonFileWatcherV2, ESPMode::ThreadSafe> WeakThis = AsShared();
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [WeakThis]()
+	{
+		TSharedPtr<FEasyJsonFileWatcherV2, ESPMode::ThreadSafe> Watcher = WeakThis.Pin();
+		if (!Watcher.IsValid())
+		{
+			return;
+		}
+		
+		TArray<FString> Reloaded = Watcher->CheckForChanges();
+		Watcher->bCheckInFlight = false;
+		
+		if (Reloaded.Num() > 0)
+		{
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, Reloaded = MoveTemp(Reloaded)]()
+			{
+				TSharedPtr<FEasyJsonFileWatcherV2, ESPMode::ThreadSafe> Watcher = WeakThis.Pin();
+				if (!Watcher.IsValid())
+				{
+					return;
+				}
+				
+				for (const FString& FilePath : Reloaded)
+				{
+					const FEasyJsonObjectV2 Snapshot = Watcher->GetSnapshot(FilePath);
+					if (Snapshot.IsValid())
+					{
+						Watcher->FileReloadedEvent.Broadcast(FilePath, Snapshot);
+					}
+				}
+			});
+		}
+	});
+	
+	return true;
+}
+
+FString FEasyJsonFileWatcherV2::MakeKey(const FString& FilePath)
+{
+	FString Key = FPaths::ConvertRelativePathToFull(FilePath);
+	FPaths::NormalizeFilename(Key);
+	return Key;
+}
@@ -0,0 +1,334 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonLazyIndexV2.h"
+#include "EasyJsonFastParserV2.h"
+#include "EasyJsonStructuralIndexV2.h"
+
+namespace EasyJsonLazyIndex
+{
+	template <typename CharType>
+	class TLazyIndex : public FEasyJsonLazyIndexV2
+	{
+	public:
+		/**
+		 * Build the structural index and match every bracket
+		 * @param InJson The JSON text (must stay valid as long as the index)
+		 * @param InLength Number of characters in InJson
+		 * @param OutErrorMessage Receives the reason on failure
+		 * @return false if the text does not hold exactly one well-bracketed value
+		 */
+		bool Build(const CharType* InJson, int32 InLength, FString& OutErrorMessage)
+		{
+			Json = InJson;
+			Length = InLength;
+			
+			if (!Index.Build(Json, Length, FEasyJsonFastParserV2::GetSimdLevel()))
+			{
+				OutErrorMessage = Length == 0 ? TEXT("Empty JSON string") : TEXT("Unterminated string");
+				return false;
+			}
+			
+			const int32 NumPositions = Index.Num();
+			if (NumPositions == 0)
+			{
+				OutErrorMessage = TEXT("Empty JSON document");
+				return false;
+			}
+			
+			// Only opening brackets get an entry; the rest of the table is left unset
+			Matches.SetNumUninitialized(NumPositions);
+			TArray<int32, TInlineAllocator<64>> Stack;
+			for (int32 Position = 0; Position < NumPositions; ++Position)
+			{
+				const CharType Char = CharAt(Position);
+				if (Char == '{' || Char == '[')
+				{
+					if (Stack.Num() >= FEasyJsonFastParserV2::MaxDepth)
+					{
+						OutErrorMessage = FString::Printf(TEXT("Nesting deeper than %d at %u"), FEasyJsonFastParserV2::MaxDepth, Index[Position]);
+						return false;
+					}
+					Stack.Add(Position);
+				}
+				else if (Char == '}' || Char == ']')
+				{
+					if (Stack.Num() == 0 || CharAt(Stack.Last()) != (Char == '}' ? '{' : '['))
+					{
+						OutErrorMessage = FString::Printf(TEXT("Mismatched bracket at %u"), Index[Position]);
+						return false;
+					}
+					Matches[Stack.Pop()] = Position;
+				}
+			}
+			
+			if (Stack.Num() > 0)
+			{
+				OutErrorMessage = TEXT("Unexpected end of input");
+				return false;
+			}
+			
+			// The root value must span the whole index
+			const int32 RootEnd = (IsOpen(0) ? Matches[0] : 0) + 1;
+			if (RootEnd != NumPositions)
+			{
+				OutErrorMessage = FString::Printf(TEXT("Unexpected data after the root value at %u"), Index[RootEnd]);
+				return false;
+			}
+			
+			return true;
+		}
+		
+		virtual EEasyJsonTapeType GetType(int32 Position) const override
+		{
+			switch (CharAt(Position))
+			{
+			case '{':
+				return EEasyJsonTapeType::Object;
+			case '[':
+				return EEasyJsonTapeType::Array;
+			case '"':
+				return EEasyJsonTapeType::String;
+			case 't':
+				return IsLiteral(Position, "true") ? EEasyJsonTapeType::True : EEasyJsonTapeType::Number;
+			case 'f':
+				return IsLiteral(Position, "false") ? EEasyJsonTapeType::False : EEasyJsonTapeType::Number;
+			case 'n':
+				return IsLiteral(Position, "null") ? EEasyJsonTapeType::Null : EEasyJsonTapeType::Number;
+			default:
+				// Anything else is read as a number, which fails to parse (and reads as missing) if it is not one
+				return EEasyJsonTapeType::Number;
+			}
+		}
+		
+		virtual int32 GetNextIndex(int32 Position) const override
+		{
+			// Skip the container, then the separator after the value
+			int32 Next = (IsOpen(Position) ? Matches[Position] : Position) + 1;
+			if (Next < Index.Num() && CharAt(Next) == ',')
+			{
+				++Next;
+			}
+			return Next;
+		}
+		
+		virtual int32 GetEndIndex(int32 Position) const override
+		{
+			return IsOpen(Position) ? Matches[Position] : Position + 1;
+		}
+		
+		virtual int32 GetNum(int32 Position) const override
+		{
+			const EEasyJsonTapeType Type = GetType(Position);
+			if (Type != EEasyJsonTapeType::Array && Type != EEasyJsonTapeType::Object)
+			{
+				return 0;
+			}
+			
+			int32 Count = 0;
+			const int32 EndIndex = Matches[Position];
+			for (int32 Child = Position + 1; Child < EndIndex; ++Count)
+			{
+				if (Type == EEasyJsonTapeType::Object)
+				{
+					if (!IsMember(Child, EndIndex))
+					{
+						break;
+					}
+					
+					// Skip the key and the colon
+					Child += 2;
+				}
+				Child = GetNextIndex(Child);
+			}
+			return Count;
+		}
+		
+		virtual int32 FindField(int32 ObjectIndex, FStringView FieldName) const override
+		{
+			if (CharAt(ObjectIndex) != '{')
+			{
+				return INDEX_NONE;
+			}
+			
+			// The last duplicate wins, like FJsonObject
+			int32 FoundIndex = INDEX_NONE;
+			const int32 EndIndex = Matches[ObjectIndex];
+			for (int32 KeyIndex = ObjectIndex + 1; IsMember(KeyIndex, EndIndex); )
+			{
+				const int32 ValueIndex = KeyIndex + 2;
+				if (KeyEquals(KeyIndex, FieldName))
+				{
+					FoundIndex = ValueIndex;
+				}
+				KeyIndex = GetNextIndex(ValueIndex);
+			}
+			return FoundIndex;
+		}
+		
+		virtual TSharedPtr<FJsonValue> ParseValue(int32 Position) const override
+		{
+			const uint32 Start = Index[Position];
+			uint32 End;
+			if (IsOpen(Position))
+			{
+				End = Index[Matches[Position]] + 1;
+			}
+			else
+			{
+				End = GetScalarEnd(Position);
+			}
+			
+			TSharedPtr<FJsonValue> Value;
+			FString ErrorMessage;
+			if (!FEasyJsonFastParserV2::ParseValue(TStringView<CharType>(Json + Start, static_cast<int32>(End - Start)), Value, ErrorMessage))
+			{
+				return nullptr;
+			}
+			return Value;
+		}
+		
+		virtual SIZE_T GetAllocatedSize() const override
+		{
+			return Index.Num() * sizeof(uint32) + Matches.GetAllocatedSize();
+		}
+	
+	private:
+		FORCEINLINE CharType CharAt(int32 Position) const
+		{
+			return Json[Index[Position]];
+		}
+		
+		FORCEINLINE bool IsOpen(int32 Position) const
+		{
+			const CharType Char = CharAt(Position);
+			return Char == '{' || Char == '[';
+		}
+		
+		static FORCEINLINE bool IsWhitespace(CharType Char)
+		{
+			return Char == ' ' || Char == '\t' || Char == '\n' || Char == '\r';
+		}
+		
+		// End of the scalar at Position: it runs up to the next indexed character, less trailing whitespace
+		uint32 GetScalarEnd(int32 Position) const
+		{
+			const uint32 Start = Index[Position];
+			uint32 End = Position + 1 < Index.Num() ? Index[Position + 1] : static_cast<uint32>(Length);
+			while (End > Start && IsWhitespace(Json[End - 1]))
+			{
+				--End;
+			}
+			return End;
+		}
+		
+		// True if the scalar at Position is exactly the given literal
+		template <int32 N>
+		bool IsLiteral(int32 Position, const ANSICHAR (&Literal)[N]) const
+		{
+			const uint32 Start = Index[Position];
+			if (GetScalarEnd(Position) - Start != N - 1)
+			{
+				return false;
+			}
+			for (int32 CharIndex = 0; CharIndex < N - 1; ++CharIndex)
+			{
+				if (Json[Start + CharIndex] != static_cast<CharType>(Literal[CharIndex]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		
+		// True if a "key": value member starts at KeyIndex, inside an object that closes at EndIndex
+		FORCEINLINE bool IsMember(int32 KeyIndex, int32 EndIndex) const
+		{
+			return KeyIndex + 2 < EndIndex && CharAt(KeyIndex) == '"' && CharAt(KeyIndex + 1) == ':';
+		}
+		
+		// Compare the key at KeyIndex with a name, ignoring case
+		bool KeyEquals(int32 KeyIndex, FStringView FieldName) const
+		{
+			// The key's closing quote is the last character before the colon
+			const CharType* Begin = Json + Index[KeyIndex] + 1;
+			const CharType* End = Json + Index[KeyIndex + 1];
+			while (End > Begin && IsWhitespace(End[-1]))
+			{
+				--End;
+			}
+			if (--End < Begin)
+			{
+				return false;
+			}
+			
+			// Plain ASCII keys (the common case) are compared in place
+			bool bPlain = true;
+			for (const CharType* Current = Begin; Current < End && bPlain; ++Current)
+			{
+				bPlain = *Current != '\\' && (sizeof(CharType) > 1 || static_cast<uint8>(*Current) < 0x80);
+			}
+			
+			if (bPlain)
+			{
+				if (End - Begin != FieldName.Len())
+				{
+					return false;
+				}
+				for (int32 CharIndex = 0; CharIndex < FieldName.Len(); ++CharIndex)
+				{
+					if (FChar::ToLower(static_cast<TCHAR>(Begin[CharIndex])) != FChar::ToLower(FieldName[CharIndex]))
+					{
+						return false;
+					}
+				}
+				return true;
+			}
+			
+			// Keys with escapes or non-ASCII text are decoded first
+			FString Key;
+			const TSharedPtr<FJsonValue> KeyValue = ParseValue(KeyIndex);
+			return KeyValue.IsValid() && KeyValue->TryGetString(Key) && FStringView(Key).Equals(FieldName, ESearchCase::IgnoreCase);
+		}
+	
+	public:
+		// Owner of the JSON text (one of them is set)
+		FString OwnedJson;
+		TSharedPtr<FEasyJsonSourceV2, ESPMode::ThreadSafe> Source;
+	
+	private:
+		const CharType* Json = nullptr;
+		int32 Length = 0;
+		FEasyJsonStructuralIndexV2 Index;
+		
+		// Position of the matching closing bracket of every opening bracket
+		TArray<int32> Matches;
+	};
+}
+
+TUniquePtr<FEasyJsonLazyIndexV2> FEasyJsonLazyIndexV2::Build(FString&& Json, FString& OutErrorMessage)
+{
+	TUniquePtr<EasyJsonLazyIndex::TLazyIndex<TCHAR>> LazyIndex = MakeUnique<EasyJsonLazyIndex::TLazyIndex<TCHAR>>();
+	LazyIndex->OwnedJson = MoveTemp(Json);
+	if (!LazyIndex->Build(*LazyIndex->OwnedJson, LazyIndex->OwnedJson.Len(), OutErrorMessage))
+	{
+		return nullptr;
+	}
+	return LazyIndex;
+}
+
+TUniquePtr<FEasyJsonLazyIndexV2> FEasyJsonLazyIndexV2::Build(const TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe>& Source, FString& OutErrorMessage)
+{
+	TArrayView<const uint8> Bytes = Source->GetBytes();
+	if (Bytes.Num() >= 3 && Bytes[0] == 0xEF && Bytes[1] == 0xBB && Bytes[2] == 0xBF)
+	{
+		Bytes = Bytes.Slice(3, Bytes.Num() - 3);
+	}
+	
+	TUniquePtr<EasyJsonLazyIndex::TLazyIndex<UTF8CHAR>> LazyIndex = MakeUnique<EasyJsonLazyIndex::TLazyIndex<UTF8CHAR>>();
+	LazyIndex->Source = Source;
+	if (!LazyIndex->Build(reinterpret_cast<const UTF8CHAR*>(Bytes.GetData()), Bytes.Num(), OutErrorMessage))
+	{
+		return nullptr;
+	}
+	return LazyIndex;
+}
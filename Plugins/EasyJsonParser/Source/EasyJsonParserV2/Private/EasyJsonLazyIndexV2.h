@@ -0,0 +1,48 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "EasyJsonDocumentV2.h"
+#include "EasyJsonSourceV2.h"
+
+/**
+ * Navigation over a JSON text that has only been indexed, used by lazy documents.
+ * Values are addressed by their position in the structural index and containers are skipped
+ * through a table of matching brackets; a value is only parsed when it is read.
+ */
+class FEasyJsonLazyIndexV2
+{
+public:
+	virtual ~FEasyJsonLazyIndexV2() = default;
+
+	/**
+	 * Index a TCHAR document
+	 * @param Json The JSON text (kept by the index)
+	 * @param OutErrorMessage Receives the reason when the structure is invalid
+	 * @return The index, or null on failure
+	 */
+	static TUniquePtr<FEasyJsonLazyIndexV2> Build(FString&& Json, FString& OutErrorMessage);
+
+	/**
+	 * Index UTF-8 source bytes (a leading BOM is skipped)
+	 * @param Source The JSON bytes (kept alive by the index)
+	 * @param OutErrorMessage Receives the reason when the structure is invalid
+	 * @return The index, or null on failure
+	 */
+	static TUniquePtr<FEasyJsonLazyIndexV2> Build(const TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe>& Source, FString& OutErrorMessage);
+
+	// Same meaning as the FEasyJsonDocumentV2 accessors, with indices into the structural index
+	virtual EEasyJsonTapeType GetType(int32 Index) const = 0;
+	virtual int32 GetNextIndex(int32 Index) const = 0;
+	virtual int32 GetEndIndex(int32 Index) const = 0;
+	virtual int32 GetNum(int32 Index) const = 0;
+	virtual int32 FindField(int32 ObjectIndex, FStringView FieldName) const = 0;
+
+	// Parse the value at Index (and everything below it)
+	virtual TSharedPtr<FJsonValue> ParseValue(int32 Index) const = 0;
+
+	// Memory used by the index, not counting the JSON text
+	virtual SIZE_T GetAllocatedSize() const = 0;
+};
@@ -0,0 +1,20 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "AdvancedAccessParser.h"
+
+// In-place edits of engine JSON trees shared by the FEasyJsonObjectV2 writers
+namespace EasyJsonObject
+{
+	typedef TArray<TSharedPtr<FJsonValue>> FJsonValueArrayStorage;
+	
+	// The array stored in a field, modified in place; a missing field or one of another type becomes an empty array
+	FJsonValueArrayStorage& FindOrAddArrayField(FJsonObject& Object, const FAccessStep& Step);
+	
+	// Pad an array with nulls until Index is valid; the storage grows once, with slack, so filling an array by index stays linear
+	void PadArray(FJsonValueArrayStorage& Array, int32 Index);
+}
@@ -1,12 +1,43 @@
 // Copyright 2025 ayumax. All Rights Reserved.
 
 #include "EasyJsonObjectV2.h"
+#include "EasyJsonObjectEditV2.h"
 #include "EasyJsonParserV2Debug.h"
 #include "AdvancedAccessParser.h"
-#include "Internationalization/Regex.h"
+#include "EasyJsonFastParserV2.h"
 #include "Dom/JsonValue.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
+#include "Serialization/JsonReader.h"
+#include "Containers/StringConv.h"
+
+namespace EasyJsonObject
+{
+	FJsonValueArrayStorage& FindOrAddArrayField(FJsonObject& Object, const FAccessStep& Step)
+	{
+		TSharedPtr<FJsonValue>* Field = Object.Values.FindByHash(Step.PropertyNameHash, Step.PropertyName);
+		FJsonValueArrayStorage* Array = nullptr;
+		if (Field == nullptr || !Field->IsValid() || !(*Field)->TryGetArray(Array))
+		{
+			Field = &Object.Values.AddByHash(Step.PropertyNameHash, Step.PropertyName, MakeShareable(new FJsonValueArray(FJsonValueArrayStorage())));
+			(*Field)->TryGetArray(Array);
+		}
+		return *Array;
+	}
+	
+	void PadArray(FJsonValueArrayStorage& Array, int32 Index)
+	{
+		const int32 OldNum = Array.Num();
+		if (Index >= OldNum)
+		{
+			Array.AddDefaulted(Index + 1 - OldNum);
+			for (int32 NewIndex = OldNum; NewIndex <= Index; ++NewIndex)
+			{
+				Array[NewIndex] = MakeShareable(new FJsonValueNull());
+			}
+		}
+	}
+}
 
 FEasyJsonObjectV2::FEasyJsonObjectV2()
 {
@@ -17,8 +48,16 @@ FEasyJsonObjectV2::FEasyJsonObjectV2(TSharedPtr<FJsonObject> InJsonObject)
 {
 }
 
+FEasyJsonObjectV2::FEasyJsonObjectV2(const TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe>& InDocument, int32 InDocumentIndex)
+	: Document(InDocument)
+	, DocumentIndex(InDocumentIndex)
+{
+}
+
 FEasyJsonObjectV2::FEasyJsonObjectV2(const FEasyJsonObjectV2& Other)
 	: InnerObject(Other.InnerObject)
+	, Document(Other.Document)
+	, DocumentIndex(Other.DocumentIndex)
 {
 }
 
@@ -27,12 +66,16 @@ FEasyJsonObjectV2& FEasyJsonObjectV2::operator=(const FEasyJsonObjectV2& Other)
 	if (this != &Other)
 	{
 		InnerObject = Other.InnerObject;
+		Document = Other.Document;
+		DocumentIndex = Other.DocumentIndex;
 	}
 	return *this;
 }
 
 FEasyJsonObjectV2::FEasyJsonObjectV2(FEasyJsonObjectV2&& Other) noexcept
 	: InnerObject(MoveTemp(Other.InnerObject))
+	, Document(MoveTemp(Other.Document))
+	, DocumentIndex(Other.DocumentIndex)
 {
 }
 
@@ -41,18 +84,50 @@ FEasyJsonObjectV2& FEasyJsonObjectV2::operator=(FEasyJsonObjectV2&& Other) noexc
 	if (this != &Other)
 	{
 		InnerObject = MoveTemp(Other.InnerObject);
+		Document = MoveTemp(Other.Document);
+		DocumentIndex = Other.DocumentIndex;
 	}
 	return *this;
 }
 
 int32 FEasyJsonObjectV2::ReadInt(const FString& AccessString, int32 DefaultValue) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadInt(%s)"), *AccessString));
+	return ReadInt(FEasyJsonPathV2(AccessString), DefaultValue);
+}
+
+float FEasyJsonObjectV2::ReadFloat(const FString& AccessString, float DefaultValue) const
+{
+	return ReadFloat(FEasyJsonPathV2(AccessString), DefaultValue);
+}
+
+FString FEasyJsonObjectV2::ReadString(const FString& AccessString, const FString& DefaultValue) const
+{
+	return ReadString(FEasyJsonPathV2(AccessString), DefaultValue);
+}
+
+bool FEasyJsonObjectV2::ReadBool(const FString& AccessString, bool DefaultValue) const
+{
+	return ReadBool(FEasyJsonPathV2(AccessString), DefaultValue);
+}
+
+FEasyJsonObjectV2 FEasyJsonObjectV2::ReadObject(const FString& AccessString, bool& bFound) const
+{
+	return ReadObject(FEasyJsonPathV2(AccessString), bFound);
+}
+
+TArray<FEasyJsonObjectV2> FEasyJsonObjectV2::ReadObjects(const FString& AccessString, bool& bFound) const
+{
+	return ReadObjects(FEasyJsonPathV2(AccessString), bFound);
+}
+
+int32 FEasyJsonObjectV2::ReadInt(const FEasyJsonPathV2& Path, int32 DefaultValue) const
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadInt(%s)"), *Path.GetAccessString()));
 	
-	FEasyJsonValueV2 FoundElement = ReadEasyJsonValue(AccessString);
-	if (!FoundElement.IsValid()) 
+	FEasyJsonValueV2 FoundElement = ReadEasyJsonValue(Path);
+	if (!FoundElement.IsValid())
 	{
-		EASYJSON_DEBUG_ERROR(AccessString, TEXT("PathNotFound"), TEXT("Check if the path exists and contains an integer value"));
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("PathNotFound"), TEXT("Check if the path exists and contains an integer value"));
 		return DefaultValue;
 	}
 	
@@ -61,14 +136,14 @@ int32 FEasyJsonObjectV2::ReadInt(const FString& AccessString, int32 DefaultValue
 	return Result;
 }
 
-float FEasyJsonObjectV2::ReadFloat(const FString& AccessString, float DefaultValue) const
+float FEasyJsonObjectV2::ReadFloat(const FEasyJsonPathV2& Path, float DefaultValue) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadFloat(%s)"), *AccessString));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadFloat(%s)"), *Path.GetAccessString()));
 	
-	FEasyJsonValueV2 FoundElement = ReadEasyJsonValue(AccessString);
-	if (!FoundElement.IsValid()) 
+	FEasyJsonValueV2 FoundElement = ReadEasyJsonValue(Path);
+	if (!FoundElement.IsValid())
 	{
-		EASYJSON_DEBUG_ERROR(AccessString, TEXT("PathNotFound"), TEXT("Check if the path exists and contains a float value"));
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("PathNotFound"), TEXT("Check if the path exists and contains a float value"));
 		return DefaultValue;
 	}
 	
@@ -77,14 +152,14 @@ float FEasyJsonObjectV2::ReadFloat(const FString& AccessString, float DefaultVal
 	return Result;
 }
 
-FString FEasyJsonObjectV2::ReadString(const FString& AccessString, const FString& DefaultValue) const
+FString FEasyJsonObjectV2::ReadString(const FEasyJsonPathV2& Path, const FString& DefaultValue) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadString(%s)"), *AccessString));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadString(%s)"), *Path.GetAccessString()));
 	
-	FEasyJsonValueV2 FoundElement = ReadEasyJsonValue(AccessString);
-	if (!FoundElement.IsValid()) 
+	FEasyJsonValueV2 FoundElement = ReadEasyJsonValue(Path);
+	if (!FoundElement.IsValid())
 	{
-		EASYJSON_DEBUG_ERROR(AccessString, TEXT("PathNotFound"), TEXT("Check if the path exists and contains a string value"));
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("PathNotFound"), TEXT("Check if the path exists and contains a string value"));
 		return DefaultValue;
 	}
 	
@@ -93,14 +168,14 @@ FString FEasyJsonObjectV2::ReadString(const FString& AccessString, const FString
 	return Result;
 }
 
-bool FEasyJsonObjectV2::ReadBool(const FString& AccessString, bool DefaultValue) const
+bool FEasyJsonObjectV2::ReadBool(const FEasyJsonPathV2& Path, bool DefaultValue) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadBool(%s)"), *AccessString));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadBool(%s)"), *Path.GetAccessString()));
 	
-	FEasyJsonValueV2 FoundElement = ReadEasyJsonValue(AccessString);
-	if (!FoundElement.IsValid()) 
+	FEasyJsonValueV2 FoundElement = ReadEasyJsonValue(Path);
+	if (!FoundElement.IsValid())
 	{
-		EASYJSON_DEBUG_ERROR(AccessString, TEXT("PathNotFound"), TEXT("Check if the path exists and contains a boolean value"));
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("PathNotFound"), TEXT("Check if the path exists and contains a boolean value"));
 		return DefaultValue;
 	}
 	
@@ -109,11 +184,11 @@ bool FEasyJsonObjectV2::ReadBool(const FString& AccessString, bool DefaultValue)
 	return Result;
 }
 
-FEasyJsonObjectV2 FEasyJsonObjectV2::ReadObject(const FString& AccessString, bool& bFound) const
+FEasyJsonObjectV2 FEasyJsonObjectV2::ReadObject(const FEasyJsonPathV2& Path, bool& bFound) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadObject(%s)"), *AccessString));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadObject(%s)"), *Path.GetAccessString()));
 	
-	TArray<FEasyJsonObjectV2> FilterArray = ReadObjects(AccessString, bFound);
+	TArray<FEasyJsonObjectV2> FilterArray = ReadObjects(Path, bFound);
 	
 	if (FilterArray.Num() > 0)
 	{
@@ -121,68 +196,53 @@ FEasyJsonObjectV2 FEasyJsonObjectV2::ReadObject(const FString& AccessString, boo
 		return FilterArray[0];
 	}
 	
-	EASYJSON_DEBUG_ERROR(AccessString, TEXT("ObjectNotFound"), TEXT("Check if the path exists and contains an object"));
+	EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("ObjectNotFound"), TEXT("Check if the path exists and contains an object"));
 	bFound = false;
 	return FEasyJsonObjectV2();
 }
 
-TArray<FEasyJsonObjectV2> FEasyJsonObjectV2::ReadObjects(const FString& AccessString, bool& bFound) const
+TArray<FEasyJsonObjectV2> FEasyJsonObjectV2::ReadObjects(const FEasyJsonPathV2& Path, bool& bFound) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadObjects(%s)"), *AccessString));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadObjects(%s)"), *Path.GetAccessString()));
 	
 	TArray<FEasyJsonObjectV2> FoundElements;
 	
-	TArray<FString> Accessers;
-	AccessString.ParseIntoArray(Accessers, TEXT("."), true);
-	
 	bFound = false;
 	
 	if (!IsValid())
 	{
-		EASYJSON_DEBUG_ERROR(AccessString, TEXT("InvalidObject"), TEXT("JSON object is not valid"));
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("InvalidObject"), TEXT("JSON object is not valid"));
 		return FoundElements;
 	}
 	
-	TSharedPtr<FJsonObject> ParentNode = InnerObject;
+	const TArray<FAccessStep>& Steps = Path.GetSteps();
+	FEasyJsonObjectV2 ParentNode = *this;
 	
-	for (const FString& AccessName : Accessers)
+	for (int32 StepIndex = 0; StepIndex < Steps.Num(); ++StepIndex)
 	{
-		if (!ParentNode) break;
-		
-		TSharedPtr<FJsonObject> BeforeParentNode = ParentNode;
-		
-		FString PropertyName;
-		int32 ArrayIndex = 0;
-		bool bIsArray = IsAccessAsArray(AccessName, PropertyName, ArrayIndex);
+		if (!ParentNode.IsValid()) break;
 		
-		TArray<TSharedPtr<FJsonObject>> Objects;
-		GetObject(ParentNode, PropertyName, Objects);
-		
-		if (Objects.Num() == 0) break;
+		const FAccessStep& Step = Steps[StepIndex];
 		
-		if (AccessName.Equals(Accessers.Last()))
-		{
-			bFound = true;
-			for (const TSharedPtr<FJsonObject>& JsonObject : Objects)
-			{
-				FoundElements.Add(FEasyJsonObjectV2(JsonObject));
-			}
-		}
-		else
+		if (StepIndex == Steps.Num() - 1)
 		{
-			if (ArrayIndex < Objects.Num())
+			if (Step.ArrayIndices.Num() > 1)
 			{
-				ParentNode = Objects[ArrayIndex];
+				// Multi-dimensional access resolves to a single element first
+				FEasyJsonObjectV2 ElementObject = NavigateToArrayElement(ParentNode.FindField(Step), Step.ArrayIndices).GetObjectValue();
+				if (ElementObject.IsValid())
+				{
+					FoundElements.Add(MoveTemp(ElementObject));
+				}
 			}
 			else
 			{
-				break;
+				GetObject(ParentNode, Step, FoundElements);
 			}
 		}
-		
-		if (ParentNode == BeforeParentNode)
+		else
 		{
-			break;
+			ParentNode = ResolveChildObject(ParentNode, Step);
 		}
 	}
 	
@@ -193,7 +253,7 @@ TArray<FEasyJsonObjectV2> FEasyJsonObjectV2::ReadObjects(const FString& AccessSt
 	}
 	else
 	{
-		EASYJSON_DEBUG_ERROR(AccessString, TEXT("ArrayNotFound"), TEXT("Check if the path exists and contains an array"));
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("ArrayNotFound"), TEXT("Check if the path exists and contains an array"));
 	}
 	
 	return FoundElements;
@@ -201,81 +261,110 @@ TArray<FEasyJsonObjectV2> FEasyJsonObjectV2::ReadObjects(const FString& AccessSt
 
 void FEasyJsonObjectV2::WriteInt(const FString& AccessString, int32 Value)
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("WriteInt(%s, %d)"), *AccessString, Value));
+	WriteInt(FEasyJsonPathV2(AccessString), Value);
+}
+
+void FEasyJsonObjectV2::WriteFloat(const FString& AccessString, float Value)
+{
+	WriteFloat(FEasyJsonPathV2(AccessString), Value);
+}
+
+void FEasyJsonObjectV2::WriteString(const FString& AccessString, const FString& Value)
+{
+	WriteString(FEasyJsonPathV2(AccessString), Value);
+}
+
+void FEasyJsonObjectV2::WriteBool(const FString& AccessString, bool Value)
+{
+	WriteBool(FEasyJsonPathV2(AccessString), Value);
+}
+
+void FEasyJsonObjectV2::WriteObject(const FString& AccessString, const FEasyJsonObjectV2& Object)
+{
+	WriteObject(FEasyJsonPathV2(AccessString), Object);
+}
+
+void FEasyJsonObjectV2::WriteInt(const FEasyJsonPathV2& Path, int32 Value)
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("WriteInt(%s, %d)"), *Path.GetAccessString(), Value));
 	
 	TSharedPtr<FJsonValue> NewValue = MakeShareable(new FJsonValueNumber(static_cast<double>(Value)));
-	CreateValue(AccessString, NewValue);
+	CreateValue(Path, NewValue);
 	
-	EASYJSON_DEBUG_SUCCESS(TEXT("WriteInt"), FString::Printf(TEXT("Written value %d to path '%s'"), Value, *AccessString));
+	EASYJSON_DEBUG_SUCCESS(TEXT("WriteInt"), FString::Printf(TEXT("Written value %d to path '%s'"), Value, *Path.GetAccessString()));
 }
 
-void FEasyJsonObjectV2::WriteFloat(const FString& AccessString, float Value)
+void FEasyJsonObjectV2::WriteFloat(const FEasyJsonPathV2& Path, float Value)
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("WriteFloat(%s, %f)"), *AccessString, Value));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("WriteFloat(%s, %f)"), *Path.GetAccessString(), Value));
 	
 	TSharedPtr<FJsonValue> NewValue = MakeShareable(new FJsonValueNumber(static_cast<double>(Value)));
-	CreateValue(AccessString, NewValue);
+	CreateValue(Path, NewValue);
 	
-	EASYJSON_DEBUG_SUCCESS(TEXT("WriteFloat"), FString::Printf(TEXT("Written value %f to path '%s'"), Value, *AccessString));
+	EASYJSON_DEBUG_SUCCESS(TEXT("WriteFloat"), FString::Printf(TEXT("Written value %f to path '%s'"), Value, *Path.GetAccessString()));
 }
 
-void FEasyJsonObjectV2::WriteString(const FString& AccessString, const FString& Value)
+void FEasyJsonObjectV2::WriteString(const FEasyJsonPathV2& Path, const FString& Value)
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("WriteString(%s, '%s')"), *AccessString, *Value));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("WriteString(%s, '%s')"), *Path.GetAccessString(), *Value));
 	
 	TSharedPtr<FJsonValue> NewValue = MakeShareable(new FJsonValueString(Value));
-	CreateValue(AccessString, NewValue);
+	CreateValue(Path, NewValue);
 	
-	EASYJSON_DEBUG_SUCCESS(TEXT("WriteString"), FString::Printf(TEXT("Written value '%s' to path '%s'"), *Value, *AccessString));
+	EASYJSON_DEBUG_SUCCESS(TEXT("WriteString"), FString::Printf(TEXT("Written value '%s' to path '%s'"), *Value, *Path.GetAccessString()));
 }
 
-void FEasyJsonObjectV2::WriteBool(const FString& AccessString, bool Value)
+void FEasyJsonObjectV2::WriteBool(const FEasyJsonPathV2& Path, bool Value)
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("WriteBool(%s, %s)"), *AccessString, Value ? TEXT("true") : TEXT("false")));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("WriteBool(%s, %s)"), *Path.GetAccessString(), Value ? TEXT("true") : TEXT("false")));
 	
 	TSharedPtr<FJsonValue> NewValue = MakeShareable(new FJsonValueBoolean(Value));
-	CreateValue(AccessString, NewValue);
+	CreateValue(Path, NewValue);
 	
-	EASYJSON_DEBUG_SUCCESS(TEXT("WriteBool"), FString::Printf(TEXT("Written value %s to path '%s'"), Value ? TEXT("true") : TEXT("false"), *AccessString));
+	EASYJSON_DEBUG_SUCCESS(TEXT("WriteBool"), FString::Printf(TEXT("Written value %s to path '%s'"), Value ? TEXT("true") : TEXT("false"), *Path.GetAccessString()));
 }
 
-void FEasyJsonObjectV2::WriteObject(const FString& AccessString, const FEasyJsonObjectV2& Object)
+void FEasyJsonObjectV2::WriteObject(const FEasyJsonPathV2& Path, const FEasyJsonObjectV2& Object)
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("WriteObject(%s)"), *AccessString));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("WriteObject(%s)"), *Path.GetAccessString()));
 	
 	if (Object.IsValid())
 	{
-		TSharedPtr<FJsonValue> NewValue = MakeShareable(new FJsonValueObject(Object.InnerObject));
-		CreateValue(AccessString, NewValue);
-		EASYJSON_DEBUG_SUCCESS(TEXT("WriteObject"), FString::Printf(TEXT("Written object to path '%s'"), *AccessString));
+		TSharedPtr<FJsonValue> NewValue = MakeShareable(new FJsonValueObject(Object.ToJsonObject()));
+		CreateValue(Path, NewValue);
+		EASYJSON_DEBUG_SUCCESS(TEXT("WriteObject"), FString::Printf(TEXT("Written object to path '%s'"), *Path.GetAccessString()));
 	}
 	else
 	{
-		EASYJSON_DEBUG_ERROR(AccessString, TEXT("InvalidObject"), TEXT("The object to write is not valid"));
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("InvalidObject"), TEXT("The object to write is not valid"));
 	}
 }
 
-void FEasyJsonObjectV2::AddToArrayInternal(const FString& AccessString, TSharedPtr<FJsonValue> NewValue, const FString& TypeName, const FString& ValueString)
+TArray<TSharedPtr<FJsonValue>>* FEasyJsonObjectV2::FindOrAddArray(const FEasyJsonPathV2& Path)
 {
+	DetachFromDocument();
+	
 	if (!IsValid())
 	{
 		InnerObject = MakeShareable(new FJsonObject());
 	}
 	
-	TArray<FString> Accessers;
-	AccessString.ParseIntoArray(Accessers, TEXT("."), true);
+	if (!Path.IsValid())
+	{
+		return nullptr;
+	}
 	
-	if (Accessers.Num() == 0)
+	if (Path.GetMaxArrayDepth() > 1 || Path.GetLastStep().bIsArrayAccess)
 	{
-		return;
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("UnsupportedPath"), TEXT("The array to add to must be addressed by property name"));
+		return nullptr;
 	}
 	
-	const FString& FinalAccessor = Accessers.Last();
-	FString ArrayPropertyName = FinalAccessor;
+	const FAccessStep& ArrayStep = Path.GetLastStep();
 	
 	// Get the parent object
 	TSharedPtr<FJsonObject> ParentObject;
-	if (Accessers.Num() == 1)
+	if (Path.Num() == 1)
 	{
 		// Direct property on root object
 		ParentObject = InnerObject;
@@ -283,87 +372,168 @@ void FEasyJsonObjectV2::AddToArrayInternal(const FString& AccessString, TSharedP
 	else
 	{
 		// Nested property - get parent path
-		TArray<FString> ParentAccessers = Accessers;
-		ParentAccessers.RemoveAt(ParentAccessers.Num() - 1);
-		FString ParentPath = FString::Join(ParentAccessers, TEXT("."));
-		ParentObject = CreateOrGetObject(ParentPath);
+		ParentObject = CreateOrGetObject(Path.GetParentSteps());
 	}
 	
 	if (!ParentObject.IsValid())
 	{
-		EASYJSON_DEBUG_ERROR(AccessString, TEXT("PathCreationFailed"), TEXT("Could not create or get parent object"));
-		return;
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("PathCreationFailed"), TEXT("Could not create or get parent object"));
+		return nullptr;
 	}
 	
-	// Get existing array or create new one
-	const TArray<TSharedPtr<FJsonValue>>* ExistingArray;
-	TArray<TSharedPtr<FJsonValue>> ModifiedArray;
-	
-	if (ParentObject->TryGetArrayField(ArrayPropertyName, ExistingArray))
+	return &EasyJsonObject::FindOrAddArrayField(*ParentObject, ArrayStep);
+}
+
+void FEasyJsonObjectV2::AddToArrayInternal(const FEasyJsonPathV2& Path, TSharedPtr<FJsonValue> NewValue, const FString& TypeName, const FString& ValueString)
+{
+	if (TArray<TSharedPtr<FJsonValue>>* Array = FindOrAddArray(Path))
 	{
-		ModifiedArray = *ExistingArray;
+		Array->Add(MoveTemp(NewValue));
 	}
-	
-	// Add the new value
-	ModifiedArray.Add(NewValue);
-	
-	ParentObject->SetArrayField(ArrayPropertyName, ModifiedArray);
 }
 
 void FEasyJsonObjectV2::AddIntToArray(const FString& AccessString, int32 Value)
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("AddIntToArray(%s, %d)"), *AccessString, Value));
+	AddIntToArray(FEasyJsonPathV2(AccessString), Value);
+}
+
+void FEasyJsonObjectV2::AddFloatToArray(const FString& AccessString, float Value)
+{
+	AddFloatToArray(FEasyJsonPathV2(AccessString), Value);
+}
+
+void FEasyJsonObjectV2::AddStringToArray(const FString& AccessString, const FString& Value)
+{
+	AddStringToArray(FEasyJsonPathV2(AccessString), Value);
+}
+
+void FEasyJsonObjectV2::AddBoolToArray(const FString& AccessString, bool Value)
+{
+	AddBoolToArray(FEasyJsonPathV2(AccessString), Value);
+}
+
+void FEasyJsonObjectV2::AddObjectToArray(const FString& AccessString, const FEasyJsonObjectV2& Object)
+{
+	AddObjectToArray(FEasyJsonPathV2(AccessString), Object);
+}
+
+void FEasyJsonObjectV2::AddIntToArray(const FEasyJsonPathV2& Path, int32 Value)
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("AddIntToArray(%s, %d)"), *Path.GetAccessString(), Value));
 	
 	TSharedPtr<FJsonValue> NewValue = MakeShareable(new FJsonValueNumber(static_cast<double>(Value)));
-	AddToArrayInternal(AccessString, NewValue, TEXT("Int"), FString::Printf(TEXT("%d"), Value));
+	AddToArrayInternal(Path, NewValue, TEXT("Int"), FString::Printf(TEXT("%d"), Value));
 	
-	EASYJSON_DEBUG_SUCCESS(TEXT("AddIntToArray"), FString::Printf(TEXT("Added value %d to array '%s'"), Value, *AccessString));
+	EASYJSON_DEBUG_SUCCESS(TEXT("AddIntToArray"), FString::Printf(TEXT("Added value %d to array '%s'"), Value, *Path.GetAccessString()));
 }
 
-void FEasyJsonObjectV2::AddFloatToArray(const FString& AccessString, float Value)
+void FEasyJsonObjectV2::AddFloatToArray(const FEasyJsonPathV2& Path, float Value)
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("AddFloatToArray(%s, %f)"), *AccessString, Value));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("AddFloatToArray(%s, %f)"), *Path.GetAccessString(), Value));
 	
 	TSharedPtr<FJsonValue> NewValue = MakeShareable(new FJsonValueNumber(static_cast<double>(Value)));
-	AddToArrayInternal(AccessString, NewValue, TEXT("Float"), FString::Printf(TEXT("%f"), Value));
+	AddToArrayInternal(Path, NewValue, TEXT("Float"), FString::Printf(TEXT("%f"), Value));
 	
-	EASYJSON_DEBUG_SUCCESS(TEXT("AddFloatToArray"), FString::Printf(TEXT("Added value %f to array '%s'"), Value, *AccessString));
+	EASYJSON_DEBUG_SUCCESS(TEXT("AddFloatToArray"), FString::Printf(TEXT("Added value %f to array '%s'"), Value, *Path.GetAccessString()));
 }
 
-void FEasyJsonObjectV2::AddStringToArray(const FString& AccessString, const FString& Value)
+void FEasyJsonObjectV2::AddStringToArray(const FEasyJsonPathV2& Path, const FString& Value)
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("AddStringToArray(%s, '%s')"), *AccessString, *Value));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("AddStringToArray(%s, '%s')"), *Path.GetAccessString(), *Value));
 	
 	TSharedPtr<FJsonValue> NewValue = MakeShareable(new FJsonValueString(Value));
-	AddToArrayInternal(AccessString, NewValue, TEXT("String"), FString::Printf(TEXT("'%s'"), *Value));
+	AddToArrayInternal(Path, NewValue, TEXT("String"), FString::Printf(TEXT("'%s'"), *Value));
 	
-	EASYJSON_DEBUG_SUCCESS(TEXT("AddStringToArray"), FString::Printf(TEXT("Added value '%s' to array '%s'"), *Value, *AccessString));
+	EASYJSON_DEBUG_SUCCESS(TEXT("AddStringToArray"), FString::Printf(TEXT("Added value '%s' to array '%s'"), *Value, *Path.GetAccessString()));
 }
 
-void FEasyJsonObjectV2::AddBoolToArray(const FString& AccessString, bool Value)
+void FEasyJsonObjectV2::AddBoolToArray(const FEasyJsonPathV2& Path, bool Value)
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("AddBoolToArray(%s, %s)"), *AccessString, Value ? TEXT("true") : TEXT("false")));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("AddBoolToArray(%s, %s)"), *Path.GetAccessString(), Value ? TEXT("true") : TEXT("false")));
 	
 	TSharedPtr<FJsonValue> NewValue = MakeShareable(new FJsonValueBoolean(Value));
-	AddToArrayInternal(AccessString, NewValue, TEXT("Bool"), Value ? TEXT("true") : TEXT("false"));
+	AddToArrayInternal(Path, NewValue, TEXT("Bool"), Value ? TEXT("true") : TEXT("false"));
 	
-	EASYJSON_DEBUG_SUCCESS(TEXT("AddBoolToArray"), FString::Printf(TEXT("Added value %s to array '%s'"), Value ? TEXT("true") : TEXT("false"), *AccessString));
+	EASYJSON_DEBUG_SUCCESS(TEXT("AddBoolToArray"), FString::Printf(TEXT("Added value %s to array '%s'"), Value ? TEXT("true") : TEXT("false"), *Path.GetAccessString()));
 }
 
-void FEasyJsonObjectV2::AddObjectToArray(const FString& AccessString, const FEasyJsonObjectV2& Object)
+void FEasyJsonObjectV2::AddObjectToArray(const FEasyJsonPathV2& Path, const FEasyJsonObjectV2& Object)
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("AddObjectToArray(%s)"), *AccessString));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("AddObjectToArray(%s)"), *Path.GetAccessString()));
 	
 	if (!Object.IsValid())
 	{
-		EASYJSON_DEBUG_ERROR(AccessString, TEXT("InvalidObject"), TEXT("The object to add is not valid"));
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("InvalidObject"), TEXT("The object to add is not valid"));
 		return;
 	}
 	
-	TSharedPtr<FJsonValue> NewValue = MakeShareable(new FJsonValueObject(Object.InnerObject));
-	AddToArrayInternal(AccessString, NewValue, TEXT("Object"), TEXT("object"));
+	TSharedPtr<FJsonValue> NewValue = MakeShareable(new FJsonValueObject(Object.ToJsonObject()));
+	AddToArrayInternal(Path, NewValue, TEXT("Object"), TEXT("object"));
+	
+	EASYJSON_DEBUG_SUCCESS(TEXT("AddObjectToArray"), FString::Printf(TEXT("Added object to array '%s'"), *Path.GetAccessString()));
+}
+
+void FEasyJsonObjectV2::AddIntsToArray(const FString& AccessString, TArrayView<const int32> Values)
+{
+	AddIntsToArray(FEasyJsonPathV2(AccessString), Values);
+}
+
+void FEasyJsonObjectV2::AddFloatsToArray(const FString& AccessString, TArrayView<const float> Values)
+{
+	AddFloatsToArray(FEasyJsonPathV2(AccessString), Values);
+}
+
+void FEasyJsonObjectV2::AddStringsToArray(const FString& AccessString, TArrayView<const FString> Values)
+{
+	AddStringsToArray(FEasyJsonPathV2(AccessString), Values);
+}
+
+void FEasyJsonObjectV2::AddIntsToArray(const FEasyJsonPathV2& Path, TArrayView<const int32> Values)
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("AddIntsToArray(%s, %d values)"), *Path.GetAccessString(), Values.Num()));
+	
+	if (TArray<TSharedPtr<FJsonValue>>* Array = FindOrAddArray(Path))
+	{
+		Array->Reserve(Array->Num() + Values.Num());
+		for (const int32 Value : Values)
+		{
+			Array->Add(MakeShareable(new FJsonValueNumber(static_cast<double>(Value))));
+		}
+		
+		EASYJSON_DEBUG_SUCCESS(TEXT("AddIntsToArray"), FString::Printf(TEXT("Added %d values to array '%s'"), Values.Num(), *Path.GetAccessString()));
+	}
+}
+
+void FEasyJsonObjectV2::AddFloatsToArray(const FEasyJsonPathV2& Path, TArrayView<const float> Values)
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("AddFloatsToArray(%s, %d values)"), *Path.GetAccessString(), Values.Num()));
+	
+	if (TArray<TSharedPtr<FJsonValue>>* Array = FindOrAddArray(Path))
+	{
+		Array->Reserve(Array->Num() + Values.Num());
+		for (const float Value : Values)
+		{
+			Array->Add(MakeShareable(new FJsonValueNumber(static_cast<double>(Value))));
+		}
+		
+		EASYJSON_DEBUG_SUCCESS(TEXT("AddFloatsToArray"), FString::Printf(TEXT("Added %d values to array '%s'"), Values.Num(), *Path.GetAccessString()));
+	}
+}
+
+void FEasyJsonObjectV2::AddStringsToArray(const FEasyJsonPathV2& Path, TArrayView<const FString> Values)
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("AddStringsToArray(%s, %d values)"), *Path.GetAccessString(), Values.Num()));
 	
-	EASYJSON_DEBUG_SUCCESS(TEXT("AddObjectToArray"), FString::Printf(TEXT("Added object to array '%s'"), *AccessString));
+	if (TArray<TSharedPtr<FJsonValue>>* Array = FindOrAddArray(Path))
+	{
+		Array->Reserve(Array->Num() + Values.Num());
+		for (const FString& Value : Values)
+		{
+			Array->Add(MakeShareable(new FJsonValueString(Value)));
+		}
+		
+		EASYJSON_DEBUG_SUCCESS(TEXT("AddStringsToArray"), FString::Printf(TEXT("Added %d values to array '%s'"), Values.Num(), *Path.GetAccessString()));
+	}
 }
 
 FEasyJsonObjectV2 FEasyJsonObjectV2::CreateEmpty()
@@ -374,9 +544,40 @@ FEasyJsonObjectV2 FEasyJsonObjectV2::CreateEmpty()
 FEasyJsonObjectV2 FEasyJsonObjectV2::CreateFromString(const FString& JsonString, bool& bSuccess)
 {
 	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	bSuccess = FEasyJsonFastParserV2::ParseObjectWithFallback(JsonString, JsonObject);
+	
+	if (bSuccess && JsonObject.IsValid())
+	{
+		return FEasyJsonObjectV2(JsonObject);
+	}
+	
+	return FEasyJsonObjectV2();
+}
+
+FEasyJsonObjectV2 FEasyJsonObjectV2::CreateFromUtf8(TArrayView<const uint8> Utf8Json, bool& bSuccess)
+{
+	// Skip the UTF-8 byte order mark
+	if (Utf8Json.Num() >= 3 && Utf8Json[0] == 0xEF && Utf8Json[1] == 0xBB && Utf8Json[2] == 0xBF)
+	{
+		Utf8Json = Utf8Json.Slice(3, Utf8Json.Num() - 3);
+	}
+	
+	TSharedPtr<FJsonObject> JsonObject;
+	const FUtf8StringView JsonView(reinterpret_cast<const UTF8CHAR*>(Utf8Json.GetData()), Utf8Json.Num());
+	bSuccess = FEasyJsonFastParserV2::ParseObjectWithFallback(JsonView, JsonObject);
+	
+	if (bSuccess && JsonObject.IsValid())
+	{
+		return FEasyJsonObjectV2(JsonObject);
+	}
 	
-	bSuccess = FJsonSerializer::Deserialize(Reader, JsonObject);
+	return FEasyJsonObjectV2();
+}
+
+FEasyJsonObjectV2 FEasyJsonObjectV2::CreateFromSource(const TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe>& Source, bool& bSuccess)
+{
+	TSharedPtr<FJsonObject> JsonObject;
+	bSuccess = FEasyJsonFastParserV2::ParseObjectWithFallback(Source, JsonObject);
 	
 	if (bSuccess && JsonObject.IsValid())
 	{
@@ -391,6 +592,89 @@ FEasyJsonObjectV2 FEasyJsonObjectV2::CreateFromJsonObject(TSharedPtr<FJsonObject
 	return FEasyJsonObjectV2(JsonObject);
 }
 
+FEasyJsonObjectV2 FEasyJsonObjectV2::CreateFromDocument(const TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe>& InDocument)
+{
+	if (InDocument.IsValid() && InDocument->GetType(FEasyJsonDocumentV2::RootIndex) == EEasyJsonTapeType::Object)
+	{
+		return FEasyJsonObjectV2(InDocument, FEasyJsonDocumentV2::RootIndex);
+	}
+	
+	return FEasyJsonObjectV2();
+}
+
+FEasyJsonObjectV2 FEasyJsonObjectV2::CreateDocumentFromString(const FString& JsonString, bool& bSuccess)
+{
+	FString ErrorMessage;
+	TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> ParsedDocument = FEasyJsonDocumentV2::Parse(JsonString, ErrorMessage);
+	if (!ParsedDocument.IsValid())
+	{
+		// Input only the engine reader accepts is parsed by it and copied into a document
+		EASYJSON_DEBUG_LOG(TEXT("ParseDocument"), TEXT("Fallback"), ErrorMessage);
+		
+		TSharedPtr<FJsonObject> JsonObject;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+		if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
+		{
+			ParsedDocument = FEasyJsonDocumentV2::FromJsonValue(MakeShared<FJsonValueObject>(JsonObject));
+		}
+	}
+	
+	FEasyJsonObjectV2 Result = CreateFromDocument(ParsedDocument);
+	bSuccess = Result.IsValid();
+	return Result;
+}
+
+FEasyJsonObjectV2 FEasyJsonObjectV2::CreateDocumentFromUtf8(TArrayView<const uint8> Utf8Json, bool& bSuccess)
+{
+	// Skip the UTF-8 byte order mark
+	if (Utf8Json.Num() >= 3 && Utf8Json[0] == 0xEF && Utf8Json[1] == 0xBB && Utf8Json[2] == 0xBF)
+	{
+		Utf8Json = Utf8Json.Slice(3, Utf8Json.Num() - 3);
+	}
+	
+	FString ErrorMessage;
+	const FUtf8StringView JsonView(reinterpret_cast<const UTF8CHAR*>(Utf8Json.GetData()), Utf8Json.Num());
+	TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> ParsedDocument = FEasyJsonDocumentV2::Parse(JsonView, ErrorMessage);
+	if (!ParsedDocument.IsValid())
+	{
+		// The engine reader needs TCHAR input, so only the fallback pays for widening
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Utf8Json.GetData()), Utf8Json.Num());
+		return CreateDocumentFromString(FString(Converted.Length(), Converted.Get()), bSuccess);
+	}
+	
+	FEasyJsonObjectV2 Result = CreateFromDocument(ParsedDocument);
+	bSuccess = Result.IsValid();
+	return Result;
+}
+
+FEasyJsonObjectV2 FEasyJsonObjectV2::CreateLazyFromString(const FString& JsonString, bool& bSuccess)
+{
+	FString ErrorMessage;
+	const TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> ParsedDocument = FEasyJsonDocumentV2::ParseLazy(FString(JsonString), ErrorMessage);
+	if (!ParsedDocument.IsValid())
+	{
+		EASYJSON_DEBUG_LOG(TEXT("ParseLazy"), TEXT("Failed"), ErrorMessage);
+	}
+	
+	FEasyJsonObjectV2 Result = CreateFromDocument(ParsedDocument);
+	bSuccess = Result.IsValid();
+	return Result;
+}
+
+FEasyJsonObjectV2 FEasyJsonObjectV2::CreateLazyFromSource(const TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe>& Source, bool& bSuccess)
+{
+	FString ErrorMessage;
+	const TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> ParsedDocument = FEasyJsonDocumentV2::ParseLazy(Source, ErrorMessage);
+	if (!ParsedDocument.IsValid())
+	{
+		EASYJSON_DEBUG_LOG(TEXT("ParseLazy"), TEXT("Failed"), ErrorMessage);
+	}
+	
+	FEasyJsonObjectV2 Result = CreateFromDocument(ParsedDocument);
+	bSuccess = Result.IsValid();
+	return Result;
+}
+
 FString FEasyJsonObjectV2::ToString(bool bPrettyPrint) const
 {
 	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ToString(PrettyPrint: %s)"), bPrettyPrint ? TEXT("true") : TEXT("false")));
@@ -402,11 +686,11 @@ FString FEasyJsonObjectV2::ToString(bool bPrettyPrint) const
 	}
 	
 	FString OutputString;
-	TSharedRef<TJsonWriter<>> Writer = bPrettyPrint 
+	TSharedRef<TJsonWriter<>> Writer = bPrettyPrint
 		? TJsonWriterFactory<>::Create(&OutputString)
 		: TJsonWriterFactory<>::Create(&OutputString, 0);
 	
-	FJsonSerializer::Serialize(InnerObject.ToSharedRef(), Writer);
+	FJsonSerializer::Serialize(ToJsonObject().ToSharedRef(), Writer);
 	
 	EASYJSON_DEBUG_SUCCESS(TEXT("ToString"), FString::Printf(TEXT("Generated JSON string (%d characters)"), OutputString.Len()));
 	
@@ -415,21 +699,22 @@ FString FEasyJsonObjectV2::ToString(bool bPrettyPrint) const
 
 TSharedPtr<FJsonObject> FEasyJsonObjectV2::ToJsonObject() const
 {
-	return InnerObject;
+	// A document view is copied; the document itself is immutable
+	return Document.IsValid() ? Document->ToJsonObject(DocumentIndex) : InnerObject;
 }
 
 bool FEasyJsonObjectV2::operator==(const FEasyJsonObjectV2& Other) const
 {
 	// If both objects are the same pointer, they're equal
-	if (InnerObject == Other.InnerObject)
+	if (InnerObject == Other.InnerObject && Document == Other.Document && DocumentIndex == Other.DocumentIndex)
 	{
 		return true;
 	}
 	
 	// If either object is null, they're only equal if both are null
-	if (!InnerObject.IsValid() || !Other.InnerObject.IsValid())
+	if (!IsValid() || !Other.IsValid())
 	{
-		return !InnerObject.IsValid() && !Other.InnerObject.IsValid();
+		return !IsValid() && !Other.IsValid();
 	}
 	
 	// Convert both to compact JSON strings and compare
@@ -444,184 +729,215 @@ bool FEasyJsonObjectV2::operator!=(const FEasyJsonObjectV2& Other) const
 	return !(*this == Other);
 }
 
-FEasyJsonValueV2 FEasyJsonObjectV2::ReadEasyJsonValue(const FString& AccessString) const
+void FEasyJsonObjectV2::DetachFromDocument()
+{
+	if (Document.IsValid())
+	{
+		EASYJSON_DEBUG_LOG(TEXT("DetachFromDocument"), TEXT("Copy"), TEXT("Writing to a document view copies it into an engine JSON tree"));
+		InnerObject = Document->ToJsonObject(DocumentIndex);
+		Document.Reset();
+		DocumentIndex = INDEX_NONE;
+	}
+}
+
+FEasyJsonValueV2 FEasyJsonObjectV2::FindField(const FAccessStep& Step) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadEasyJsonValue(%s)"), *AccessString));
+	if (Document.IsValid())
+	{
+		const int32 FieldIndex = Document->FindField(DocumentIndex, Step.PropertyName, Step.PropertyNameHash);
+		return FieldIndex != INDEX_NONE ? FEasyJsonValueV2(Document, FieldIndex) : FEasyJsonValueV2();
+	}
+	
+	if (!InnerObject.IsValid())
+	{
+		return FEasyJsonValueV2();
+	}
+	
+	// The step carries the same hash the field map uses, so the name is not hashed again
+	const TSharedPtr<FJsonValue>* Field = InnerObject->Values.FindByHash(Step.PropertyNameHash, Step.PropertyName);
+	return Field != nullptr ? FEasyJsonValueV2(*Field) : FEasyJsonValueV2();
+}
+
+FEasyJsonValueV2 FEasyJsonObjectV2::ReadEasyJsonValue(const FEasyJsonPathV2& Path) const
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadEasyJsonValue(%s)"), *Path.GetAccessString()));
 	
 	if (!IsValid())
 	{
-		EASYJSON_DEBUG_ERROR(AccessString, TEXT("InvalidObject"), TEXT("JSON object is not valid"));
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("InvalidObject"), TEXT("JSON object is not valid"));
 		return FEasyJsonValueV2();
 	}
 	
 	// Check if this contains multi-dimensional array access
-	if (FAdvancedAccessParser::ContainsArrayAccess(AccessString) && 
-		FAdvancedAccessParser::GetMaxArrayDepth(AccessString) > 1)
+	if (Path.GetMaxArrayDepth() > 1)
 	{
 		// Use advanced parser for multi-dimensional arrays
-		return ReadEasyJsonValueAdvanced(AccessString);
+		return ReadEasyJsonValueAdvanced(Path);
 	}
 	
-	TArray<FString> Accessers;
-	AccessString.ParseIntoArray(Accessers, TEXT("."), true);
+	const TArray<FAccessStep>& Steps = Path.GetSteps();
 	
 	// Log access string parsing
-	FEasyJsonV2DebugLogger::LogAccessParsing(AccessString, Accessers);
+	FEasyJsonV2DebugLogger::LogAccessParsing(Path.GetAccessString(), Steps);
 	
-	TSharedPtr<FJsonObject> ParentNode = InnerObject;
+	FEasyJsonObjectV2 ParentNode = *this;
 	
-	for (const FString& AccessName : Accessers)
+	for (int32 StepIndex = 0; StepIndex < Steps.Num(); ++StepIndex)
 	{
-		if (!ParentNode) break;
-		
-		TSharedPtr<FJsonObject> BeforeParentNode = ParentNode;
+		if (!ParentNode.IsValid()) break;
 		
-		FString PropertyName;
-		int32 ArrayIndex = 0;
-		bool bIsArray = IsAccessAsArray(AccessName, PropertyName, ArrayIndex);
+		const FAccessStep& Step = Steps[StepIndex];
 		
-		if (ParentNode->HasField(PropertyName))
+		if (StepIndex < Steps.Num() - 1)
 		{
-			if (AccessName.Equals(Accessers.Last()))
-			{
-				// Get the value
-				TSharedPtr<FJsonValue> Value = ParentNode->TryGetField(PropertyName);
-				
-				if (Value.IsValid() && Value->Type == EJson::Array)
-				{
-					const TArray<TSharedPtr<FJsonValue>>* ArrayValue;
-					if (Value->TryGetArray(ArrayValue) && ArrayIndex < ArrayValue->Num())
-					{
-						return FEasyJsonValueV2((*ArrayValue)[ArrayIndex]);
-					}
-				}
-				else
-				{
-					return FEasyJsonValueV2(Value);
-				}
-			}
-			else
-			{
-				TArray<TSharedPtr<FJsonObject>> Objects;
-				GetObject(ParentNode, PropertyName, Objects);
-				
-				if (Objects.Num() > 0 && ArrayIndex < Objects.Num())
-				{
-					ParentNode = Objects[ArrayIndex];
-				}
-			}
+			ParentNode = ResolveChildObject(ParentNode, Step);
+			continue;
 		}
 		
-		if (ParentNode == BeforeParentNode)
+		// Get the value
+		FEasyJsonValueV2 Value = ParentNode.FindField(Step);
+		if (!Value.IsValid())
 		{
 			break;
 		}
+		
+		if (Value.IsArray())
+		{
+			const int32 ArrayIndex = Step.ArrayIndices.Num() > 0 ? Step.ArrayIndices[0] : 0;
+			return Value.GetArrayElement(ArrayIndex);
+		}
+		else
+		{
+			return Value;
+		}
 	}
 	
 	return FEasyJsonValueV2();
 }
 
-bool FEasyJsonObjectV2::IsAccessAsArray(const FString& AccessName, FString& ElementName, int32& ArrayIndex) const
+FEasyJsonObjectV2 FEasyJsonObjectV2::ResolveChildObject(const FEasyJsonObjectV2& ParentObject, const FAccessStep& Step) const
 {
-	const FRegexPattern Pattern = FRegexPattern(FString(TEXT("(.*)\\[([0-9]+)\\]$")));
-	FRegexMatcher Matcher(Pattern, AccessName);
+	FEasyJsonValueV2 Value = ParentObject.FindField(Step);
+	if (!Value.IsValid())
+	{
+		return FEasyJsonObjectV2();
+	}
 	
-	if (Matcher.FindNext())
+	if (Step.ArrayIndices.Num() > 1)
+	{
+		Value = NavigateToArrayElement(Value, Step.ArrayIndices);
+	}
+	else
 	{
-		ElementName = Matcher.GetCaptureGroup(1);
+		const int32 ArrayIndex = Step.ArrayIndices.Num() > 0 ? Step.ArrayIndices[0] : 0;
 		
-		FString NumStr = Matcher.GetCaptureGroup(2);
-		if (NumStr.IsNumeric())
+		if (Value.IsArray())
 		{
-			ArrayIndex = FCString::Atoi(*NumStr);
+			Value = Value.GetArrayElement(ArrayIndex);
+		}
+		else if (ArrayIndex != 0)
+		{
+			// A single object only answers to index 0
+			return FEasyJsonObjectV2();
 		}
-		
-		return true;
 	}
 	
-	ElementName = AccessName;
-	ArrayIndex = 0;
-	
-	return false;
+	return Value.GetObjectValue();
 }
 
-void FEasyJsonObjectV2::GetObject(const TSharedPtr<FJsonObject> TargetObject, const FString& PropertyName, TArray<TSharedPtr<FJsonObject>>& Objects) const
+void FEasyJsonObjectV2::GetObject(const FEasyJsonObjectV2& TargetObject, const FAccessStep& Step, TArray<FEasyJsonObjectV2>& Objects) const
 {
-	if (!TargetObject->HasField(PropertyName)) return;
+	const FEasyJsonValueV2 Value = TargetObject.FindField(Step);
+	if (!Value.IsValid()) return;
 	
-	const TArray<TSharedPtr<FJsonValue>>* JsonArrayValue;
-	if (TargetObject->TryGetArrayField(PropertyName, JsonArrayValue))
+	if (Value.IsArray())
 	{
-		for (const TSharedPtr<FJsonValue>& ArrayValue : *JsonArrayValue)
+		// Elements that are not objects are returned as invalid objects
+		for (const FEasyJsonValueV2& ArrayValue : Value.GetArrayElements())
 		{
-			const TSharedPtr<FJsonObject>* ObjectValueInArray;
-			if (ArrayValue->TryGetObject(ObjectValueInArray))
-			{
-				Objects.Add(*ObjectValueInArray);
-			}
-			else
-			{
-				Objects.Add(nullptr);
-			}
+			Objects.Add(ArrayValue.GetObjectValue());
 		}
 	}
 	else
 	{
-		const TSharedPtr<FJsonObject>* ObjectValue;
-		if (TargetObject->TryGetObjectField(PropertyName, ObjectValue))
+		FEasyJsonObjectV2 ObjectValue = Value.GetObjectValue();
+		if (ObjectValue.IsValid())
 		{
-			Objects.Add(*ObjectValue);
+			Objects.Add(MoveTemp(ObjectValue));
 		}
 	}
 }
 
-TSharedPtr<FJsonObject> FEasyJsonObjectV2::CreateOrGetObject(const FString& AccessString)
+FEasyJsonObjectV2 FEasyJsonObjectV2::Cursor(const FString& AccessString)
+{
+	return Cursor(FEasyJsonPathV2(AccessString));
+}
+
+FEasyJsonObjectV2 FEasyJsonObjectV2::Cursor(const FEasyJsonPathV2& Path)
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("Cursor(%s)"), *Path.GetAccessString()));
+	
+	if (!Path.IsValid())
+	{
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("EmptyPath"), TEXT("Access string is empty"));
+		return FEasyJsonObjectV2();
+	}
+	
+	if (Path.GetMaxArrayDepth() > 1)
+	{
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("UnsupportedPath"), TEXT("Multi-dimensional indices are not supported by cursors"));
+		return FEasyJsonObjectV2();
+	}
+	
+	// The cursor shares the nested object, so its reads and writes start there
+	const TSharedPtr<FJsonObject> Object = CreateOrGetObject(Path.GetSteps(), true);
+	if (!Object.IsValid())
+	{
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("CursorFailed"), TEXT("A value on the path is not an object"));
+		return FEasyJsonObjectV2();
+	}
+	
+	EASYJSON_DEBUG_SUCCESS(TEXT("Cursor"), FString::Printf(TEXT("Cursor at '%s'"), *Path.GetAccessString()));
+	return FEasyJsonObjectV2(Object);
+}
+
+TSharedPtr<FJsonObject> FEasyJsonObjectV2::CreateOrGetObject(TArrayView<const FAccessStep> Steps, bool bStrict)
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("CreateOrGetObject(%s)"), *AccessString));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("CreateOrGetObject(%d steps)"), Steps.Num()));
+	
+	DetachFromDocument();
 	
 	if (!IsValid())
 	{
 		InnerObject = MakeShareable(new FJsonObject());
 	}
 	
-	TArray<FString> Accessers;
-	AccessString.ParseIntoArray(Accessers, TEXT("."), true);
-	
 	TSharedPtr<FJsonObject> CurrentObject = InnerObject;
 	
-	for (int32 i = 0; i < Accessers.Num(); ++i)
+	for (int32 i = 0; i < Steps.Num(); ++i)
 	{
-		const FString& AccessName = Accessers[i];
-		
-		FString PropertyName;
-		int32 ArrayIndex = 0;
-		bool bIsArray = IsAccessAsArray(AccessName, PropertyName, ArrayIndex);
+		const FAccessStep& Step = Steps[i];
+		const FString& PropertyName = Step.PropertyName;
+		const bool bIsArray = Step.bIsArrayAccess;
+		const int32 ArrayIndex = bIsArray ? Step.ArrayIndices[0] : 0;
 		
-		EASYJSON_DEBUG_LOG(TEXT("CreateOrGetObject"), TEXT("Processing"), FString::Printf(TEXT("Level %d: %s (Property: %s, IsArray: %s, Index: %d)"), i, *AccessName, *PropertyName, bIsArray ? TEXT("true") : TEXT("false"), ArrayIndex));
+		EASYJSON_DEBUG_LOG(TEXT("CreateOrGetObject"), TEXT("Processing"), FString::Printf(TEXT("Level %d: Property: %s, IsArray: %s, Index: %d"), i, *PropertyName, bIsArray ? TEXT("true") : TEXT("false"), ArrayIndex));
 		
 		// Check if property already exists
-		if (!CurrentObject->HasField(PropertyName))
+		TSharedPtr<FJsonValue>* Field = CurrentObject->Values.FindByHash(Step.PropertyNameHash, PropertyName);
+		if (Field == nullptr || !Field->IsValid())
 		{
 			EASYJSON_DEBUG_LOG(TEXT("CreateOrGetObject"), TEXT("Creating"), FString::Printf(TEXT("Property '%s' does not exist, creating it"), *PropertyName));
 			
-			// Create new object or array based on the next accessor
-			bool bNextIsArray = false;
-			if (i + 1 < Accessers.Num())
-			{
-				FString NextPropertyName;
-				int32 NextArrayIndex = 0;
-				bNextIsArray = IsAccessAsArray(Accessers[i + 1], NextPropertyName, NextArrayIndex);
-			}
-			
 			if (bIsArray)
 			{
 				EASYJSON_DEBUG_LOG(TEXT("CreateOrGetObject"), TEXT("Creating"), FString::Printf(TEXT("Creating array '%s' with %d elements"), *PropertyName, ArrayIndex + 1));
-				// Create array
+				// Create array; elements below the last step are objects to descend into
 				TArray<TSharedPtr<FJsonValue>> NewArray;
-				// Expand array to required size
+				NewArray.Reserve(ArrayIndex + 1);
 				for (int32 j = 0; j <= ArrayIndex; ++j)
 				{
-					if (bNextIsArray || i + 1 < Accessers.Num())
+					if (i + 1 < Steps.Num())
 					{
 						NewArray.Add(MakeShareable(new FJsonValueObject(MakeShareable(new FJsonObject()))));
 					}
@@ -630,14 +946,13 @@ TSharedPtr<FJsonObject> FEasyJsonObjectV2::CreateOrGetObject(const FString& Acce
 						NewArray.Add(MakeShareable(new FJsonValueNull()));
 					}
 				}
-				CurrentObject->SetArrayField(PropertyName, NewArray);
+				Field = &CurrentObject->Values.AddByHash(Step.PropertyNameHash, PropertyName, MakeShareable(new FJsonValueArray(MoveTemp(NewArray))));
 			}
 			else
 			{
 				EASYJSON_DEBUG_LOG(TEXT("CreateOrGetObject"), TEXT("Creating"), FString::Printf(TEXT("Creating object '%s'"), *PropertyName));
 				// Create object
-				TSharedPtr<FJsonObject> NewObject = MakeShareable(new FJsonObject());
-				CurrentObject->SetObjectField(PropertyName, NewObject);
+				Field = &CurrentObject->Values.AddByHash(Step.PropertyNameHash, PropertyName, MakeShareable(new FJsonValueObject(MakeShareable(new FJsonObject()))));
 			}
 		}
 		else
@@ -646,146 +961,122 @@ TSharedPtr<FJsonObject> FEasyJsonObjectV2::CreateOrGetObject(const FString& Acce
 		}
 		
 		// Navigate to next level
+		const TSharedPtr<FJsonObject>* ObjectPtr;
 		if (bIsArray)
 		{
-			const TArray<TSharedPtr<FJsonValue>>* ArrayValue;
-			if (CurrentObject->TryGetArrayField(PropertyName, ArrayValue))
+			// The stored array is expanded and its element replaced in place
+			TArray<TSharedPtr<FJsonValue>>* ArrayValue = nullptr;
+			if ((*Field)->TryGetArray(ArrayValue))
 			{
-				// Expand array if necessary
-				if (ArrayIndex >= ArrayValue->Num())
+				EasyJsonObject::PadArray(*ArrayValue, ArrayIndex);
+				
+				TSharedPtr<FJsonValue>& Element = (*ArrayValue)[ArrayIndex];
+				if (Element.IsValid() && Element->Type == EJson::Object && Element->TryGetObject(ObjectPtr))
 				{
-					// Need to expand array
-					TArray<TSharedPtr<FJsonValue>> ExpandedArray = *ArrayValue;
-					while (ExpandedArray.Num() <= ArrayIndex)
-					{
-						ExpandedArray.Add(MakeShareable(new FJsonValueNull()));
-					}
-					CurrentObject->SetArrayField(PropertyName, ExpandedArray);
-					
-					// Get updated array
-					CurrentObject->TryGetArrayField(PropertyName, ArrayValue);
+					CurrentObject = *ObjectPtr;
 				}
-				
-				if (ArrayIndex < ArrayValue->Num())
+				else if (bStrict && Element.IsValid() && Element->Type != EJson::Null)
 				{
-					if ((*ArrayValue)[ArrayIndex]->Type == EJson::Object)
-					{
-						const TSharedPtr<FJsonObject>* ObjectPtr;
-						if ((*ArrayValue)[ArrayIndex]->TryGetObject(ObjectPtr))
-						{
-							CurrentObject = *ObjectPtr;
-						}
-					}
-					else
-					{
-						// Replace with object
-						TSharedPtr<FJsonObject> NewObject = MakeShareable(new FJsonObject());
-						TArray<TSharedPtr<FJsonValue>> ModifiedArray = *ArrayValue;
-						ModifiedArray[ArrayIndex] = MakeShareable(new FJsonValueObject(NewObject));
-						CurrentObject->SetArrayField(PropertyName, ModifiedArray);
-						CurrentObject = NewObject;
-					}
+					EASYJSON_DEBUG_ERROR(PropertyName, TEXT("NotAnObject"), FString::Printf(TEXT("Element %d is not an object"), ArrayIndex));
+					return nullptr;
+				}
+				else
+				{
+					// Replace with object
+					TSharedPtr<FJsonObject> NewObject = MakeShareable(new FJsonObject());
+					Element = MakeShareable(new FJsonValueObject(NewObject));
+					CurrentObject = NewObject;
 				}
 			}
-		}
-		else
-		{
-			const TSharedPtr<FJsonObject>* ObjectPtr;
-			if (CurrentObject->TryGetObjectField(PropertyName, ObjectPtr))
+			else if (bStrict)
 			{
-				CurrentObject = *ObjectPtr;
+				EASYJSON_DEBUG_ERROR(PropertyName, TEXT("NotAnArray"), TEXT("Property exists but is not an array"));
+				return nullptr;
 			}
 		}
+		else if ((*Field)->TryGetObject(ObjectPtr))
+		{
+			CurrentObject = *ObjectPtr;
+		}
+		else if (bStrict)
+		{
+			EASYJSON_DEBUG_ERROR(PropertyName, TEXT("NotAnObject"), TEXT("Property exists but is not an object"));
+			return nullptr;
+		}
 	}
 	
 	return CurrentObject;
 }
 
-TSharedPtr<FJsonValue> FEasyJsonObjectV2::CreateValue(const FString& AccessString, TSharedPtr<FJsonValue> NewValue)
+TSharedPtr<FJsonValue> FEasyJsonObjectV2::CreateValue(const FEasyJsonPathV2& Path, TSharedPtr<FJsonValue> NewValue)
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("CreateValue(%s)"), *AccessString));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("CreateValue(%s)"), *Path.GetAccessString()));
+	
+	DetachFromDocument();
 	
 	if (!IsValid())
 	{
 		InnerObject = MakeShareable(new FJsonObject());
 	}
 	
-	TArray<FString> Accessers;
-	AccessString.ParseIntoArray(Accessers, TEXT("."), true);
-	
-	if (Accessers.Num() == 0)
+	if (!Path.IsValid())
 	{
-		EASYJSON_DEBUG_ERROR(AccessString, TEXT("EmptyPath"), TEXT("Access string is empty"));
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("EmptyPath"), TEXT("Access string is empty"));
 		return nullptr;
 	}
 	
-	// Get the parent object that should contain the final property
-	FString ParentPath;
-	for (int32 i = 0; i < Accessers.Num() - 1; ++i)
+	if (Path.GetMaxArrayDepth() > 1)
 	{
-		if (i > 0) ParentPath += TEXT(".");
-		ParentPath += Accessers[i];
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("UnsupportedPath"), TEXT("Multi-dimensional indices are not supported when writing"));
+		return nullptr;
 	}
 	
-	EASYJSON_DEBUG_LOG(TEXT("CreateValue"), TEXT("Processing"), FString::Printf(TEXT("ParentPath: '%s', FinalProperty: '%s'"), *ParentPath, *Accessers.Last()));
+	const FAccessStep& FinalStep = Path.GetLastStep();
+	
+	EASYJSON_DEBUG_LOG(TEXT("CreateValue"), TEXT("Processing"), FString::Printf(TEXT("ParentSteps: %d, FinalProperty: '%s'"), Path.Num() - 1, *FinalStep.PropertyName));
 	
+	// Get the parent object that should contain the final property
 	TSharedPtr<FJsonObject> ParentObject;
-	if (ParentPath.IsEmpty())
+	if (Path.Num() == 1)
 	{
 		EASYJSON_DEBUG_LOG(TEXT("CreateValue"), TEXT("Root"), TEXT("Using root object as parent"));
 		ParentObject = InnerObject;
 	}
 	else
 	{
-		EASYJSON_DEBUG_LOG(TEXT("CreateValue"), TEXT("Calling"), FString::Printf(TEXT("CreateOrGetObject('%s')"), *ParentPath));
-		ParentObject = CreateOrGetObject(ParentPath);
+		ParentObject = CreateOrGetObject(Path.GetParentSteps());
 	}
 	
 	if (!ParentObject.IsValid())
 	{
-		EASYJSON_DEBUG_ERROR(AccessString, TEXT("ParentObjectInvalid"), TEXT("Failed to create or get parent object"));
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("ParentObjectInvalid"), TEXT("Failed to create or get parent object"));
 		return nullptr;
 	}
 	
 	EASYJSON_DEBUG_LOG(TEXT("CreateValue"), TEXT("ParentObject"), TEXT("Successfully obtained parent object"));
 	
 	// Set the final property
-	const FString& FinalAccessor = Accessers.Last();
-	FString PropertyName;
-	int32 ArrayIndex = 0;
-	bool bIsArray = IsAccessAsArray(FinalAccessor, PropertyName, ArrayIndex);
+	const FString& PropertyName = FinalStep.PropertyName;
+	const bool bIsArray = FinalStep.bIsArrayAccess;
+	const int32 ArrayIndex = bIsArray ? FinalStep.ArrayIndices[0] : 0;
 	
 	EASYJSON_DEBUG_LOG(TEXT("CreateValue"), TEXT("FinalProperty"), FString::Printf(TEXT("Setting property '%s' (IsArray: %s, Index: %d)"), *PropertyName, bIsArray ? TEXT("true") : TEXT("false"), ArrayIndex));
 	
 	if (bIsArray)
 	{
 		EASYJSON_DEBUG_LOG(TEXT("CreateValue"), TEXT("Array"), FString::Printf(TEXT("Setting array element [%d] in property '%s'"), ArrayIndex, *PropertyName));
-		// Handle array assignment
-		const TArray<TSharedPtr<FJsonValue>>* ExistingArray;
-		TArray<TSharedPtr<FJsonValue>> ModifiedArray;
-		
-		if (ParentObject->TryGetArrayField(PropertyName, ExistingArray))
-		{
-			ModifiedArray = *ExistingArray;
-		}
-		
-		// Expand array if necessary
-		while (ModifiedArray.Num() <= ArrayIndex)
-		{
-			ModifiedArray.Add(MakeShareable(new FJsonValueNull()));
-		}
-		
-		// Set the value
-		ModifiedArray[ArrayIndex] = NewValue;
-		ParentObject->SetArrayField(PropertyName, ModifiedArray);
+		// Handle array assignment in the stored array, expanding it if necessary
+		TArray<TSharedPtr<FJsonValue>>& Array = EasyJsonObject::FindOrAddArrayField(*ParentObject, FinalStep);
+		EasyJsonObject::PadArray(Array, ArrayIndex);
+		Array[ArrayIndex] = NewValue;
 		
 		EASYJSON_DEBUG_SUCCESS(TEXT("CreateValue"), FString::Printf(TEXT("Successfully set array element [%d] in property '%s'"), ArrayIndex, *PropertyName));
 		return NewValue;
 	}
 	else
 	{
-		// Handle direct property assignment
-		ParentObject->SetField(PropertyName, NewValue);
+		// Handle direct property assignment, reusing the step's precomputed name hash
+		ParentObject->Values.AddByHash(FinalStep.PropertyNameHash, PropertyName, NewValue);
 		EASYJSON_DEBUG_SUCCESS(TEXT("CreateValue"), FString::Printf(TEXT("Successfully set property '%s'"), *PropertyName));
 		return NewValue;
 	}
@@ -795,103 +1086,115 @@ TSharedPtr<FJsonValue> FEasyJsonObjectV2::CreateValue(const FString& AccessStrin
 
 int32 FEasyJsonObjectV2::GetArraySize(const FString& AccessString) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("GetArraySize(%s)"), *AccessString));
+	return GetArraySize(FEasyJsonPathV2(AccessString));
+}
+
+bool FEasyJsonObjectV2::IsArray(const FString& AccessString) const
+{
+	return IsArray(FEasyJsonPathV2(AccessString));
+}
+
+FEasyJsonValueV2 FEasyJsonObjectV2::SafeReadArrayElement(const FString& AccessString, int32 Index) const
+{
+	return SafeReadArrayElement(FEasyJsonPathV2(AccessString), Index);
+}
+
+TArray<FEasyJsonValueV2> FEasyJsonObjectV2::ReadArrayValues(const FString& AccessString) const
+{
+	return ReadArrayValues(FEasyJsonPathV2(AccessString));
+}
+
+int32 FEasyJsonObjectV2::GetArrayDimensions(const FString& AccessString) const
+{
+	return GetArrayDimensions(FEasyJsonPathV2(AccessString));
+}
+
+TArray<int32> FEasyJsonObjectV2::GetArrayDimensionSizes(const FString& AccessString) const
+{
+	return GetArrayDimensionSizes(FEasyJsonPathV2(AccessString));
+}
+
+int32 FEasyJsonObjectV2::GetArraySize(const FEasyJsonPathV2& Path) const
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("GetArraySize(%s)"), *Path.GetAccessString()));
 	
-	FEasyJsonValueV2 ArrayValue = ReadEasyJsonValueAdvanced(AccessString);
+	FEasyJsonValueV2 ArrayValue = ReadEasyJsonValueAdvanced(Path);
 	if (!ArrayValue.IsValid() || !ArrayValue.IsArray())
 	{
-		EASYJSON_DEBUG_ERROR(AccessString, TEXT("NotAnArray"), TEXT("Path does not point to a valid array"));
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("NotAnArray"), TEXT("Path does not point to a valid array"));
 		return 0;
 	}
 	
-	const TArray<TSharedPtr<FJsonValue>>* Array;
-	if (ArrayValue.GetJsonValue()->TryGetArray(Array))
-	{
-		int32 Size = Array->Num();
-		EASYJSON_DEBUG_SUCCESS(TEXT("GetArraySize"), FString::Printf(TEXT("Array size: %d"), Size));
-		return Size;
-	}
-	
-	return 0;
+	int32 Size = ArrayValue.GetArraySize();
+	EASYJSON_DEBUG_SUCCESS(TEXT("GetArraySize"), FString::Printf(TEXT("Array size: %d"), Size));
+	return Size;
 }
 
-bool FEasyJsonObjectV2::IsArray(const FString& AccessString) const
+bool FEasyJsonObjectV2::IsArray(const FEasyJsonPathV2& Path) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("IsArray(%s)"), *AccessString));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("IsArray(%s)"), *Path.GetAccessString()));
 	
-	FEasyJsonValueV2 Value = ReadEasyJsonValueAdvanced(AccessString);
+	FEasyJsonValueV2 Value = ReadEasyJsonValueAdvanced(Path);
 	bool bIsArray = Value.IsValid() && Value.IsArray();
 	
 	EASYJSON_DEBUG_SUCCESS(TEXT("IsArray"), FString::Printf(TEXT("Is array: %s"), bIsArray ? TEXT("true") : TEXT("false")));
 	return bIsArray;
 }
 
-FEasyJsonValueV2 FEasyJsonObjectV2::SafeReadArrayElement(const FString& AccessString, int32 Index) const
+FEasyJsonValueV2 FEasyJsonObjectV2::SafeReadArrayElement(const FEasyJsonPathV2& Path, int32 Index) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("SafeReadArrayElement(%s, %d)"), *AccessString, Index));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("SafeReadArrayElement(%s, %d)"), *Path.GetAccessString(), Index));
 	
-	FEasyJsonValueV2 ArrayValue = ReadEasyJsonValueAdvanced(AccessString);
+	FEasyJsonValueV2 ArrayValue = ReadEasyJsonValueAdvanced(Path);
 	if (!ArrayValue.IsValid() || !ArrayValue.IsArray())
 	{
-		EASYJSON_DEBUG_ERROR(AccessString, TEXT("NotAnArray"), TEXT("Path does not point to a valid array"));
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("NotAnArray"), TEXT("Path does not point to a valid array"));
 		return FEasyJsonValueV2();
 	}
 	
-	const TArray<TSharedPtr<FJsonValue>>* Array;
-	if (ArrayValue.GetJsonValue()->TryGetArray(Array))
+	FEasyJsonValueV2 Element = ArrayValue.GetArrayElement(Index);
+	if (Element.IsValid())
 	{
-		if (Index >= 0 && Index < Array->Num())
-		{
-			EASYJSON_DEBUG_SUCCESS(TEXT("SafeReadArrayElement"), FString::Printf(TEXT("Found element at index %d"), Index));
-			return FEasyJsonValueV2((*Array)[Index]);
-		}
-		else
-		{
-			EASYJSON_DEBUG_ERROR(AccessString, TEXT("IndexOutOfBounds"), FString::Printf(TEXT("Index %d is out of bounds (array size: %d)"), Index, Array->Num()));
-		}
+		EASYJSON_DEBUG_SUCCESS(TEXT("SafeReadArrayElement"), FString::Printf(TEXT("Found element at index %d"), Index));
+	}
+	else
+	{
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("IndexOutOfBounds"), FString::Printf(TEXT("Index %d is out of bounds (array size: %d)"), Index, ArrayValue.GetArraySize()));
 	}
 	
-	return FEasyJsonValueV2();
+	return Element;
 }
 
-TArray<FEasyJsonValueV2> FEasyJsonObjectV2::ReadArrayValues(const FString& AccessString) const
+TArray<FEasyJsonValueV2> FEasyJsonObjectV2::ReadArrayValues(const FEasyJsonPathV2& Path) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadArrayValues(%s)"), *AccessString));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadArrayValues(%s)"), *Path.GetAccessString()));
 	
 	TArray<FEasyJsonValueV2> Result;
 	
-	FEasyJsonValueV2 ArrayValue = ReadEasyJsonValueAdvanced(AccessString);
+	FEasyJsonValueV2 ArrayValue = ReadEasyJsonValueAdvanced(Path);
 	if (!ArrayValue.IsValid() || !ArrayValue.IsArray())
 	{
-		EASYJSON_DEBUG_ERROR(AccessString, TEXT("NotAnArray"), TEXT("Path does not point to a valid array"));
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("NotAnArray"), TEXT("Path does not point to a valid array"));
 		return Result;
 	}
 	
-	const TArray<TSharedPtr<FJsonValue>>* Array;
-	if (ArrayValue.GetJsonValue()->TryGetArray(Array))
-	{
-		for (const TSharedPtr<FJsonValue>& Element : *Array)
-		{
-			Result.Add(FEasyJsonValueV2(Element));
-		}
-		
-		EASYJSON_DEBUG_SUCCESS(TEXT("ReadArrayValues"), FString::Printf(TEXT("Read %d array elements"), Result.Num()));
-	}
+	Result = ArrayValue.GetArrayElements();
+	EASYJSON_DEBUG_SUCCESS(TEXT("ReadArrayValues"), FString::Printf(TEXT("Read %d array elements"), Result.Num()));
 	
 	return Result;
 }
 
-int32 FEasyJsonObjectV2::GetArrayDimensions(const FString& AccessString) const
+int32 FEasyJsonObjectV2::GetArrayDimensions(const FEasyJsonPathV2& Path) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("GetArrayDimensions(%s)"), *AccessString));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("GetArrayDimensions(%s)"), *Path.GetAccessString()));
 	
-	// Use the advanced parser to analyze the maximum array depth
-	int32 Dimensions = FAdvancedAccessParser::GetMaxArrayDepth(AccessString);
+	// The compiled path already knows the maximum array depth
+	int32 Dimensions = Path.GetMaxArrayDepth();
 	
 	// If no array access in the string, check if the target is an array
 	if (Dimensions == 0)
 	{
-		if (IsArray(AccessString))
+		if (IsArray(Path))
 		{
 			Dimensions = 1;
 		}
@@ -901,35 +1204,18 @@ int32 FEasyJsonObjectV2::GetArrayDimensions(const FString& AccessString) const
 	return Dimensions;
 }
 
-TArray<int32> FEasyJsonObjectV2::GetArrayDimensionSizes(const FString& AccessString) const
+TArray<int32> FEasyJsonObjectV2::GetArrayDimensionSizes(const FEasyJsonPathV2& Path) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("GetArrayDimensionSizes(%s)"), *AccessString));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("GetArrayDimensionSizes(%s)"), *Path.GetAccessString()));
 	
 	TArray<int32> DimensionSizes;
 	
-	// Start with the base array
-	FString CurrentPath = AccessString;
-	int32 CurrentSize = GetArraySize(CurrentPath);
-	
-	if (CurrentSize > 0)
+	// Start with the base array and follow the first element of each nested array
+	FEasyJsonValueV2 CurrentValue = ReadEasyJsonValueAdvanced(Path);
+	while (CurrentValue.IsArray() && CurrentValue.GetArraySize() > 0)
 	{
-		DimensionSizes.Add(CurrentSize);
-		
-		// Check first element for nested arrays
-		FString FirstElementPath = CurrentPath + TEXT("[0]");
-		while (IsArray(FirstElementPath))
-		{
-			int32 NestedSize = GetArraySize(FirstElementPath);
-			if (NestedSize > 0)
-			{
-				DimensionSizes.Add(NestedSize);
-				FirstElementPath += TEXT("[0]");
-			}
-			else
-			{
-				break;
-			}
-		}
+		DimensionSizes.Add(CurrentValue.GetArraySize());
+		CurrentValue = CurrentValue.GetArrayElement(0);
 	}
 	
 	EASYJSON_DEBUG_SUCCESS(TEXT("GetArrayDimensionSizes"), FString::Printf(TEXT("Found %d dimensions"), DimensionSizes.Num()));
@@ -940,120 +1226,174 @@ TArray<int32> FEasyJsonObjectV2::GetArrayDimensionSizes(const FString& AccessStr
 
 int32 FEasyJsonObjectV2::Read2DArrayInt(const FString& ArrayPath, int32 Row, int32 Col, int32 DefaultValue) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("Read2DArrayInt(%s, %d, %d)"), *ArrayPath, Row, Col));
-	
-	FString AccessString = FString::Printf(TEXT("%s[%d][%d]"), *ArrayPath, Row, Col);
-	return ReadInt(AccessString, DefaultValue);
+	return Read2DArrayInt(FEasyJsonPathV2(ArrayPath), Row, Col, DefaultValue);
 }
 
 float FEasyJsonObjectV2::Read2DArrayFloat(const FString& ArrayPath, int32 Row, int32 Col, float DefaultValue) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("Read2DArrayFloat(%s, %d, %d)"), *ArrayPath, Row, Col));
-	
-	FString AccessString = FString::Printf(TEXT("%s[%d][%d]"), *ArrayPath, Row, Col);
-	return ReadFloat(AccessString, DefaultValue);
+	return Read2DArrayFloat(FEasyJsonPathV2(ArrayPath), Row, Col, DefaultValue);
 }
 
 FString FEasyJsonObjectV2::Read2DArrayString(const FString& ArrayPath, int32 Row, int32 Col, const FString& DefaultValue) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("Read2DArrayString(%s, %d, %d)"), *ArrayPath, Row, Col));
-	
-	FString AccessString = FString::Printf(TEXT("%s[%d][%d]"), *ArrayPath, Row, Col);
-	return ReadString(AccessString, DefaultValue);
+	return Read2DArrayString(FEasyJsonPathV2(ArrayPath), Row, Col, DefaultValue);
 }
 
 bool FEasyJsonObjectV2::Read2DArrayBool(const FString& ArrayPath, int32 Row, int32 Col, bool DefaultValue) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("Read2DArrayBool(%s, %d, %d)"), *ArrayPath, Row, Col));
+	return Read2DArrayBool(FEasyJsonPathV2(ArrayPath), Row, Col, DefaultValue);
+}
+
+int32 FEasyJsonObjectV2::Read2DArrayInt(const FEasyJsonPathV2& ArrayPath, int32 Row, int32 Col, int32 DefaultValue) const
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("Read2DArrayInt(%s, %d, %d)"), *ArrayPath.GetAccessString(), Row, Col));
+	
+	const int32 Indices[] = { Row, Col };
+	return ReadArrayElementAdvanced(ArrayPath, Indices).GetIntValue(DefaultValue);
+}
+
+float FEasyJsonObjectV2::Read2DArrayFloat(const FEasyJsonPathV2& ArrayPath, int32 Row, int32 Col, float DefaultValue) const
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("Read2DArrayFloat(%s, %d, %d)"), *ArrayPath.GetAccessString(), Row, Col));
+	
+	const int32 Indices[] = { Row, Col };
+	return ReadArrayElementAdvanced(ArrayPath, Indices).GetFloatValue(DefaultValue);
+}
+
+FString FEasyJsonObjectV2::Read2DArrayString(const FEasyJsonPathV2& ArrayPath, int32 Row, int32 Col, const FString& DefaultValue) const
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("Read2DArrayString(%s, %d, %d)"), *ArrayPath.GetAccessString(), Row, Col));
 	
-	FString AccessString = FString::Printf(TEXT("%s[%d][%d]"), *ArrayPath, Row, Col);
-	return ReadBool(AccessString, DefaultValue);
+	const int32 Indices[] = { Row, Col };
+	return ReadArrayElementAdvanced(ArrayPath, Indices).GetStringValue(DefaultValue);
+}
+
+bool FEasyJsonObjectV2::Read2DArrayBool(const FEasyJsonPathV2& ArrayPath, int32 Row, int32 Col, bool DefaultValue) const
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("Read2DArrayBool(%s, %d, %d)"), *ArrayPath.GetAccessString(), Row, Col));
+	
+	const int32 Indices[] = { Row, Col };
+	return ReadArrayElementAdvanced(ArrayPath, Indices).GetBoolValue(DefaultValue);
 }
 
 // 3D array access methods
 
 int32 FEasyJsonObjectV2::Read3DArrayInt(const FString& ArrayPath, int32 X, int32 Y, int32 Z, int32 DefaultValue) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("Read3DArrayInt(%s, %d, %d, %d)"), *ArrayPath, X, Y, Z));
-	
-	FString AccessString = FString::Printf(TEXT("%s[%d][%d][%d]"), *ArrayPath, X, Y, Z);
-	return ReadInt(AccessString, DefaultValue);
+	return Read3DArrayInt(FEasyJsonPathV2(ArrayPath), X, Y, Z, DefaultValue);
 }
 
 float FEasyJsonObjectV2::Read3DArrayFloat(const FString& ArrayPath, int32 X, int32 Y, int32 Z, float DefaultValue) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("Read3DArrayFloat(%s, %d, %d, %d)"), *ArrayPath, X, Y, Z));
-	
-	FString AccessString = FString::Printf(TEXT("%s[%d][%d][%d]"), *ArrayPath, X, Y, Z);
-	return ReadFloat(AccessString, DefaultValue);
+	return Read3DArrayFloat(FEasyJsonPathV2(ArrayPath), X, Y, Z, DefaultValue);
 }
 
 FString FEasyJsonObjectV2::Read3DArrayString(const FString& ArrayPath, int32 X, int32 Y, int32 Z, const FString& DefaultValue) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("Read3DArrayString(%s, %d, %d, %d)"), *ArrayPath, X, Y, Z));
-	
-	FString AccessString = FString::Printf(TEXT("%s[%d][%d][%d]"), *ArrayPath, X, Y, Z);
-	return ReadString(AccessString, DefaultValue);
+	return Read3DArrayString(FEasyJsonPathV2(ArrayPath), X, Y, Z, DefaultValue);
 }
 
 bool FEasyJsonObjectV2::Read3DArrayBool(const FString& ArrayPath, int32 X, int32 Y, int32 Z, bool DefaultValue) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("Read3DArrayBool(%s, %d, %d, %d)"), *ArrayPath, X, Y, Z));
+	return Read3DArrayBool(FEasyJsonPathV2(ArrayPath), X, Y, Z, DefaultValue);
+}
+
+int32 FEasyJsonObjectV2::Read3DArrayInt(const FEasyJsonPathV2& ArrayPath, int32 X, int32 Y, int32 Z, int32 DefaultValue) const
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("Read3DArrayInt(%s, %d, %d, %d)"), *ArrayPath.GetAccessString(), X, Y, Z));
 	
-	FString AccessString = FString::Printf(TEXT("%s[%d][%d][%d]"), *ArrayPath, X, Y, Z);
-	return ReadBool(AccessString, DefaultValue);
+	const int32 Indices[] = { X, Y, Z };
+	return ReadArrayElementAdvanced(ArrayPath, Indices).GetIntValue(DefaultValue);
+}
+
+float FEasyJsonObjectV2::Read3DArrayFloat(const FEasyJsonPathV2& ArrayPath, int32 X, int32 Y, int32 Z, float DefaultValue) const
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("Read3DArrayFloat(%s, %d, %d, %d)"), *ArrayPath.GetAccessString(), X, Y, Z));
+	
+	const int32 Indices[] = { X, Y, Z };
+	return ReadArrayElementAdvanced(ArrayPath, Indices).GetFloatValue(DefaultValue);
+}
+
+FString FEasyJsonObjectV2::Read3DArrayString(const FEasyJsonPathV2& ArrayPath, int32 X, int32 Y, int32 Z, const FString& DefaultValue) const
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("Read3DArrayString(%s, %d, %d, %d)"), *ArrayPath.GetAccessString(), X, Y, Z));
+	
+	const int32 Indices[] = { X, Y, Z };
+	return ReadArrayElementAdvanced(ArrayPath, Indices).GetStringValue(DefaultValue);
+}
+
+bool FEasyJsonObjectV2::Read3DArrayBool(const FEasyJsonPathV2& ArrayPath, int32 X, int32 Y, int32 Z, bool DefaultValue) const
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("Read3DArrayBool(%s, %d, %d, %d)"), *ArrayPath.GetAccessString(), X, Y, Z));
+	
+	const int32 Indices[] = { X, Y, Z };
+	return ReadArrayElementAdvanced(ArrayPath, Indices).GetBoolValue(DefaultValue);
 }
 
 // Multi-dimensional array access
 
 FEasyJsonValueV2 FEasyJsonObjectV2::ReadMultiDimensionalArray(const FString& ArrayPath, const TArray<int32>& Indices) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadMultiDimensionalArray(%s, %d indices)"), *ArrayPath, Indices.Num()));
-	
-	FString AccessString = ArrayPath;
-	for (int32 Index : Indices)
-	{
-		AccessString += FString::Printf(TEXT("[%d]"), Index);
-	}
+	return ReadMultiDimensionalArray(FEasyJsonPathV2(ArrayPath), Indices);
+}
+
+FEasyJsonValueV2 FEasyJsonObjectV2::ReadMultiDimensionalArray(const FEasyJsonPathV2& ArrayPath, const TArray<int32>& Indices) const
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadMultiDimensionalArray(%s, %d indices)"), *ArrayPath.GetAccessString(), Indices.Num()));
 	
-	return ReadEasyJsonValueAdvanced(AccessString);
+	return ReadArrayElementAdvanced(ArrayPath, Indices);
 }
 
 // Advanced access methods using new parser
 
-FEasyJsonValueV2 FEasyJsonObjectV2::ReadEasyJsonValueAdvanced(const FString& AccessString) const
+FEasyJsonValueV2 FEasyJsonObjectV2::ReadEasyJsonValueAdvanced(const FEasyJsonPathV2& Path) const
 {
-	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadEasyJsonValueAdvanced(%s)"), *AccessString));
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("ReadEasyJsonValueAdvanced(%s)"), *Path.GetAccessString()));
 	
 	if (!IsValid())
 	{
-		EASYJSON_DEBUG_ERROR(AccessString, TEXT("InvalidObject"), TEXT("JSON object is not valid"));
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("InvalidObject"), TEXT("JSON object is not valid"));
 		return FEasyJsonValueV2();
 	}
 	
-	// Use the advanced parser for complex array access
-	TArray<FAccessStep> Steps = FAdvancedAccessParser::ParseAccessString(AccessString);
-	if (Steps.Num() == 0)
+	if (!Path.IsValid())
 	{
-		EASYJSON_DEBUG_ERROR(AccessString, TEXT("ParseFailed"), TEXT("Failed to parse access string"));
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("ParseFailed"), TEXT("Failed to parse access string"));
 		return FEasyJsonValueV2();
 	}
 	
-	TSharedPtr<FJsonValue> Value = NavigateToValue(Steps);
+	FEasyJsonValueV2 Value = NavigateToValue(Path.GetSteps());
 	if (Value.IsValid())
 	{
 		EASYJSON_DEBUG_SUCCESS(TEXT("ReadEasyJsonValueAdvanced"), TEXT("Successfully navigated to value"));
-		return FEasyJsonValueV2(Value);
+		return Value;
 	}
 	
-	EASYJSON_DEBUG_ERROR(AccessString, TEXT("NavigationFailed"), TEXT("Failed to navigate to specified path"));
+	EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("NavigationFailed"), TEXT("Failed to navigate to specified path"));
 	return FEasyJsonValueV2();
 }
 
-TSharedPtr<FJsonValue> FEasyJsonObjectV2::NavigateToValue(const TArray<FAccessStep>& Steps) const
+FEasyJsonValueV2 FEasyJsonObjectV2::ReadArrayElementAdvanced(const FEasyJsonPathV2& ArrayPath, TArrayView<const int32> Indices) const
 {
-	TSharedPtr<FJsonObject> CurrentObject = InnerObject;
-	TSharedPtr<FJsonValue> CurrentValue;
+	FEasyJsonValueV2 ArrayValue = ReadEasyJsonValueAdvanced(ArrayPath);
+	if (!ArrayValue.IsValid())
+	{
+		return FEasyJsonValueV2();
+	}
+	
+	FEasyJsonValueV2 Element = NavigateToArrayElement(ArrayValue, Indices);
+	if (!Element.IsValid())
+	{
+		EASYJSON_DEBUG_ERROR(ArrayPath.GetAccessString(), TEXT("IndexOutOfBounds"), TEXT("Check the array indices against the array dimensions"));
+	}
+	
+	return Element;
+}
+
+FEasyJsonValueV2 FEasyJsonObjectV2::NavigateToValue(TArrayView<const FAccessStep> Steps) const
+{
+	FEasyJsonObjectV2 CurrentObject = *this;
+	FEasyJsonValueV2 CurrentValue;
 	
 	for (int32 StepIndex = 0; StepIndex < Steps.Num(); StepIndex++)
 	{
@@ -1061,14 +1401,14 @@ TSharedPtr<FJsonValue> FEasyJsonObjectV2::NavigateToValue(const TArray<FAccessSt
 		
 		if (!CurrentObject.IsValid())
 		{
-			return nullptr;
+			return FEasyJsonValueV2();
 		}
 		
 		// Get the property value
-		CurrentValue = CurrentObject->TryGetField(Step.PropertyName);
+		CurrentValue = CurrentObject.FindField(Step);
 		if (!CurrentValue.IsValid())
 		{
-			return nullptr;
+			return FEasyJsonValueV2();
 		}
 		
 		// Handle array indices if present
@@ -1077,7 +1417,7 @@ TSharedPtr<FJsonValue> FEasyJsonObjectV2::NavigateToValue(const TArray<FAccessSt
 			CurrentValue = NavigateToArrayElement(CurrentValue, Step.ArrayIndices);
 			if (!CurrentValue.IsValid())
 			{
-				return nullptr;
+				return FEasyJsonValueV2();
 			}
 		}
 		
@@ -1088,48 +1428,33 @@ TSharedPtr<FJsonValue> FEasyJsonObjectV2::NavigateToValue(const TArray<FAccessSt
 		}
 		
 		// Otherwise, the value should be an object for the next step
-		const TSharedPtr<FJsonObject>* NextObject;
-		if (CurrentValue->TryGetObject(NextObject))
-		{
-			CurrentObject = *NextObject;
-		}
-		else
+		CurrentObject = CurrentValue.GetObjectValue();
+		if (!CurrentObject.IsValid())
 		{
-			return nullptr;
+			return FEasyJsonValueV2();
 		}
 	}
 	
 	return CurrentValue;
 }
 
-TSharedPtr<FJsonValue> FEasyJsonObjectV2::NavigateToArrayElement(TSharedPtr<FJsonValue> ArrayValue, const TArray<int32>& Indices) const
+FEasyJsonValueV2 FEasyJsonObjectV2::NavigateToArrayElement(const FEasyJsonValueV2& ArrayValue, TArrayView<const int32> Indices) const
 {
-	TSharedPtr<FJsonValue> CurrentValue = ArrayValue;
+	FEasyJsonValueV2 CurrentValue = ArrayValue;
 	
 	for (int32 Index : Indices)
 	{
-		if (!CurrentValue.IsValid())
+		if (!CurrentValue.IsArray())
 		{
-			return nullptr;
+			return FEasyJsonValueV2();
 		}
 		
-		const TArray<TSharedPtr<FJsonValue>>* Array;
-		if (CurrentValue->TryGetArray(Array))
-		{
-			if (Index >= 0 && Index < Array->Num())
-			{
-				CurrentValue = (*Array)[Index];
-			}
-			else
-			{
-				return nullptr;
-			}
-		}
-		else
+		CurrentValue = CurrentValue.GetArrayElement(Index);
+		if (!CurrentValue.IsValid())
 		{
-			return nullptr;
+			return FEasyJsonValueV2();
 		}
 	}
 	
 	return CurrentValue;
-}
\ No newline at end of file
+}
@@ -1,34 +1,185 @@
 // Copyright 2025 ayumax. All Rights Reserved.
 
 #include "EasyJsonParseManagerV2.h"
+#include "EasyJsonDocumentCacheV2.h"
+#include "EasyJsonWriterV2.h"
+#include "Async/ParallelFor.h"
 #include "HAL/PlatformFileManager.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include <atomic>
 
-FEasyJsonObjectV2 UEasyJsonParseManagerV2::LoadFromFile(const FString& FilePath, bool IsAbsolute, bool& bSuccess, FString& ErrorMessage)
+namespace EasyJsonParseManager
+{
+	// UTF-16 files (either byte order) start with a BOM
+	bool IsUtf16(TArrayView<const uint8> Bytes)
+	{
+		return Bytes.Num() >= 2 && ((Bytes[0] == 0xFF && Bytes[1] == 0xFE) || (Bytes[0] == 0xFE && Bytes[1] == 0xFF));
+	}
+	
+	// Read the raw bytes of a file (parsed as UTF-8 without widening to FString)
+	bool LoadFileBytes(const FString& AbsolutePath, TArray<uint8>& OutBytes, FString& OutErrorMessage)
+	{
+		if (!FPlatformFileManager::Get().GetPlatformFile().FileExists(*AbsolutePath))
+		{
+			OutErrorMessage = FString::Printf(TEXT("File not found: %s"), *AbsolutePath);
+			return false;
+		}
+		
+		if (!FFileHelper::LoadFileToArray(OutBytes, *AbsolutePath))
+		{
+			OutErrorMessage = FString::Printf(TEXT("Failed to read file: %s"), *AbsolutePath);
+			return false;
+		}
+		
+		return true;
+	}
+	
+	// One non-blank line of a JSON Lines buffer
+	struct FJsonLine
+	{
+		int32 Start;
+		int32 Length;
+		
+		// 1-based, for error messages
+		int32 LineNumber;
+	};
+	
+	// Split at '\n' (a trailing '\r' is whitespace to the parser), skipping blank lines
+	template <typename CharType>
+	void SplitLines(const CharType* Text, int32 Length, TArray<FJsonLine>& OutLines)
+	{
+		int32 LineStart = 0;
+		int32 LineNumber = 1;
+		for (int32 Position = 0; Position <= Length; ++Position)
+		{
+			if (Position < Length && Text[Position] != '\n')
+			{
+				continue;
+			}
+			
+			for (int32 CharIndex = LineStart; CharIndex < Position; ++CharIndex)
+			{
+				const CharType Char = Text[CharIndex];
+				if (Char != ' ' && Char != '\t' && Char != '\r')
+				{
+					OutLines.Add({LineStart, Position - LineStart, LineNumber});
+					break;
+				}
+			}
+			
+			LineStart = Position + 1;
+			++LineNumber;
+		}
+	}
+	
+	FORCEINLINE FEasyJsonObjectV2 ParseLine(const UTF8CHAR* Line, int32 Length, bool& bOutSuccess)
+	{
+		return FEasyJsonObjectV2::CreateFromUtf8(TArrayView<const uint8>(reinterpret_cast<const uint8*>(Line), Length), bOutSuccess);
+	}
+	
+	FORCEINLINE FEasyJsonObjectV2 ParseLine(const TCHAR* Line, int32 Length, bool& bOutSuccess)
+	{
+		return FEasyJsonObjectV2::CreateFromString(FString(Length, Line), bOutSuccess);
+	}
+	
+	/**
+	 * Parse the lines of a JSON Lines buffer in parallel
+	 * @param OnSplit Called with the number of non-blank lines before parsing starts
+	 * @param OnLine Called on worker threads with each line's index and object
+	 * @return true if every line parsed
+	 */
+	template <typename CharType>
+	bool ParseLines(const CharType* Text, int32 Length, TFunctionRef<void(int32)> OnSplit, TFunctionRef<void(int32, FEasyJsonObjectV2&&)> OnLine, FString& OutErrorMessage)
+	{
+		TArray<FJsonLine> Lines;
+		SplitLines(Text, Length, Lines);
+		OnSplit(Lines.Num());
+		
+		// Lowest index of a line that failed
+		std::atomic<int32> FirstFailedLine(MAX_int32);
+		
+		ParallelFor(Lines.Num(), [&](int32 LineIndex)
+		{
+			const FJsonLine& Line = Lines[LineIndex];
+			bool bLineSuccess = false;
+			FEasyJsonObjectV2 Object = ParseLine(Text + Line.Start, Line.Length, bLineSuccess);
+			if (!bLineSuccess)
+			{
+				int32 Current = FirstFailedLine.load();
+				while (LineIndex < Current && !FirstFailedLine.compare_exchange_weak(Current, LineIndex))
+				{
+				}
+			}
+			OnLine(LineIndex, MoveTemp(Object));
+		});
+		
+		const int32 FailedLine = FirstFailedLine.load();
+		if (FailedLine != MAX_int32)
+		{
+			OutErrorMessage = FString::Printf(TEXT("Failed to parse JSON at line %d"), Lines[FailedLine].LineNumber);
+			return false;
+		}
+		return true;
+	}
+	
+	// Parse file bytes as JSON Lines (UTF-16 files are converted first)
+	bool ParseLines(TArrayView<const uint8> Bytes, TFunctionRef<void(int32)> OnSplit, TFunctionRef<void(int32, FEasyJsonObjectV2&&)> OnLine, FString& OutErrorMessage)
+	{
+		if (IsUtf16(Bytes))
+		{
+			FString JsonLines;
+			FFileHelper::BufferToString(JsonLines, Bytes.GetData(), Bytes.Num());
+			return ParseLines(*JsonLines, JsonLines.Len(), OnSplit, OnLine, OutErrorMessage);
+		}
+		
+		// Skip the UTF-8 byte order mark
+		if (Bytes.Num() >= 3 && Bytes[0] == 0xEF && Bytes[1] == 0xBB && Bytes[2] == 0xBF)
+		{
+			Bytes = Bytes.Slice(3, Bytes.Num() - 3);
+		}
+		return ParseLines(reinterpret_cast<const UTF8CHAR*>(Bytes.GetData()), Bytes.Num(), OnSplit, OnLine, OutErrorMessage);
+	}
+}
+
+FEasyJsonObjectV2 UEasyJsonParseManagerV2::LoadFromFile(const FString& FilePath, bool IsAbsolute, bool& bSuccess, FString& ErrorMessage, bool bMemoryMapped)
 {
 	bSuccess = false;
 	ErrorMessage.Empty();
 	
 	FString AbsolutePath = GetAbsolutePath(FilePath, IsAbsolute);
 	
-	// Check if file exists
-	if (!FPlatformFileManager::Get().GetPlatformFile().FileExists(*AbsolutePath))
+	if (bMemoryMapped)
 	{
-		ErrorMessage = FString::Printf(TEXT("File not found: %s"), *AbsolutePath);
-		return FEasyJsonObjectV2();
+		// Platforms that cannot map files (and UTF-16 files) use the buffered path below
+		TSharedPtr<FEasyJsonSourceV2, ESPMode::ThreadSafe> Source = FEasyJsonSourceV2::MapFile(AbsolutePath);
+		if (Source.IsValid() && !EasyJsonParseManager::IsUtf16(Source->GetBytes()))
+		{
+			return LoadFromSource(Source.ToSharedRef(), bSuccess, ErrorMessage);
+		}
 	}
 	
-	// Load file content
-	FString JsonString;
-	if (!FFileHelper::LoadFileToString(JsonString, *AbsolutePath))
+	TArray<uint8> FileData;
+	if (!EasyJsonParseManager::LoadFileBytes(AbsolutePath, FileData, ErrorMessage))
 	{
-		ErrorMessage = FString::Printf(TEXT("Failed to read file: %s"), *AbsolutePath);
 		return FEasyJsonObjectV2();
 	}
 	
 	// Parse JSON
-	return LoadFromString(JsonString, bSuccess, ErrorMessage);
+	return LoadFromFileBytes(FileData, bSuccess, ErrorMessage);
+}
+
+FEasyJsonObjectV2 UEasyJsonParseManagerV2::LoadFromFileBytes(TArrayView<const uint8> FileData, bool& bSuccess, FString& ErrorMessage)
+{
+	// UTF-16 files still go through the engine's conversion
+	if (EasyJsonParseManager::IsUtf16(FileData))
+	{
+		FString JsonString;
+		FFileHelper::BufferToString(JsonString, FileData.GetData(), FileData.Num());
+		return LoadFromString(JsonString, bSuccess, ErrorMessage);
+	}
+	
+	return LoadFromUtf8(FileData, bSuccess, ErrorMessage);
 }
 
 FEasyJsonObjectV2 UEasyJsonParseManagerV2::LoadFromString(const FString& JsonString, bool& bSuccess, FString& ErrorMessage)
@@ -52,6 +203,240 @@ FEasyJsonObjectV2 UEasyJsonParseManagerV2::LoadFromString(const FString& JsonStr
 	return Result;
 }
 
+FEasyJsonObjectV2 UEasyJsonParseManagerV2::LoadFromUtf8(TArrayView<const uint8> Utf8Json, bool& bSuccess, FString& ErrorMessage)
+{
+	bSuccess = false;
+	ErrorMessage.Empty();
+	
+	if (Utf8Json.Num() == 0)
+	{
+		ErrorMessage = TEXT("Empty JSON string");
+		return FEasyJsonObjectV2();
+	}
+	
+	FEasyJsonObjectV2 Result = FEasyJsonObjectV2::CreateFromUtf8(Utf8Json, bSuccess);
+	
+	if (!bSuccess)
+	{
+		ErrorMessage = TEXT("Failed to parse JSON");
+	}
+	
+	return Result;
+}
+
+FEasyJsonObjectV2 UEasyJsonParseManagerV2::LoadFromSource(const TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe>& Source, bool& bSuccess, FString& ErrorMessage)
+{
+	bSuccess = false;
+	ErrorMessage.Empty();
+	
+	if (Source->GetBytes().Num() == 0)
+	{
+		ErrorMessage = TEXT("Empty JSON string");
+		return FEasyJsonObjectV2();
+	}
+	
+	FEasyJsonObjectV2 Result = FEasyJsonObjectV2::CreateFromSource(Source, bSuccess);
+	
+	if (!bSuccess)
+	{
+		ErrorMessage = TEXT("Failed to parse JSON");
+	}
+	
+	return Result;
+}
+
+FEasyJsonObjectV2 UEasyJsonParseManagerV2::LoadDocumentFromFile(const FString& FilePath, bool IsAbsolute, bool& bSuccess, FString& ErrorMessage)
+{
+	bSuccess = false;
+	ErrorMessage.Empty();
+	
+	FString AbsolutePath = GetAbsolutePath(FilePath, IsAbsolute);
+	
+	TArray<uint8> FileData;
+	if (!EasyJsonParseManager::LoadFileBytes(AbsolutePath, FileData, ErrorMessage))
+	{
+		return FEasyJsonObjectV2();
+	}
+	
+	// UTF-16 files still go through the engine's conversion
+	if (EasyJsonParseManager::IsUtf16(FileData))
+	{
+		FString JsonString;
+		FFileHelper::BufferToString(JsonString, FileData.GetData(), FileData.Num());
+		return LoadDocumentFromString(JsonString, bSuccess, ErrorMessage);
+	}
+	
+	if (FileData.Num() == 0)
+	{
+		ErrorMessage = TEXT("Empty JSON string");
+		return FEasyJsonObjectV2();
+	}
+	
+	FEasyJsonObjectV2 Result = FEasyJsonObjectV2::CreateDocumentFromUtf8(FileData, bSuccess);
+	
+	if (!bSuccess)
+	{
+		ErrorMessage = TEXT("Failed to parse JSON");
+	}
+	
+	return Result;
+}
+
+FEasyJsonObjectV2 UEasyJsonParseManagerV2::LoadDocumentFromString(const FString& JsonString, bool& bSuccess, FString& ErrorMessage)
+{
+	bSuccess = false;
+	ErrorMessage.Empty();
+	
+	if (JsonString.IsEmpty())
+	{
+		ErrorMessage = TEXT("Empty JSON string");
+		return FEasyJsonObjectV2();
+	}
+	
+	FEasyJsonObjectV2 Result = FEasyJsonObjectV2::CreateDocumentFromString(JsonString, bSuccess);
+	
+	if (!bSuccess)
+	{
+		ErrorMessage = TEXT("Failed to parse JSON");
+	}
+	
+	return Result;
+}
+
+FEasyJsonObjectV2 UEasyJsonParseManagerV2::LoadLazyFromFile(const FString& FilePath, bool IsAbsolute, bool& bSuccess, FString& ErrorMessage, bool bMemoryMapped)
+{
+	bSuccess = false;
+	ErrorMessage.Empty();
+	
+	FString AbsolutePath = GetAbsolutePath(FilePath, IsAbsolute);
+	
+	TSharedPtr<FEasyJsonSourceV2, ESPMode::ThreadSafe> Source;
+	if (bMemoryMapped)
+	{
+		Source = FEasyJsonSourceV2::MapFile(AbsolutePath);
+	}
+	
+	if (!Source.IsValid())
+	{
+		TArray<uint8> FileData;
+		if (!EasyJsonParseManager::LoadFileBytes(AbsolutePath, FileData, ErrorMessage))
+		{
+			return FEasyJsonObjectV2();
+		}
+		Source = FEasyJsonSourceV2::FromBuffer(MoveTemp(FileData));
+	}
+	
+	// UTF-16 files still go through the engine's conversion
+	if (EasyJsonParseManager::IsUtf16(Source->GetBytes()))
+	{
+		FString JsonString;
+		FFileHelper::BufferToString(JsonString, Source->GetBytes().GetData(), Source->GetBytes().Num());
+		return LoadLazyFromString(JsonString, bSuccess, ErrorMessage);
+	}
+	
+	if (Source->GetBytes().Num() == 0)
+	{
+		ErrorMessage = TEXT("Empty JSON string");
+		return FEasyJsonObjectV2();
+	}
+	
+	FEasyJsonObjectV2 Result = FEasyJsonObjectV2::CreateLazyFromSource(Source.ToSharedRef(), bSuccess);
+	
+	if (!bSuccess)
+	{
+		ErrorMessage = TEXT("Failed to parse JSON");
+	}
+	
+	return Result;
+}
+
+FEasyJsonObjectV2 UEasyJsonParseManagerV2::LoadLazyFromString(const FString& JsonString, bool& bSuccess, FString& ErrorMessage)
+{
+	bSuccess = false;
+	ErrorMessage.Empty();
+	
+	if (JsonString.IsEmpty())
+	{
+		ErrorMessage = TEXT("Empty JSON string");
+		return FEasyJsonObjectV2();
+	}
+	
+	FEasyJsonObjectV2 Result = FEasyJsonObjectV2::CreateLazyFromString(JsonString, bSuccess);
+	
+	if (!bSuccess)
+	{
+		ErrorMessage = TEXT("Failed to parse JSON");
+	}
+	
+	return Result;
+}
+
+FEasyJsonObjectV2 UEasyJsonParseManagerV2::LoadFromFileCached(const FString& FilePath, bool IsAbsolute, bool& bSuccess, FString& ErrorMessage)
+{
+	return FEasyJsonDocumentCacheV2::Get().LoadFile(GetAbsolutePath(FilePath, IsAbsolute), bSuccess, ErrorMessage);
+}
+
+void UEasyJsonParseManagerV2::InvalidateCachedFile(const FString& FilePath, bool IsAbsolute)
+{
+	FEasyJsonDocumentCacheV2::Get().Invalidate(GetAbsolutePath(FilePath, IsAbsolute));
+}
+
+void UEasyJsonParseManagerV2::ClearFileCache()
+{
+	FEasyJsonDocumentCacheV2::Get().Clear();
+}
+
+void UEasyJsonParseManagerV2::SetFileCacheBudget(int64 MaxBytes)
+{
+	FEasyJsonDocumentCacheV2::Get().SetMaxBytes(MaxBytes);
+}
+
+TArray<FEasyJsonObjectV2> UEasyJsonParseManagerV2::LoadJsonLines(const FString& FilePath, bool IsAbsolute, bool& bSuccess, FString& ErrorMessage)
+{
+	bSuccess = false;
+	ErrorMessage.Empty();
+	
+	TArray<uint8> FileData;
+	if (!EasyJsonParseManager::LoadFileBytes(GetAbsolutePath(FilePath, IsAbsolute), FileData, ErrorMessage))
+	{
+		return TArray<FEasyJsonObjectV2>();
+	}
+	
+	// Lines are counted before parsing starts, so each worker writes its own slot
+	TArray<FEasyJsonObjectV2> Objects;
+	bSuccess = EasyJsonParseManager::ParseLines(FileData,
+		[&Objects](int32 NumLines) { Objects.SetNum(NumLines); },
+		[&Objects](int32 LineIndex, FEasyJsonObjectV2&& Object) { Objects[LineIndex] = MoveTemp(Object); },
+		ErrorMessage);
+	return Objects;
+}
+
+TArray<FEasyJsonObjectV2> UEasyJsonParseManagerV2::LoadJsonLinesFromString(const FString& JsonLines, bool& bSuccess, FString& ErrorMessage)
+{
+	bSuccess = false;
+	ErrorMessage.Empty();
+	
+	TArray<FEasyJsonObjectV2> Objects;
+	bSuccess = EasyJsonParseManager::ParseLines(*JsonLines, JsonLines.Len(),
+		[&Objects](int32 NumLines) { Objects.SetNum(NumLines); },
+		[&Objects](int32 LineIndex, FEasyJsonObjectV2&& Object) { Objects[LineIndex] = MoveTemp(Object); },
+		ErrorMessage);
+	return Objects;
+}
+
+bool UEasyJsonParseManagerV2::LoadJsonLines(const FString& FilePath, bool IsAbsolute, TFunctionRef<void(int32 LineIndex, FEasyJsonObjectV2&& Object)> OnLine, FString& ErrorMessage)
+{
+	ErrorMessage.Empty();
+	
+	TArray<uint8> FileData;
+	if (!EasyJsonParseManager::LoadFileBytes(GetAbsolutePath(FilePath, IsAbsolute), FileData, ErrorMessage))
+	{
+		return false;
+	}
+	
+	return EasyJsonParseManager::ParseLines(FileData, [](int32 NumLines) {}, OnLine, ErrorMessage);
+}
+
 bool UEasyJsonParseManagerV2::SaveToFile(const FEasyJsonObjectV2& JsonObject, const FString& FilePath, bool IsAbsolute, FString& ErrorMessage)
 {
 	ErrorMessage.Empty();
@@ -75,17 +460,8 @@ bool UEasyJsonParseManagerV2::SaveToFile(const FEasyJsonObjectV2& JsonObject, co
 		}
 	}
 	
-	// Convert to string
-	FString JsonString = JsonObject.ToString(true);
-	
-	// Save to file
-	if (!FFileHelper::SaveStringToFile(JsonString, *AbsolutePath))
-	{
-		ErrorMessage = FString::Printf(TEXT("Failed to save file: %s"), *AbsolutePath);
-		return false;
-	}
-	
-	return true;
+	// Stream UTF-8 straight into the file instead of building the whole text first
+	return FEasyJsonWriterV2::WriteToFile(JsonObject, AbsolutePath, true, ErrorMessage);
 }
 
 FString UEasyJsonParseManagerV2::SaveToString(const FEasyJsonObjectV2& JsonObject, bool bPrettyPrint)
@@ -8,9 +8,9 @@
 // JSON loading functionality
 // ========================================
 
-FEasyJsonObjectV2 UEasyJsonParserV2BlueprintLibrary::LoadJsonFromFile(const FString& FilePath, bool bAbsolutePath, bool& bSuccess, FString& ErrorMessage)
+FEasyJsonObjectV2 UEasyJsonParserV2BlueprintLibrary::LoadJsonFromFile(const FString& FilePath, bool bAbsolutePath, bool& bSuccess, FString& ErrorMessage, bool bMemoryMapped)
 {
-	return UEasyJsonParseManagerV2::LoadFromFile(FilePath, bAbsolutePath, bSuccess, ErrorMessage);
+	return UEasyJsonParseManagerV2::LoadFromFile(FilePath, bAbsolutePath, bSuccess, ErrorMessage, bMemoryMapped);
 }
 
 FEasyJsonObjectV2 UEasyJsonParserV2BlueprintLibrary::LoadJsonFromString(const FString& JsonString, bool& bSuccess, FString& ErrorMessage)
@@ -1,6 +1,7 @@
 // Copyright 2025 ayumax. All Rights Reserved.
 
 #include "EasyJsonParserV2Debug.h"
+#include "AdvancedAccessParser.h"
 #include "Engine/Engine.h"
 #include "HAL/PlatformFileManager.h"
 #include "Misc/DateTime.h"
@@ -91,6 +92,29 @@ void FEasyJsonV2DebugLogger::LogAccessParsing(const FString& AccessString, const
     UE_LOG(LogEasyJsonParserV2, Warning, TEXT("%s"), *FormattedMessage);
 }
 
+void FEasyJsonV2DebugLogger::LogAccessParsing(const FString& AccessString, const TArray<FAccessStep>& ParsedSteps)
+{
+    if (!IsDebugEnabled() || GetLogLevel() < EEasyJsonParserV2DebugLogLevel::Verbose)
+    {
+        return;
+    }
+
+    // Only build the step strings when verbose logging is actually enabled
+    TArray<FString> StepStrings;
+    StepStrings.Reserve(ParsedSteps.Num());
+    for (const FAccessStep& Step : ParsedSteps)
+    {
+        FString StepString = Step.PropertyName;
+        for (int32 Index : Step.ArrayIndices)
+        {
+            StepString += FString::Printf(TEXT("[%d]"), Index);
+        }
+        StepStrings.Add(StepString);
+    }
+
+    LogAccessParsing(AccessString, StepStrings);
+}
+
 bool FEasyJsonV2DebugLogger::IsDebugEnabled()
 {
     return GDebugModeEnabled;
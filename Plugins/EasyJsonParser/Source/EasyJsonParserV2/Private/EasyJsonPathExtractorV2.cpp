@@ -0,0 +1,335 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonPathExtractorV2.h"
+#include "EasyJsonStreamReaderV2.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/FileManager.h"
+
+namespace EasyJsonPathExtractor
+{
+	typedef FEasyJsonPathExtractorV2::FSelector FSelector;
+	
+	// Step reached in one compiled path
+	struct FMatchState
+	{
+		int32 PathIndex;
+		int32 Step;
+	};
+	
+	typedef TArray<FMatchState, TInlineAllocator<8>> FMatchStates;
+	typedef TArray<int32, TInlineAllocator<4>> FCompletedPaths;
+	
+	/**
+	 * Tracks which paths the current stream position can still match.
+	 * Subtrees no path leads into are skipped; a matched value and everything below it is built.
+	 */
+	class FExtractVisitor : public IEasyJsonStreamVisitorV2
+	{
+	public:
+		FExtractVisitor(const TArray<TArray<FSelector>>& InPaths, TArray<TArray<FEasyJsonValueV2>>& InValues)
+			: Paths(InPaths)
+			, Values(InValues)
+		{
+		}
+		
+		virtual EEasyJsonStreamActionV2 OnBeginObject() override { return BeginContainer(true); }
+		virtual EEasyJsonStreamActionV2 OnEndObject() override { return EndContainer(); }
+		virtual EEasyJsonStreamActionV2 OnBeginArray() override { return BeginContainer(false); }
+		virtual EEasyJsonStreamActionV2 OnEndArray() override { return EndContainer(); }
+		
+		virtual EEasyJsonStreamActionV2 OnKey(FStringView Key) override
+		{
+			FFrame& Parent = Stack.Last();
+			Parent.KeyStates.Reset();
+			Parent.KeyCompleted.Reset();
+			for (const FMatchState& State : Parent.States)
+			{
+				const FSelector& Selector = Paths[State.PathIndex][State.Step];
+				if (Selector.IsKey() && Key.Equals(Selector.Key, ESearchCase::IgnoreCase))
+				{
+					Advance(State, Parent.KeyStates, Parent.KeyCompleted);
+				}
+			}
+			
+			if (Parent.bCapture)
+			{
+				Parent.Key = FString(Key);
+				return EEasyJsonStreamActionV2::Continue;
+			}
+			return Parent.KeyStates.Num() > 0 || Parent.KeyCompleted.Num() > 0 ? EEasyJsonStreamActionV2::Continue : EEasyJsonStreamActionV2::Skip;
+		}
+		
+		virtual EEasyJsonStreamActionV2 OnString(FStringView Value) override
+		{
+			return AddScalar([Value]() { return MakeShared<FJsonValueString>(FString(Value)); });
+		}
+		
+		virtual EEasyJsonStreamActionV2 OnNumber(double Value) override
+		{
+			return AddScalar([Value]() { return MakeShared<FJsonValueNumber>(Value); });
+		}
+		
+		virtual EEasyJsonStreamActionV2 OnBool(bool bValue) override
+		{
+			return AddScalar([bValue]() { return MakeShared<FJsonValueBoolean>(bValue); });
+		}
+		
+		virtual EEasyJsonStreamActionV2 OnNull() override
+		{
+			return AddScalar([]() { return MakeShared<FJsonValueNull>(); });
+		}
+	
+	private:
+		struct FFrame
+		{
+			bool bObject = false;
+			
+			// True if the container is part of a matched value and is being built
+			bool bCapture = false;
+			
+			// Paths that continue below the container, and paths that end at it
+			FMatchStates States;
+			FCompletedPaths Completed;
+			
+			// Position of the next element (arrays)
+			int32 NextIndex = 0;
+			
+			// Match result of the last key, for the member value that follows (objects)
+			FMatchStates KeyStates;
+			FCompletedPaths KeyCompleted;
+			FString Key;
+			
+			// Contents while capturing
+			TSharedPtr<FJsonObject> Object;
+			TArray<TSharedPtr<FJsonValue>> Elements;
+		};
+		
+		void Advance(const FMatchState& State, FMatchStates& OutStates, FCompletedPaths& OutCompleted) const
+		{
+			if (State.Step + 1 == Paths[State.PathIndex].Num())
+			{
+				OutCompleted.Add(State.PathIndex);
+			}
+			else
+			{
+				OutStates.Add({State.PathIndex, State.Step + 1});
+			}
+		}
+		
+		// Match a value that starts at the current position; false if nothing needs it
+		bool BeginValue(bool bArray, FMatchStates& OutStates, FCompletedPaths& OutCompleted, bool& bOutCapture)
+		{
+			if (Stack.Num() == 0)
+			{
+				for (int32 PathIndex = 0; PathIndex < Paths.Num(); ++PathIndex)
+				{
+					OutStates.Add({PathIndex, 0});
+				}
+			}
+			else if (Stack.Last().bObject)
+			{
+				OutStates = MoveTemp(Stack.Last().KeyStates);
+				OutCompleted = MoveTemp(Stack.Last().KeyCompleted);
+			}
+			else
+			{
+				FFrame& Parent = Stack.Last();
+				const int32 Position = Parent.NextIndex++;
+				for (const FMatchState& State : Parent.States)
+				{
+					const int32 Index = Paths[State.PathIndex][State.Step].Index;
+					if (Index == Position || Index == FEasyJsonPathExtractorV2::AnyIndex)
+					{
+						Advance(State, OutStates, OutCompleted);
+					}
+				}
+			}
+			
+			// A value that is not an array passes the index steps that also match a single value
+			if (!bArray)
+			{
+				for (int32 StateIndex = 0; StateIndex < OutStates.Num(); )
+				{
+					const FMatchState State = OutStates[StateIndex];
+					if (Paths[State.PathIndex][State.Step].bMatchesSingleValue)
+					{
+						OutStates.RemoveAtSwap(StateIndex);
+						Advance(State, OutStates, OutCompleted);
+					}
+					else
+					{
+						++StateIndex;
+					}
+				}
+			}
+			
+			bOutCapture = OutCompleted.Num() > 0 || (Stack.Num() > 0 && Stack.Last().bCapture);
+			return bOutCapture || OutStates.Num() > 0;
+		}
+		
+		// Hand a finished value to the paths that end at it and to the container being built
+		void EndValue(const TSharedRef<FJsonValue>& Value, const FCompletedPaths& Completed)
+		{
+			for (const int32 PathIndex : Completed)
+			{
+				Values[PathIndex].Add(FEasyJsonValueV2(Value));
+			}
+			
+			if (Stack.Num() > 0 && Stack.Last().bCapture)
+			{
+				FFrame& Parent = Stack.Last();
+				if (Parent.bObject)
+				{
+					Parent.Object->SetField(Parent.Key, Value);
+				}
+				else
+				{
+					Parent.Elements.Add(Value);
+				}
+			}
+		}
+		
+		EEasyJsonStreamActionV2 AddScalar(TFunctionRef<TSharedRef<FJsonValue>()> MakeValue)
+		{
+			FMatchStates States;
+			FCompletedPaths Completed;
+			bool bCapture = false;
+			if (BeginValue(false, States, Completed, bCapture) && bCapture)
+			{
+				EndValue(MakeValue(), Completed);
+			}
+			return EEasyJsonStreamActionV2::Continue;
+		}
+		
+		EEasyJsonStreamActionV2 BeginContainer(bool bObject)
+		{
+			FFrame Frame;
+			if (!BeginValue(!bObject, Frame.States, Frame.Completed, Frame.bCapture))
+			{
+				return EEasyJsonStreamActionV2::Skip;
+			}
+			
+			Frame.bObject = bObject;
+			if (Frame.bCapture && bObject)
+			{
+				Frame.Object = MakeShared<FJsonObject>();
+			}
+			Stack.Add(MoveTemp(Frame));
+			return EEasyJsonStreamActionV2::Continue;
+		}
+		
+		EEasyJsonStreamActionV2 EndContainer()
+		{
+			FFrame Frame = Stack.Pop();
+			if (Frame.bCapture)
+			{
+				if (Frame.bObject)
+				{
+					EndValue(MakeShared<FJsonValueObject>(Frame.Object), Frame.Completed);
+				}
+				else
+				{
+					EndValue(MakeShared<FJsonValueArray>(MoveTemp(Frame.Elements)), Frame.Completed);
+				}
+			}
+			return EEasyJsonStreamActionV2::Continue;
+		}
+		
+		const TArray<TArray<FSelector>>& Paths;
+		TArray<TArray<FEasyJsonValueV2>>& Values;
+		
+		// Open containers that are not skipped
+		TArray<FFrame> Stack;
+	};
+}
+
+FEasyJsonPathExtractorV2::FEasyJsonPathExtractorV2(const TArray<FString>& AccessStrings)
+{
+	Paths.SetNum(AccessStrings.Num());
+	for (int32 PathIndex = 0; PathIndex < AccessStrings.Num(); ++PathIndex)
+	{
+		if (!CompilePath(AccessStrings[PathIndex], Paths[PathIndex]) && ErrorMessage.IsEmpty())
+		{
+			ErrorMessage = FString::Printf(TEXT("Invalid access string: %s"), *AccessStrings[PathIndex]);
+		}
+	}
+}
+
+bool FEasyJsonPathExtractorV2::Extract(FArchive& Archive, TArray<TArray<FEasyJsonValueV2>>& OutValues, FString& OutErrorMessage) const
+{
+	OutValues.Reset();
+	OutValues.SetNum(Paths.Num());
+	
+	if (!IsValid())
+	{
+		OutErrorMessage = ErrorMessage;
+		return false;
+	}
+	
+	EasyJsonPathExtractor::FExtractVisitor Visitor(Paths, OutValues);
+	FEasyJsonStreamReaderV2 Reader(Archive);
+	if (!Reader.Read(Visitor))
+	{
+		OutErrorMessage = Reader.GetErrorMessage();
+		return false;
+	}
+	
+	OutErrorMessage.Empty();
+	return true;
+}
+
+bool FEasyJsonPathExtractorV2::ExtractFromFile(const FString& FilePath, TArray<TArray<FEasyJsonValueV2>>& OutValues, FString& OutErrorMessage) const
+{
+	TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!FileReader.IsValid())
+	{
+		OutValues.Reset();
+		OutValues.SetNum(Paths.Num());
+		OutErrorMessage = FString::Printf(TEXT("File not found: %s"), *FilePath);
+		return false;
+	}
+	
+	return Extract(*FileReader, OutValues, OutErrorMessage);
+}
+
+bool FEasyJsonPathExtractorV2::CompilePath(const FString& AccessString, TArray<FSelector>& OutSelectors) const
+{
+	FAccessTokenArray Tokens;
+	FAccessStringTokenizer::Tokenize(AccessString, Tokens, true);
+	
+	for (int32 TokenIndex = 0; TokenIndex < Tokens.Num(); ++TokenIndex)
+	{
+		const FAccessToken& Token = Tokens[TokenIndex];
+		
+		// Index groups must be well formed, and only the first component may start with one (a root array)
+		if (!Token.bIndicesValid || (Token.PropertyName.IsEmpty() && TokenIndex > 0))
+		{
+			return false;
+		}
+		
+		if (!Token.PropertyName.IsEmpty())
+		{
+			FSelector& Selector = OutSelectors.AddDefaulted_GetRef();
+			Selector.Key = FString(Token.PropertyName);
+		}
+		
+		// As in FEasyJsonObjectV2 reads, a key without an index that more steps follow goes into element 0 of an array
+		if (Token.ArrayIndices.Num() == 0 && TokenIndex + 1 < Tokens.Num())
+		{
+			FSelector& Selector = OutSelectors.AddDefaulted_GetRef();
+			Selector.Index = 0;
+			Selector.bMatchesSingleValue = true;
+		}
+		
+		for (const int32 Index : Token.ArrayIndices)
+		{
+			// A lone [0] after a key also matches a value that is not an array, as reads do
+			FSelector& Selector = OutSelectors.AddDefaulted_GetRef();
+			Selector.Index = Index;
+			Selector.bMatchesSingleValue = Index == 0 && Token.ArrayIndices.Num() == 1 && !Token.PropertyName.IsEmpty();
+		}
+	}
+	
+	return OutSelectors.Num() > 0;
+}
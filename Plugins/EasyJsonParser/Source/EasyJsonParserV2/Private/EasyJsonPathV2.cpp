@@ -0,0 +1,46 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonPathV2.h"
+
+namespace
+{
+	const FAccessStepsRef& GetEmptySteps()
+	{
+		static const FAccessStepsRef EmptySteps = MakeShared<const TArray<FAccessStep>, ESPMode::ThreadSafe>();
+		return EmptySteps;
+	}
+}
+
+FEasyJsonPathV2::FEasyJsonPathV2()
+	: Steps(GetEmptySteps())
+	, MaxArrayDepth(0)
+{
+}
+
+FEasyJsonPathV2::FEasyJsonPathV2(const FString& InAccessString)
+	: AccessString(InAccessString)
+	, Steps(InAccessString.IsEmpty() ? GetEmptySteps() : FAdvancedAccessParser::ParseAccessStringCached(InAccessString))
+	, MaxArrayDepth(0)
+{
+	for (const FAccessStep& Step : *Steps)
+	{
+		MaxArrayDepth = FMath::Max(MaxArrayDepth, Step.ArrayIndices.Num());
+	}
+}
+
+FEasyJsonPathV2 FEasyJsonPathV2::Compile(const FString& InAccessString)
+{
+	return FEasyJsonPathV2(InAccessString);
+}
+
+FEasyJsonPathV2 FEasyJsonPathV2::FromSteps(const FString& InAccessString, TArray<FAccessStep>&& InSteps)
+{
+	FEasyJsonPathV2 Path;
+	Path.AccessString = InAccessString;
+	for (const FAccessStep& Step : InSteps)
+	{
+		Path.MaxArrayDepth = FMath::Max(Path.MaxArrayDepth, Step.ArrayIndices.Num());
+	}
+	Path.Steps = MakeShared<const TArray<FAccessStep>, ESPMode::ThreadSafe>(MoveTemp(InSteps));
+	return Path;
+}
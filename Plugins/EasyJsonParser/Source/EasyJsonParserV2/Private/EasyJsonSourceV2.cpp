@@ -0,0 +1,53 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonSourceV2.h"
+#include "HAL/PlatformFileManager.h"
+#include "EasyJsonParserV2Debug.h"
+
+FEasyJsonSourceV2::~FEasyJsonSourceV2()
+{
+	// Unmap before closing the file
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+}
+
+TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe> FEasyJsonSourceV2::FromBuffer(TArray<uint8>&& Bytes)
+{
+	TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe> Source = MakeShareable(new FEasyJsonSourceV2());
+	Source->Buffer = MoveTemp(Bytes);
+	Source->Data = Source->Buffer.GetData();
+	Source->Size = Source->Buffer.Num();
+	return Source;
+}
+
+TSharedPtr<FEasyJsonSourceV2, ESPMode::ThreadSafe> FEasyJsonSourceV2::MapFile(const FString& FilePath)
+{
+	TUniquePtr<IMappedFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath));
+	if (!Handle.IsValid())
+	{
+		EASYJSON_DEBUG_LOG(TEXT("MapFile"), TEXT("Unsupported"), FilePath);
+		return nullptr;
+	}
+	
+	// Positions in the parser are 32-bit
+	const int64 FileSize = Handle->GetFileSize();
+	if (FileSize <= 0 || FileSize > MAX_int32)
+	{
+		EASYJSON_DEBUG_LOG(TEXT("MapFile"), TEXT("Unsupported"), FString::Printf(TEXT("%s (%lld bytes)"), *FilePath, FileSize));
+		return nullptr;
+	}
+	
+	TUniquePtr<IMappedFileRegion> Region(Handle->MapRegion(0, FileSize));
+	if (!Region.IsValid())
+	{
+		EASYJSON_DEBUG_LOG(TEXT("MapFile"), TEXT("Failed"), FilePath);
+		return nullptr;
+	}
+	
+	TSharedPtr<FEasyJsonSourceV2, ESPMode::ThreadSafe> Source = MakeShareable(new FEasyJsonSourceV2());
+	Source->Data = Region->GetMappedPtr();
+	Source->Size = Region->GetMappedSize();
+	Source->MappedRegion = MoveTemp(Region);
+	Source->MappedHandle = MoveTemp(Handle);
+	return Source;
+}
@@ -0,0 +1,98 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "EasyJsonSourceV2.h"
+#include "Containers/StringConv.h"
+
+/**
+ * String value that is a view into the UTF-8 bytes of a source.
+ * The text is converted to FString each time it is read; only strings without escapes are
+ * stored this way, since their bytes in the source are exactly the value.
+ */
+class FEasyJsonSourceStringValue : public FJsonValue
+{
+public:
+	FEasyJsonSourceStringValue(const TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe>& InSource, FUtf8StringView InText)
+		: Source(InSource)
+		, Text(InText)
+	{
+		Type = EJson::String;
+	}
+
+	virtual bool TryGetString(FString& OutString) const override
+	{
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Text.GetData()), Text.Len());
+		OutString = FString(Converted.Length(), Converted.Get());
+		return true;
+	}
+
+	// Conversions to other types behave exactly like FJsonValueString
+	using FJsonValue::TryGetNumber;
+	virtual bool TryGetNumber(double& OutDouble) const override
+	{
+		return FJsonValueString(AsString()).TryGetNumber(OutDouble);
+	}
+
+	virtual bool TryGetBool(bool& OutBool) const override
+	{
+		return FJsonValueString(AsString()).TryGetBool(OutBool);
+	}
+
+protected:
+	virtual FString GetType() const override { return TEXT("String"); }
+
+	// Keeps the bytes alive
+	TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe> Source;
+	FUtf8StringView Text;
+};
+
+/**
+ * Number value that keeps its literal as a view into the UTF-8 bytes of a source.
+ * The literal is converted to double each time it is read.
+ */
+class FEasyJsonSourceNumberValue : public FJsonValue
+{
+public:
+	FEasyJsonSourceNumberValue(const TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe>& InSource, FUtf8StringView InText)
+		: Source(InSource)
+		, Text(InText)
+	{
+		Type = EJson::Number;
+	}
+
+	using FJsonValue::TryGetNumber;
+	virtual bool TryGetNumber(double& OutDouble) const override
+	{
+		// Number literals are ASCII and short
+		TCHAR Buffer[128];
+		const int32 Length = FMath::Min(Text.Len(), (int32)UE_ARRAY_COUNT(Buffer) - 1);
+		for (int32 Index = 0; Index < Length; ++Index)
+		{
+			Buffer[Index] = static_cast<TCHAR>(Text[Index]);
+		}
+		Buffer[Length] = TEXT('\0');
+		OutDouble = FCString::Atod(Buffer);
+		return true;
+	}
+
+	// Conversions to other types behave exactly like FJsonValueNumber
+	virtual bool TryGetString(FString& OutString) const override
+	{
+		return FJsonValueNumber(AsNumber()).TryGetString(OutString);
+	}
+
+	virtual bool TryGetBool(bool& OutBool) const override
+	{
+		return FJsonValueNumber(AsNumber()).TryGetBool(OutBool);
+	}
+
+protected:
+	virtual FString GetType() const override { return TEXT("Number"); }
+
+	// Keeps the bytes alive
+	TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe> Source;
+	FUtf8StringView Text;
+};
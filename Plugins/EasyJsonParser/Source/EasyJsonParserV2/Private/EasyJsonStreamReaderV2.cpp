@@ -0,0 +1,601 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonStreamReaderV2.h"
+#include "EasyJsonFastParserV2.h"
+#include "EasyJsonParserV2Debug.h"
+#include "HAL/FileManager.h"
+#include "Misc/Parse.h"
+#include "Serialization/Archive.h"
+
+namespace EasyJsonStreamReader
+{
+	// Numbers longer than this are rejected rather than buffered
+	constexpr int32 MaxNumberLength = 256;
+	
+	FORCEINLINE bool IsDigit(ANSICHAR Char)
+	{
+		return Char >= '0' && Char <= '9';
+	}
+	
+	FORCEINLINE bool IsWhitespace(uint8 Byte)
+	{
+		return Byte == ' ' || Byte == '\t' || Byte == '\n' || Byte == '\r';
+	}
+	
+	FORCEINLINE bool IsNumberChar(uint8 Byte)
+	{
+		return IsDigit(Byte) || Byte == '-' || Byte == '+' || Byte == '.' || Byte == 'e' || Byte == 'E';
+	}
+	
+	// -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+	bool IsValidNumber(const ANSICHAR* Chars, int32 Length)
+	{
+		int32 Position = 0;
+		if (Position < Length && Chars[Position] == '-')
+		{
+			++Position;
+		}
+		
+		if (Position >= Length || !IsDigit(Chars[Position]))
+		{
+			return false;
+		}
+		if (Chars[Position++] != '0')
+		{
+			while (Position < Length && IsDigit(Chars[Position]))
+			{
+				++Position;
+			}
+		}
+		
+		if (Position < Length && Chars[Position] == '.')
+		{
+			if (++Position >= Length || !IsDigit(Chars[Position]))
+			{
+				return false;
+			}
+			while (Position < Length && IsDigit(Chars[Position]))
+			{
+				++Position;
+			}
+		}
+		
+		if (Position < Length && (Chars[Position] == 'e' || Chars[Position] == 'E'))
+		{
+			++Position;
+			if (Position < Length && (Chars[Position] == '+' || Chars[Position] == '-'))
+			{
+				++Position;
+			}
+			if (Position >= Length || !IsDigit(Chars[Position]))
+			{
+				return false;
+			}
+			while (Position < Length && IsDigit(Chars[Position]))
+			{
+				++Position;
+			}
+		}
+		
+		return Position == Length;
+	}
+}
+
+FEasyJsonStreamReaderV2::FEasyJsonStreamReaderV2(FArchive& InArchive, int32 InChunkSize)
+	: Archive(InArchive)
+	, ChunkSize(FMath::Max(InChunkSize, 16))
+{
+	check(Archive.IsLoading());
+}
+
+bool FEasyJsonStreamReaderV2::Read(IEasyJsonStreamVisitorV2& Visitor)
+{
+	ErrorMessage.Empty();
+	bStopped = false;
+	
+	Chunk.SetNumUninitialized(ChunkSize);
+	Cursor = ChunkEnd = Chunk.GetData();
+	ChunkOffset = 0;
+	bEndOfInput = false;
+	
+	// Skip the UTF-8 byte order mark
+	if (Refill() && ChunkEnd - Cursor >= 3 && Cursor[0] == 0xEF && Cursor[1] == 0xBB && Cursor[2] == 0xBF)
+	{
+		Cursor += 3;
+	}
+	
+	bool bSuccess = ReadValue(Visitor, 0, false);
+	if (bSuccess)
+	{
+		uint8 Byte;
+		if (PeekToken(Byte))
+		{
+			bSuccess = Fail(TEXT("Unexpected data after the root value"));
+		}
+		else
+		{
+			bSuccess = ErrorMessage.IsEmpty();
+		}
+	}
+	else
+	{
+		bSuccess = bStopped;
+	}
+	
+	if (!bSuccess)
+	{
+		EASYJSON_DEBUG_LOG(TEXT("StreamRead"), TEXT("Failed"), ErrorMessage);
+	}
+	
+	return bSuccess;
+}
+
+bool FEasyJsonStreamReaderV2::ReadFile(const FString& FilePath, IEasyJsonStreamVisitorV2& Visitor, FString& OutErrorMessage, int32 ChunkSize)
+{
+	TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!FileReader.IsValid())
+	{
+		OutErrorMessage = FString::Printf(TEXT("File not found: %s"), *FilePath);
+		return false;
+	}
+	
+	FEasyJsonStreamReaderV2 Reader(*FileReader, ChunkSize);
+	const bool bSuccess = Reader.Read(Visitor);
+	OutErrorMessage = Reader.GetErrorMessage();
+	return bSuccess;
+}
+
+bool FEasyJsonStreamReaderV2::ReadValue(IEasyJsonStreamVisitorV2& Visitor, int32 Depth, bool bSkip)
+{
+	uint8 Byte;
+	if (!PeekToken(Byte))
+	{
+		return Fail(TEXT("Unexpected end of input"));
+	}
+	
+	bool bIgnored = false;
+	switch (Byte)
+	{
+	case '{':
+	case '[':
+		++Cursor;
+		return ReadContainer(Visitor, Depth + 1, Byte == '{', bSkip);
+	case '"':
+		++Cursor;
+		if (!ReadString(bSkip))
+		{
+			return false;
+		}
+		return bSkip || Emit(Visitor.OnString(FStringView(Token.GetData(), Token.Num())), bIgnored);
+	case 't':
+		return ReadLiteral("true") && (bSkip || Emit(Visitor.OnBool(true), bIgnored));
+	case 'f':
+		return ReadLiteral("false") && (bSkip || Emit(Visitor.OnBool(false), bIgnored));
+	case 'n':
+		return ReadLiteral("null") && (bSkip || Emit(Visitor.OnNull(), bIgnored));
+	default:
+		break;
+	}
+	
+	if (Byte == '-' || EasyJsonStreamReader::IsDigit(Byte))
+	{
+		double Number = 0.0;
+		return ReadNumber(bSkip, Number) && (bSkip || Emit(Visitor.OnNumber(Number), bIgnored));
+	}
+	
+	return Fail(TEXT("Unexpected character"));
+}
+
+bool FEasyJsonStreamReaderV2::ReadContainer(IEasyJsonStreamVisitorV2& Visitor, int32 Depth, bool bObject, bool bSkip)
+{
+	if (Depth > FEasyJsonFastParserV2::MaxDepth)
+	{
+		return Fail(TEXT("Nesting too deep"));
+	}
+	
+	// Children of a skipped container are scanned without events
+	bool bSkipChildren = bSkip;
+	if (!bSkip && !Emit(bObject ? Visitor.OnBeginObject() : Visitor.OnBeginArray(), bSkipChildren))
+	{
+		return false;
+	}
+	
+	const uint8 Close = bObject ? '}' : ']';
+	uint8 Byte;
+	if (!PeekToken(Byte))
+	{
+		return Fail(TEXT("Unexpected end of input"));
+	}
+	
+	if (Byte == Close)
+	{
+		++Cursor;
+	}
+	else
+	{
+		for (;;)
+		{
+			bool bSkipValue = bSkipChildren;
+			if (bObject)
+			{
+				if (!PeekToken(Byte) || Byte != '"')
+				{
+					return Fail(TEXT("Expected a key"));
+				}
+				++Cursor;
+				
+				if (!ReadString(bSkipChildren))
+				{
+					return false;
+				}
+				if (!bSkipChildren && !Emit(Visitor.OnKey(FStringView(Token.GetData(), Token.Num())), bSkipValue))
+				{
+					return false;
+				}
+				
+				if (!PeekToken(Byte) || Byte != ':')
+				{
+					return Fail(TEXT("Expected ':'"));
+				}
+				++Cursor;
+			}
+			
+			if (!ReadValue(Visitor, Depth, bSkipValue))
+			{
+				return false;
+			}
+			
+			if (!PeekToken(Byte))
+			{
+				return Fail(TEXT("Unexpected end of input"));
+			}
+			++Cursor;
+			
+			if (Byte == Close)
+			{
+				break;
+			}
+			if (Byte != ',')
+			{
+				return Fail(TEXT("Expected ',' or a closing bracket"));
+			}
+		}
+	}
+	
+	// A container skipped from its begin event gets no end event
+	bool bIgnored = false;
+	return bSkipChildren || Emit(bObject ? Visitor.OnEndObject() : Visitor.OnEndArray(), bIgnored);
+}
+
+bool FEasyJsonStreamReaderV2::ReadString(bool bSkip)
+{
+	Utf8Token.Reset();
+	
+	// A \u escape of a high surrogate waits for the low surrogate that should follow it
+	uint32 HighSurrogate = 0;
+	
+	for (;;)
+	{
+		if (Cursor == ChunkEnd && !Refill())
+		{
+			return Fail(TEXT("Unterminated string"));
+		}
+		
+		// Copy the run of plain characters in this chunk at once
+		const uint8* RunStart = Cursor;
+		while (Cursor < ChunkEnd && *Cursor != '"' && *Cursor != '\\' && *Cursor >= 0x20)
+		{
+			++Cursor;
+		}
+		
+		if (!bSkip && Cursor > RunStart)
+		{
+			if (HighSurrogate != 0)
+			{
+				AppendCodePoint(0xFFFD);
+				HighSurrogate = 0;
+			}
+			
+			if (Utf8Token.Num() + (Cursor - RunStart) > MaxStringLength)
+			{
+				return Fail(TEXT("String too long"));
+			}
+			Utf8Token.Append(reinterpret_cast<const UTF8CHAR*>(RunStart), static_cast<int32>(Cursor - RunStart));
+		}
+		
+		if (Cursor == ChunkEnd)
+		{
+			continue;
+		}
+		
+		const uint8 Byte = *Cursor++;
+		if (Byte == '"')
+		{
+			break;
+		}
+		if (Byte != '\\')
+		{
+			return Fail(TEXT("Control character in string"));
+		}
+		
+		uint8 Escape;
+		if (!NextByte(Escape))
+		{
+			return Fail(TEXT("Unterminated string"));
+		}
+		
+		uint32 CodePoint;
+		switch (Escape)
+		{
+		case '"':
+		case '\\':
+		case '/':
+			CodePoint = Escape;
+			break;
+		case 'b':
+			CodePoint = '\b';
+			break;
+		case 'f':
+			CodePoint = '\f';
+			break;
+		case 'n':
+			CodePoint = '\n';
+			break;
+		case 'r':
+			CodePoint = '\r';
+			break;
+		case 't':
+			CodePoint = '\t';
+			break;
+		case 'u':
+			if (!ReadHexDigits(CodePoint))
+			{
+				return false;
+			}
+			break;
+		default:
+			return Fail(TEXT("Invalid escape"));
+		}
+		
+		if (bSkip)
+		{
+			continue;
+		}
+		
+		if (CodePoint >= 0xDC00 && CodePoint < 0xE000 && HighSurrogate != 0)
+		{
+			CodePoint = 0x10000 + ((HighSurrogate - 0xD800) << 10) + (CodePoint - 0xDC00);
+			HighSurrogate = 0;
+		}
+		else if (HighSurrogate != 0)
+		{
+			AppendCodePoint(0xFFFD);
+			HighSurrogate = 0;
+		}
+		
+		if (CodePoint >= 0xD800 && CodePoint < 0xDC00)
+		{
+			HighSurrogate = CodePoint;
+		}
+		else
+		{
+			// Unpaired low surrogates cannot be encoded
+			AppendCodePoint(CodePoint >= 0xDC00 && CodePoint < 0xE000 ? 0xFFFD : CodePoint);
+		}
+		
+		// Characters from escapes count towards the limit like plain runs
+		if (Utf8Token.Num() > MaxStringLength)
+		{
+			return Fail(TEXT("String too long"));
+		}
+	}
+	
+	if (bSkip)
+	{
+		return true;
+	}
+	
+	if (HighSurrogate != 0)
+	{
+		AppendCodePoint(0xFFFD);
+		if (Utf8Token.Num() > MaxStringLength)
+		{
+			return Fail(TEXT("String too long"));
+		}
+	}
+	
+	// Convert to TCHAR once the whole string is decoded
+	const int32 ConvertedLength = FPlatformString::ConvertedLength<TCHAR>(Utf8Token.GetData(), Utf8Token.Num());
+	Token.Reset();
+	Token.AddUninitialized(ConvertedLength);
+	FPlatformString::Convert(Token.GetData(), ConvertedLength, Utf8Token.GetData(), Utf8Token.Num());
+	return true;
+}
+
+bool FEasyJsonStreamReaderV2::ReadNumber(bool bSkip, double& OutValue)
+{
+	NumberToken.Reset();
+	while ((Cursor < ChunkEnd || Refill()) && EasyJsonStreamReader::IsNumberChar(*Cursor))
+	{
+		if (NumberToken.Num() >= EasyJsonStreamReader::MaxNumberLength)
+		{
+			return Fail(TEXT("Number too long"));
+		}
+		NumberToken.Add(static_cast<ANSICHAR>(*Cursor++));
+	}
+	
+	if (!EasyJsonStreamReader::IsValidNumber(NumberToken.GetData(), NumberToken.Num()))
+	{
+		return Fail(TEXT("Invalid number"));
+	}
+	
+	if (!bSkip)
+	{
+		NumberToken.Add('\0');
+		OutValue = FCStringAnsi::Atod(NumberToken.GetData());
+	}
+	return true;
+}
+
+bool FEasyJsonStreamReaderV2::ReadLiteral(const ANSICHAR* Literal)
+{
+	for (const ANSICHAR* Expected = Literal; *Expected != '\0'; ++Expected)
+	{
+		uint8 Byte;
+		if (!NextByte(Byte) || Byte != static_cast<uint8>(*Expected))
+		{
+			return Fail(TEXT("Invalid literal"));
+		}
+	}
+	return true;
+}
+
+bool FEasyJsonStreamReaderV2::ReadHexDigits(uint32& OutCodePoint)
+{
+	OutCodePoint = 0;
+	for (int32 DigitIndex = 0; DigitIndex < 4; ++DigitIndex)
+	{
+		uint8 Byte;
+		if (!NextByte(Byte) || !FChar::IsHexDigit(static_cast<TCHAR>(Byte)))
+		{
+			return Fail(TEXT("Invalid \\u escape"));
+		}
+		OutCodePoint = (OutCodePoint << 4) | FParse::HexDigit(static_cast<TCHAR>(Byte));
+	}
+	return true;
+}
+
+void FEasyJsonStreamReaderV2::AppendCodePoint(uint32 CodePoint)
+{
+	if (CodePoint < 0x80)
+	{
+		Utf8Token.Add(static_cast<UTF8CHAR>(CodePoint));
+	}
+	else if (CodePoint < 0x800)
+	{
+		Utf8Token.Add(static_cast<UTF8CHAR>(0xC0 | (CodePoint >> 6)));
+		Utf8Token.Add(static_cast<UTF8CHAR>(0x80 | (CodePoint & 0x3F)));
+	}
+	else if (CodePoint < 0x10000)
+	{
+		Utf8Token.Add(static_cast<UTF8CHAR>(0xE0 | (CodePoint >> 12)));
+		Utf8Token.Add(static_cast<UTF8CHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+		Utf8Token.Add(static_cast<UTF8CHAR>(0x80 | (CodePoint & 0x3F)));
+	}
+	else
+	{
+		Utf8Token.Add(static_cast<UTF8CHAR>(0xF0 | (CodePoint >> 18)));
+		Utf8Token.Add(static_cast<UTF8CHAR>(0x80 | ((CodePoint >> 12) & 0x3F)));
+		Utf8Token.Add(static_cast<UTF8CHAR>(0x80 | ((CodePoint >> 6) & 0x3F)));
+		Utf8Token.Add(static_cast<UTF8CHAR>(0x80 | (CodePoint & 0x3F)));
+	}
+}
+
+bool FEasyJsonStreamReaderV2::Emit(EEasyJsonStreamActionV2 Action, bool& bOutSkip)
+{
+	if (Action == EEasyJsonStreamActionV2::Stop)
+	{
+		bStopped = true;
+		return false;
+	}
+	
+	bOutSkip = Action == EEasyJsonStreamActionV2::Skip;
+	return true;
+}
+
+bool FEasyJsonStreamReaderV2::Refill()
+{
+	ChunkOffset += ChunkEnd - Chunk.GetData();
+	Cursor = ChunkEnd = Chunk.GetData();
+	
+	if (bEndOfInput || Archive.IsError())
+	{
+		return false;
+	}
+	
+	const int64 TotalSize = Archive.TotalSize();
+	if (TotalSize < 0)
+	{
+		return RefillUnknownSize();
+	}
+	
+	const int64 Remaining = TotalSize - Archive.Tell();
+	if (Remaining <= 0)
+	{
+		return false;
+	}
+	
+	const int32 Size = static_cast<int32>(FMath::Min<int64>(Remaining, ChunkSize));
+	Archive.Serialize(Chunk.GetData(), Size);
+	if (Archive.IsError())
+	{
+		Fail(TEXT("Failed to read the input"));
+		return false;
+	}
+	
+	ChunkEnd = Cursor + Size;
+	return true;
+}
+
+bool FEasyJsonStreamReaderV2::RefillUnknownSize()
+{
+	int32 Size = 0;
+	const int64 Start = Archive.Tell();
+	if (Start >= 0)
+	{
+		// The position tells how much of a short read arrived
+		Archive.Serialize(Chunk.GetData(), ChunkSize);
+		Size = static_cast<int32>(FMath::Clamp<int64>(Archive.Tell() - Start, 0, ChunkSize));
+	}
+	else
+	{
+		// Without a position either, bytes are read one at a time so that none is lost at the end
+		while (Size < ChunkSize)
+		{
+			uint8 Byte;
+			Archive.Serialize(&Byte, 1);
+			if (Archive.IsError())
+			{
+				break;
+			}
+			Chunk[Size++] = Byte;
+		}
+	}
+	
+	// Reading past the end is how such an archive reports it; that is the end of the input, not a failure
+	if (Archive.IsError() || Size < ChunkSize)
+	{
+		Archive.ClearError();
+		bEndOfInput = true;
+	}
+	
+	ChunkEnd = Cursor + Size;
+	return Size > 0;
+}
+
+bool FEasyJsonStreamReaderV2::PeekToken(uint8& OutByte)
+{
+	for (;;)
+	{
+		if (Cursor == ChunkEnd && !Refill())
+		{
+			return false;
+		}
+		if (!EasyJsonStreamReader::IsWhitespace(*Cursor))
+		{
+			OutByte = *Cursor;
+			return true;
+		}
+		++Cursor;
+	}
+}
+
+bool FEasyJsonStreamReaderV2::Fail(const TCHAR* Reason)
+{
+	// The first failure (e.g. a read error) is the one reported
+	if (ErrorMessage.IsEmpty())
+	{
+		ErrorMessage = FString::Printf(TEXT("%s at %lld"), Reason, GetBytesRead());
+	}
+	return false;
+}
@@ -0,0 +1,410 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonStructuralIndexV2.h"
+
+#if PLATFORM_CPU_X86_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS
+	#define EASYJSON_X86_SIMD 1
+#else
+	#define EASYJSON_X86_SIMD 0
+#endif
+
+#if EASYJSON_X86_SIMD
+	#include <immintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+	// Compile the wider kernels without raising the baseline of the whole module
+	#if defined(__clang__) || defined(__GNUC__)
+		#define EASYJSON_TARGET_SSE42 __attribute__((target("sse4.2")))
+		#define EASYJSON_TARGET_AVX2 __attribute__((target("avx2")))
+	#else
+		#define EASYJSON_TARGET_SSE42
+		#define EASYJSON_TARGET_AVX2
+	#endif
+#endif
+
+namespace EasyJsonStructuralIndex
+{
+	static constexpr int32 BlockSize = 64;
+	static constexpr int32 BlocksPerBatch = 1024;
+	
+	// Character class bits of one 64 character block
+	struct FBlockMasks
+	{
+		uint64 Quote = 0;
+		uint64 Backslash = 0;
+		uint64 Operator = 0;
+		uint64 Whitespace = 0;
+	};
+	
+	// State carried from one block to the next
+	struct FScannerState
+	{
+		uint64 PrevEscaped = 0;
+		uint64 PrevInString = 0;
+		uint64 PrevScalar = 0;
+	};
+	
+	// Bit i of the result is the xor of bits 0..i (turns quote bits into in-string ranges)
+	FORCEINLINE uint64 PrefixXor(uint64 Bits)
+	{
+		Bits ^= Bits << 1;
+		Bits ^= Bits << 2;
+		Bits ^= Bits << 4;
+		Bits ^= Bits << 8;
+		Bits ^= Bits << 16;
+		Bits ^= Bits << 32;
+		return Bits;
+	}
+	
+	// Characters preceded by an odd number of backslashes
+	FORCEINLINE uint64 FindEscaped(uint64 Backslash, uint64& PrevEscaped)
+	{
+		// A backslash escaped by the previous block does not start a new sequence
+		Backslash &= ~PrevEscaped;
+		const uint64 FollowsEscape = (Backslash << 1) | PrevEscaped;
+		
+		// Sequences starting on odd bits are flipped by carrying through the run with an add
+		const uint64 EvenBits = 0x5555555555555555ULL;
+		const uint64 OddSequenceStarts = Backslash & ~EvenBits & ~FollowsEscape;
+		const uint64 SequencesStartingOnEvenBits = OddSequenceStarts + Backslash;
+		PrevEscaped = SequencesStartingOnEvenBits < OddSequenceStarts ? 1 : 0;
+		
+		const uint64 InvertMask = SequencesStartingOnEvenBits << 1;
+		return (EvenBits ^ InvertMask) & FollowsEscape;
+	}
+	
+	// Turn the class bits of a block into index entries
+	FORCEINLINE int32 ProcessBlock(const FBlockMasks& Masks, FScannerState& State, uint32 BaseIndex, uint32* Out, int32 Count)
+	{
+		const uint64 Escaped = FindEscaped(Masks.Backslash, State.PrevEscaped);
+		const uint64 Quote = Masks.Quote & ~Escaped;
+		
+		// Opening quotes are inside the range, closing quotes are not
+		const uint64 InString = PrefixXor(Quote) ^ State.PrevInString;
+		State.PrevInString = static_cast<uint64>(static_cast<int64>(InString) >> 63);
+		
+		const uint64 Outside = ~InString & ~Quote;
+		const uint64 Scalar = ~(Masks.Operator | Masks.Whitespace) & Outside;
+		const uint64 ScalarStart = Scalar & ~((Scalar << 1) | State.PrevScalar);
+		State.PrevScalar = Scalar >> 63;
+		
+		uint64 Bits = (Masks.Operator & Outside) | ScalarStart | (Quote & InString);
+		while (Bits != 0)
+		{
+			Out[Count++] = BaseIndex + static_cast<uint32>(FMath::CountTrailingZeros64(Bits));
+			Bits &= Bits - 1;
+		}
+		return Count;
+	}
+	
+	// Bit 0 quote, bit 1 backslash, bit 2 operator, bit 3 whitespace
+	FORCEINLINE uint32 ClassifyChar(uint32 Char)
+	{
+		switch (Char)
+		{
+		case '"':
+			return 1;
+		case '\\':
+			return 2;
+		case '{':
+		case '}':
+		case '[':
+		case ']':
+		case ':':
+		case ',':
+			return 4;
+		case ' ':
+		case '\t':
+		case '\n':
+		case '\r':
+			return 8;
+		default:
+			return 0;
+		}
+	}
+	
+	template <typename CharType>
+	int32 ScanBlocksScalar(const CharType* Json, int32 NumBlocks, uint32 BaseIndex, FScannerState& State, uint32* Out, int32 Count)
+	{
+		for (int32 Block = 0; Block < NumBlocks; ++Block)
+		{
+			const CharType* Chars = Json + Block * BlockSize;
+			
+			FBlockMasks Masks;
+			for (int32 Index = 0; Index < BlockSize; ++Index)
+			{
+				const uint32 Class = ClassifyChar(static_cast<uint32>(Chars[Index]));
+				Masks.Quote |= static_cast<uint64>(Class & 1) << Index;
+				Masks.Backslash |= static_cast<uint64>((Class >> 1) & 1) << Index;
+				Masks.Operator |= static_cast<uint64>((Class >> 2) & 1) << Index;
+				Masks.Whitespace |= static_cast<uint64>((Class >> 3) & 1) << Index;
+			}
+			
+			Count = ProcessBlock(Masks, State, BaseIndex + Block * BlockSize, Out, Count);
+		}
+		return Count;
+	}
+
+#if EASYJSON_X86_SIMD
+	// UTF-8 is classified byte by byte; multi-byte sequences only contain bytes >= 0x80.
+	// 16-bit characters are narrowed with unsigned saturation, so anything above 0xFF becomes
+	// 0x00 or 0xFF and can never be mistaken for ASCII punctuation.
+	// The SSE4.2 tier only needs SSE2 instructions for this, but is kept behind the SSE4.2 check
+	// so that the tiers map onto the CPUs we actually test on.
+	template <typename CharType>
+	EASYJSON_TARGET_SSE42 int32 ScanBlocksSSE42(const CharType* Json, int32 NumBlocks, uint32 BaseIndex, FScannerState& State, uint32* Out, int32 Count)
+	{
+		const __m128i QuoteChar = _mm_set1_epi8('"');
+		const __m128i BackslashChar = _mm_set1_epi8('\\');
+		const __m128i OpenBraceChar = _mm_set1_epi8('{');
+		const __m128i CloseBraceChar = _mm_set1_epi8('}');
+		const __m128i ColonChar = _mm_set1_epi8(':');
+		const __m128i CommaChar = _mm_set1_epi8(',');
+		const __m128i SpaceChar = _mm_set1_epi8(' ');
+		const __m128i TabChar = _mm_set1_epi8('\t');
+		const __m128i LineFeedChar = _mm_set1_epi8('\n');
+		const __m128i CarriageReturnChar = _mm_set1_epi8('\r');
+		const __m128i CaseBit = _mm_set1_epi8(0x20);
+		
+		for (int32 Block = 0; Block < NumBlocks; ++Block)
+		{
+			const CharType* Chars = Json + Block * BlockSize;
+			
+			FBlockMasks Masks;
+			for (int32 Chunk = 0; Chunk < 4; ++Chunk)
+			{
+				__m128i Bytes;
+				if constexpr (sizeof(CharType) == 1)
+				{
+					Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Chars + Chunk * 16));
+				}
+				else
+				{
+					const __m128i* Source = reinterpret_cast<const __m128i*>(Chars + Chunk * 16);
+					Bytes = _mm_packus_epi16(_mm_loadu_si128(Source), _mm_loadu_si128(Source + 1));
+				}
+				
+				// '[' and ']' differ from '{' and '}' only in bit 5
+				const __m128i Folded = _mm_or_si128(Bytes, CaseBit);
+				const __m128i Operator = _mm_or_si128(
+					_mm_or_si128(_mm_cmpeq_epi8(Folded, OpenBraceChar), _mm_cmpeq_epi8(Folded, CloseBraceChar)),
+					_mm_or_si128(_mm_cmpeq_epi8(Bytes, ColonChar), _mm_cmpeq_epi8(Bytes, CommaChar)));
+				const __m128i Whitespace = _mm_or_si128(
+					_mm_or_si128(_mm_cmpeq_epi8(Bytes, SpaceChar), _mm_cmpeq_epi8(Bytes, TabChar)),
+					_mm_or_si128(_mm_cmpeq_epi8(Bytes, LineFeedChar), _mm_cmpeq_epi8(Bytes, CarriageReturnChar)));
+				
+				const int32 Shift = Chunk * 16;
+				Masks.Quote |= static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(Bytes, QuoteChar)))) << Shift;
+				Masks.Backslash |= static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(Bytes, BackslashChar)))) << Shift;
+				Masks.Operator |= static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(Operator))) << Shift;
+				Masks.Whitespace |= static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(Whitespace))) << Shift;
+			}
+			
+			Count = ProcessBlock(Masks, State, BaseIndex + Block * BlockSize, Out, Count);
+		}
+		return Count;
+	}
+	
+	template <typename CharType>
+	EASYJSON_TARGET_AVX2 int32 ScanBlocksAVX2(const CharType* Json, int32 NumBlocks, uint32 BaseIndex, FScannerState& State, uint32* Out, int32 Count)
+	{
+		const __m256i QuoteChar = _mm256_set1_epi8('"');
+		const __m256i BackslashChar = _mm256_set1_epi8('\\');
+		const __m256i OpenBraceChar = _mm256_set1_epi8('{');
+		const __m256i CloseBraceChar = _mm256_set1_epi8('}');
+		const __m256i ColonChar = _mm256_set1_epi8(':');
+		const __m256i CommaChar = _mm256_set1_epi8(',');
+		const __m256i SpaceChar = _mm256_set1_epi8(' ');
+		const __m256i TabChar = _mm256_set1_epi8('\t');
+		const __m256i LineFeedChar = _mm256_set1_epi8('\n');
+		const __m256i CarriageReturnChar = _mm256_set1_epi8('\r');
+		const __m256i CaseBit = _mm256_set1_epi8(0x20);
+		
+		for (int32 Block = 0; Block < NumBlocks; ++Block)
+		{
+			const CharType* Chars = Json + Block * BlockSize;
+			
+			FBlockMasks Masks;
+			for (int32 Chunk = 0; Chunk < 2; ++Chunk)
+			{
+				__m256i Bytes;
+				if constexpr (sizeof(CharType) == 1)
+				{
+					Bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Chars + Chunk * 32));
+				}
+				else
+				{
+					// packus works per 128-bit lane, so restore the character order afterwards
+					const __m256i* Source = reinterpret_cast<const __m256i*>(Chars + Chunk * 32);
+					const __m256i Packed = _mm256_packus_epi16(_mm256_loadu_si256(Source), _mm256_loadu_si256(Source + 1));
+					Bytes = _mm256_permute4x64_epi64(Packed, 0xD8);
+				}
+				
+				const __m256i Folded = _mm256_or_si256(Bytes, CaseBit);
+				const __m256i Operator = _mm256_or_si256(
+					_mm256_or_si256(_mm256_cmpeq_epi8(Folded, OpenBraceChar), _mm256_cmpeq_epi8(Folded, CloseBraceChar)),
+					_mm256_or_si256(_mm256_cmpeq_epi8(Bytes, ColonChar), _mm256_cmpeq_epi8(Bytes, CommaChar)));
+				const __m256i Whitespace = _mm256_or_si256(
+					_mm256_or_si256(_mm256_cmpeq_epi8(Bytes, SpaceChar), _mm256_cmpeq_epi8(Bytes, TabChar)),
+					_mm256_or_si256(_mm256_cmpeq_epi8(Bytes, LineFeedChar), _mm256_cmpeq_epi8(Bytes, CarriageReturnChar)));
+				
+				const int32 Shift = Chunk * 32;
+				Masks.Quote |= static_cast<uint64>(static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(Bytes, QuoteChar)))) << Shift;
+				Masks.Backslash |= static_cast<uint64>(static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(Bytes, BackslashChar)))) << Shift;
+				Masks.Operator |= static_cast<uint64>(static_cast<uint32>(_mm256_movemask_epi8(Operator))) << Shift;
+				Masks.Whitespace |= static_cast<uint64>(static_cast<uint32>(_mm256_movemask_epi8(Whitespace))) << Shift;
+			}
+			
+			Count = ProcessBlock(Masks, State, BaseIndex + Block * BlockSize, Out, Count);
+		}
+		return Count;
+	}
+#endif
+	
+	template <typename CharType>
+	int32 ScanBlocks(const CharType* Json, int32 NumBlocks, uint32 BaseIndex, FScannerState& State, uint32* Out, int32 Count, EEasyJsonSimdLevel SimdLevel)
+	{
+#if EASYJSON_X86_SIMD
+		if constexpr (sizeof(CharType) <= 2)
+		{
+			switch (SimdLevel)
+			{
+			case EEasyJsonSimdLevel::AVX2:
+				return ScanBlocksAVX2(Json, NumBlocks, BaseIndex, State, Out, Count);
+			case EEasyJsonSimdLevel::SSE42:
+				return ScanBlocksSSE42(Json, NumBlocks, BaseIndex, State, Out, Count);
+			default:
+				break;
+			}
+		}
+#endif
+		return ScanBlocksScalar(Json, NumBlocks, BaseIndex, State, Out, Count);
+	}
+}
+
+bool FEasyJsonStructuralIndexV2::Build(const TCHAR* Json, int32 Length, EEasyJsonSimdLevel SimdLevel)
+{
+	return BuildIndex(Json, Length, SimdLevel);
+}
+
+bool FEasyJsonStructuralIndexV2::Build(const UTF8CHAR* Json, int32 Length, EEasyJsonSimdLevel SimdLevel)
+{
+	return BuildIndex(Json, Length, SimdLevel);
+}
+
+template <typename CharType>
+bool FEasyJsonStructuralIndexV2::BuildIndex(const CharType* Json, int32 Length, EEasyJsonSimdLevel SimdLevel)
+{
+	using namespace EasyJsonStructuralIndex;
+	
+	NumPositions = 0;
+	
+	if (Json == nullptr || Length <= 0)
+	{
+		return false;
+	}
+	
+	FScannerState State;
+	
+	const int32 NumFullBlocks = Length / BlockSize;
+	int32 Block = 0;
+	while (Block < NumFullBlocks)
+	{
+		const int32 NumBatchBlocks = FMath::Min(NumFullBlocks - Block, BlocksPerBatch);
+		EnsureCapacity(NumPositions + NumBatchBlocks * BlockSize);
+		NumPositions = ScanBlocks(Json + Block * BlockSize, NumBatchBlocks, Block * BlockSize, State, Positions.GetData(), NumPositions, SimdLevel);
+		Block += NumBatchBlocks;
+	}
+	
+	// Pad the last partial block with whitespace
+	const int32 TailStart = NumFullBlocks * BlockSize;
+	if (TailStart < Length)
+	{
+		CharType Padded[BlockSize];
+		for (int32 Index = 0; Index < BlockSize; ++Index)
+		{
+			Padded[Index] = TailStart + Index < Length ? Json[TailStart + Index] : CharType(' ');
+		}
+		
+		EnsureCapacity(NumPositions + BlockSize);
+		NumPositions = ScanBlocks(Padded, 1, TailStart, State, Positions.GetData(), NumPositions, SimdLevel);
+	}
+	
+	// Ending inside a string means an unterminated string
+	return State.PrevInString == 0;
+}
+
+void FEasyJsonStructuralIndexV2::EnsureCapacity(int32 RequiredPositions)
+{
+	if (Positions.Num() < RequiredPositions)
+	{
+		Positions.AddUninitialized(FMath::Max(RequiredPositions - Positions.Num(), Positions.Num()));
+	}
+}
+
+EEasyJsonSimdLevel FEasyJsonStructuralIndexV2::DetectSimdLevel()
+{
+#if EASYJSON_X86_SIMD
+	uint32 Leaf1Ecx = 0;
+	uint32 Leaf7Ebx = 0;
+	uint64 Xcr0 = 0;
+
+#if defined(_MSC_VER)
+	int Info[4];
+	__cpuid(Info, 0);
+	const int MaxLeaf = Info[0];
+	__cpuid(Info, 1);
+	Leaf1Ecx = static_cast<uint32>(Info[2]);
+	if (MaxLeaf >= 7)
+	{
+		__cpuidex(Info, 7, 0);
+		Leaf7Ebx = static_cast<uint32>(Info[1]);
+	}
+	if (Leaf1Ecx & (1u << 27))
+	{
+		Xcr0 = _xgetbv(0);
+	}
+#else
+	unsigned int Eax = 0;
+	unsigned int Ebx = 0;
+	unsigned int Ecx = 0;
+	unsigned int Edx = 0;
+	const unsigned int MaxLeaf = __get_cpuid_max(0, nullptr);
+	if (__get_cpuid(1, &Eax, &Ebx, &Ecx, &Edx))
+	{
+		Leaf1Ecx = Ecx;
+	}
+	if (MaxLeaf >= 7)
+	{
+		__cpuid_count(7, 0, Eax, Ebx, Ecx, Edx);
+		Leaf7Ebx = Ebx;
+	}
+	if (Leaf1Ecx & (1u << 27))
+	{
+		uint32 Low = 0;
+		uint32 High = 0;
+		__asm__ volatile("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+		Xcr0 = (static_cast<uint64>(High) << 32) | Low;
+	}
+#endif
+	
+	// AVX2 also needs the OS to save the YMM registers (XCR0 bits 1 and 2)
+	const bool bOsSavesYmm = (Xcr0 & 0x6) == 0x6;
+	if (bOsSavesYmm && (Leaf1Ecx & (1u << 28)) && (Leaf7Ebx & (1u << 5)))
+	{
+		return EEasyJsonSimdLevel::AVX2;
+	}
+	if (Leaf1Ecx & (1u << 20))
+	{
+		return EEasyJsonSimdLevel::SSE42;
+	}
+#endif
+	return EEasyJsonSimdLevel::Scalar;
+}
+
+#undef EASYJSON_TARGET_SSE42
+#undef EASYJSON_TARGET_AVX2
+#undef EASYJSON_X86_SIMD
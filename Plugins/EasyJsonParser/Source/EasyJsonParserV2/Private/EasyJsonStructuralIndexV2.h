@@ -0,0 +1,50 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EasyJsonFastParserV2.h"
+
+/**
+ * Stage 1 of the fast parser.
+ * Holds the positions of every structural character ({}[]:,), opening quote and scalar start
+ * that lies outside a string, in input order.
+ */
+class FEasyJsonStructuralIndexV2
+{
+public:
+	/**
+	 * Build the index for a TCHAR buffer
+	 * @param Json The JSON text
+	 * @param Length Number of characters in Json
+	 * @param SimdLevel Instruction set to scan with
+	 * @return false if the input is empty or ends inside a string
+	 */
+	bool Build(const TCHAR* Json, int32 Length, EEasyJsonSimdLevel SimdLevel);
+
+	/**
+	 * Build the index for a UTF-8 buffer (positions are byte offsets)
+	 * @param Json The JSON text
+	 * @param Length Number of bytes in Json
+	 * @param SimdLevel Instruction set to scan with
+	 * @return false if the input is empty or ends inside a string
+	 */
+	bool Build(const UTF8CHAR* Json, int32 Length, EEasyJsonSimdLevel SimdLevel);
+
+	FORCEINLINE int32 Num() const { return NumPositions; }
+	FORCEINLINE uint32 operator[](int32 Index) const { return Positions[Index]; }
+
+	// Instruction sets supported by the running CPU
+	static EEasyJsonSimdLevel DetectSimdLevel();
+
+private:
+	template <typename CharType>
+	bool BuildIndex(const CharType* Json, int32 Length, EEasyJsonSimdLevel SimdLevel);
+
+	// Make room for at least the given number of positions
+	void EnsureCapacity(int32 RequiredPositions);
+
+	// Positions (the array may be larger than NumPositions)
+	TArray<uint32> Positions;
+	int32 NumPositions = 0;
+};
@@ -0,0 +1,634 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EasyJsonStructuralIndexV2.h"
+#include <type_traits>
+
+/**
+ * A container the parser steps over instead of parsing; its value is built elsewhere.
+ * Begin and End are the index entries of the opening and closing bracket.
+ */
+struct FEasyJsonSkippedRangeV2
+{
+	int32 Begin;
+	int32 End;
+};
+
+// True if the handler has bool OnSkippedRange(int32 RangeIndex)
+template <typename HandlerType, typename = void>
+struct TEasyJsonHandlesSkippedRanges
+{
+	static constexpr bool Value = false;
+};
+
+template <typename HandlerType>
+struct TEasyJsonHandlesSkippedRanges<HandlerType, std::void_t<decltype(std::declval<HandlerType&>().OnSkippedRange(0))>>
+{
+	static constexpr bool Value = true;
+};
+
+/**
+ * Stage 2 of the fast parser.
+ * Walks the structural index and reports every value to a handler with this interface:
+ *   bool OnBeginObject(); bool OnEndObject(); bool OnBeginArray(); bool OnEndArray();
+ *   bool OnKey(TStringView<CharType> Key); bool OnString(TStringView<CharType> Value);
+ *   bool OnNumber(double Value, TStringView<CharType> Text); bool OnBool(bool Value); bool OnNull();
+ * String views have their escapes resolved and are only valid during the call.
+ * Returning false from a handler stops parsing.
+ * Handlers that also have bool OnSkippedRange(int32 RangeIndex) can be given ranges to step over.
+ */
+template <typename CharType, typename HandlerType>
+class TEasyJsonStructuralParserV2
+{
+public:
+	TEasyJsonStructuralParserV2(const CharType* InJson, int32 InLength, const FEasyJsonStructuralIndexV2& InIndex, HandlerType& InHandler)
+		: Json(InJson)
+		, Length(InLength)
+		, Index(InIndex)
+		, Handler(InHandler)
+		, Cursor(0)
+	{
+	}
+	
+	/**
+	 * Parse the whole document
+	 * @return true if the input holds exactly one valid JSON value
+	 */
+	bool Parse()
+	{
+		Cursor = 0;
+		
+		if (Index.Num() == 0)
+		{
+			return Fail(0, TEXT("Empty JSON document"));
+		}
+		
+		if (!ParseValue(0))
+		{
+			return false;
+		}
+		
+		if (Cursor != Index.Num())
+		{
+			return Fail(Index[Cursor], TEXT("Unexpected data after the root value"));
+		}
+		
+		return true;
+	}
+	
+	/**
+	 * Parse a run of comma-separated values, e.g. some of the elements of an array
+	 * @param BeginCursor Index entry where the first value starts
+	 * @param EndCursor Index entry of the separator after the last value
+	 * @param Depth Nesting depth of the container holding the values
+	 * @return true if the values are valid and end exactly at EndCursor
+	 */
+	bool ParseElements(int32 BeginCursor, int32 EndCursor, int32 Depth)
+	{
+		Cursor = BeginCursor;
+		
+		while (true)
+		{
+			if (!ParseValue(Depth))
+			{
+				return false;
+			}
+			
+			if (Cursor >= EndCursor)
+			{
+				return Cursor == EndCursor || Fail(PeekPosition(), TEXT("Unexpected end of elements"));
+			}
+			if (PeekChar() != ',')
+			{
+				return Fail(PeekPosition(), TEXT("Expected ',' or ']'"));
+			}
+			++Cursor;
+		}
+	}
+	
+	/**
+	 * Step over containers instead of parsing them; the handler's OnSkippedRange is called in their place
+	 * @param InSkippedRanges Ranges in input order (the view must outlive parsing)
+	 */
+	void SetSkippedRanges(TArrayView<const FEasyJsonSkippedRangeV2> InSkippedRanges)
+	{
+		static_assert(TEasyJsonHandlesSkippedRanges<HandlerType>::Value, "The handler has no OnSkippedRange");
+		SkippedRanges = InSkippedRanges;
+		NextSkippedRange = 0;
+	}
+	
+	FORCEINLINE const FString& GetErrorMessage() const { return ErrorMessage; }
+
+private:
+	static FORCEINLINE bool IsDigit(CharType Char)
+	{
+		return Char >= '0' && Char <= '9';
+	}
+	
+	// Characters that may follow a number or literal
+	static FORCEINLINE bool IsTokenEnd(CharType Char)
+	{
+		switch (Char)
+		{
+		case ' ':
+		case '\t':
+		case '\n':
+		case '\r':
+		case ',':
+		case ':':
+		case ']':
+		case '}':
+		case '[':
+		case '{':
+			return true;
+		default:
+			return false;
+		}
+	}
+	
+	// Character at the next index entry (0 at the end of the index)
+	FORCEINLINE CharType PeekChar() const
+	{
+		return Cursor < Index.Num() ? Json[Index[Cursor]] : CharType(0);
+	}
+	
+	FORCEINLINE uint32 PeekPosition() const
+	{
+		return Cursor < Index.Num() ? Index[Cursor] : static_cast<uint32>(Length);
+	}
+	
+	bool Fail(uint32 Position, const TCHAR* Message)
+	{
+		ErrorMessage = FString::Printf(TEXT("%s (offset %u)"), Message, Position);
+		return false;
+	}
+	
+	FORCEINLINE bool Abort()
+	{
+		return Fail(PeekPosition(), TEXT("Parsing stopped by handler"));
+	}
+	
+	bool ParseValue(int32 Depth)
+	{
+		if (Cursor >= Index.Num())
+		{
+			return Fail(static_cast<uint32>(Length), TEXT("Unexpected end of input"));
+		}
+		
+		if constexpr (TEasyJsonHandlesSkippedRanges<HandlerType>::Value)
+		{
+			if (NextSkippedRange < SkippedRanges.Num() && SkippedRanges[NextSkippedRange].Begin == Cursor)
+			{
+				Cursor = SkippedRanges[NextSkippedRange].End + 1;
+				return Handler.OnSkippedRange(NextSkippedRange++) || Abort();
+			}
+		}
+		
+		const uint32 Position = Index[Cursor++];
+		switch (Json[Position])
+		{
+		case '{':
+			return ParseObject(Position, Depth + 1);
+		case '[':
+			return ParseArray(Position, Depth + 1);
+		case '"':
+		{
+			TStringView<CharType> Value;
+			if (!ParseString(Position, Value))
+			{
+				return false;
+			}
+			return Handler.OnString(Value) || Abort();
+		}
+		case 't':
+			return ParseLiteral(Position, "true", 4) && (Handler.OnBool(true) || Abort());
+		case 'f':
+			return ParseLiteral(Position, "false", 5) && (Handler.OnBool(false) || Abort());
+		case 'n':
+			return ParseLiteral(Position, "null", 4) && (Handler.OnNull() || Abort());
+		default:
+			return ParseNumber(Position);
+		}
+	}
+	
+	bool ParseObject(uint32 Position, int32 Depth)
+	{
+		if (Depth > FEasyJsonFastParserV2::MaxDepth)
+		{
+			return Fail(Position, TEXT("Nesting too deep"));
+		}
+		
+		if (!Handler.OnBeginObject())
+		{
+			return Abort();
+		}
+		
+		if (PeekChar() == '}')
+		{
+			++Cursor;
+			return Handler.OnEndObject() || Abort();
+		}
+		
+		while (true)
+		{
+			if (PeekChar() != '"')
+			{
+				return Fail(PeekPosition(), TEXT("Expected a string key"));
+			}
+			
+			TStringView<CharType> Key;
+			if (!ParseString(Index[Cursor++], Key))
+			{
+				return false;
+			}
+			if (!Handler.OnKey(Key))
+			{
+				return Abort();
+			}
+			
+			if (PeekChar() != ':')
+			{
+				return Fail(PeekPosition(), TEXT("Expected ':' after key"));
+			}
+			++Cursor;
+			
+			if (!ParseValue(Depth))
+			{
+				return false;
+			}
+			
+			const CharType Next = PeekChar();
+			if (Next == '}')
+			{
+				++Cursor;
+				return Handler.OnEndObject() || Abort();
+			}
+			if (Next != ',')
+			{
+				return Fail(PeekPosition(), TEXT("Expected ',' or '}'"));
+			}
+			++Cursor;
+		}
+	}
+	
+	bool ParseArray(uint32 Position, int32 Depth)
+	{
+		if (Depth > FEasyJsonFastParserV2::MaxDepth)
+		{
+			return Fail(Position, TEXT("Nesting too deep"));
+		}
+		
+		if (!Handler.OnBeginArray())
+		{
+			return Abort();
+		}
+		
+		if (PeekChar() == ']')
+		{
+			++Cursor;
+			return Handler.OnEndArray() || Abort();
+		}
+		
+		while (true)
+		{
+			if (!ParseValue(Depth))
+			{
+				return false;
+			}
+			
+			const CharType Next = PeekChar();
+			if (Next == ']')
+			{
+				++Cursor;
+				return Handler.OnEndArray() || Abort();
+			}
+			if (Next != ',')
+			{
+				return Fail(PeekPosition(), TEXT("Expected ',' or ']'"));
+			}
+			++Cursor;
+		}
+	}
+	
+	bool ParseString(uint32 Position, TStringView<CharType>& OutValue)
+	{
+		const CharType* Start = Json + Position + 1;
+		const CharType* End = Json + Length;
+		const CharType* Current = Start;
+		
+		// Most strings have no escapes and are handed out as a view into the input
+		while (Current < End && *Current != '"' && *Current != '\\')
+		{
+			if (static_cast<uint32>(*Current) < 0x20)
+			{
+				return Fail(static_cast<uint32>(Current - Json), TEXT("Control character in string"));
+			}
+			++Current;
+		}
+		
+		if (Current < End && *Current == '"')
+		{
+			OutValue = TStringView<CharType>(Start, static_cast<int32>(Current - Start));
+			return true;
+		}
+		
+		Scratch.Reset();
+		Scratch.Append(Start, static_cast<int32>(Current - Start));
+		
+		while (Current < End && *Current != '"')
+		{
+			if (*Current != '\\')
+			{
+				if (static_cast<uint32>(*Current) < 0x20)
+				{
+					return Fail(static_cast<uint32>(Current - Json), TEXT("Control character in string"));
+				}
+				Scratch.Add(*Current++);
+				continue;
+			}
+			
+			if (++Current >= End)
+			{
+				break;
+			}
+			
+			switch (*Current++)
+			{
+			case '"':
+				Scratch.Add(CharType('"'));
+				break;
+			case '\\':
+				Scratch.Add(CharType('\\'));
+				break;
+			case '/':
+				Scratch.Add(CharType('/'));
+				break;
+			case 'b':
+				Scratch.Add(CharType('\b'));
+				break;
+			case 'f':
+				Scratch.Add(CharType('\f'));
+				break;
+			case 'n':
+				Scratch.Add(CharType('\n'));
+				break;
+			case 'r':
+				Scratch.Add(CharType('\r'));
+				break;
+			case 't':
+				Scratch.Add(CharType('\t'));
+				break;
+			case 'u':
+				if (!ParseUnicodeEscape(Current, End))
+				{
+					return Fail(static_cast<uint32>(Current - Json), TEXT("Invalid unicode escape"));
+				}
+				break;
+			default:
+				return Fail(static_cast<uint32>(Current - Json - 1), TEXT("Invalid escape sequence"));
+			}
+		}
+		
+		if (Current >= End)
+		{
+			return Fail(Position, TEXT("Unterminated string"));
+		}
+		
+		OutValue = TStringView<CharType>(Scratch.GetData(), Scratch.Num());
+		return true;
+	}
+	
+	static bool ParseHex4(const CharType* Current, const CharType* End, uint32& OutValue)
+	{
+		if (End - Current < 4)
+		{
+			return false;
+		}
+		
+		OutValue = 0;
+		for (int32 Offset = 0; Offset < 4; ++Offset)
+		{
+			const CharType Char = Current[Offset];
+			uint32 Digit;
+			if (Char >= '0' && Char <= '9')
+			{
+				Digit = Char - '0';
+			}
+			else if (Char >= 'a' && Char <= 'f')
+			{
+				Digit = Char - 'a' + 10;
+			}
+			else if (Char >= 'A' && Char <= 'F')
+			{
+				Digit = Char - 'A' + 10;
+			}
+			else
+			{
+				return false;
+			}
+			OutValue = (OutValue << 4) | Digit;
+		}
+		return true;
+	}
+	
+	// Decode the digits after "\u" (Current points at the first hex digit)
+	bool ParseUnicodeEscape(const CharType*& Current, const CharType* End)
+	{
+		uint32 CodeUnit;
+		if (!ParseHex4(Current, End, CodeUnit))
+		{
+			return false;
+		}
+		Current += 4;
+		
+		if constexpr (sizeof(CharType) == 2)
+		{
+			// UTF-16 output takes surrogate halves as they are
+			Scratch.Add(static_cast<CharType>(CodeUnit));
+			return true;
+		}
+		else
+		{
+			uint32 CodePoint = CodeUnit;
+			uint32 LowSurrogate;
+			if (CodeUnit >= 0xD800 && CodeUnit <= 0xDBFF && End - Current >= 6 && Current[0] == '\\' && Current[1] == 'u'
+				&& ParseHex4(Current + 2, End, LowSurrogate) && LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+			{
+				CodePoint = 0x10000 + ((CodeUnit - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+				Current += 6;
+			}
+			AppendCodePoint(CodePoint);
+			return true;
+		}
+	}
+	
+	void AppendCodePoint(uint32 CodePoint)
+	{
+		if constexpr (sizeof(CharType) == 1)
+		{
+			if (CodePoint < 0x80)
+			{
+				Scratch.Add(static_cast<CharType>(CodePoint));
+			}
+			else if (CodePoint < 0x800)
+			{
+				Scratch.Add(static_cast<CharType>(0xC0 | (CodePoint >> 6)));
+				Scratch.Add(static_cast<CharType>(0x80 | (CodePoint & 0x3F)));
+			}
+			else if (CodePoint < 0x10000)
+			{
+				Scratch.Add(static_cast<CharType>(0xE0 | (CodePoint >> 12)));
+				Scratch.Add(static_cast<CharType>(0x80 | ((CodePoint >> 6) & 0x3F)));
+				Scratch.Add(static_cast<CharType>(0x80 | (CodePoint & 0x3F)));
+			}
+			else
+			{
+				Scratch.Add(static_cast<CharType>(0xF0 | (CodePoint >> 18)));
+				Scratch.Add(static_cast<CharType>(0x80 | ((CodePoint >> 12) & 0x3F)));
+				Scratch.Add(static_cast<CharType>(0x80 | ((CodePoint >> 6) & 0x3F)));
+				Scratch.Add(static_cast<CharType>(0x80 | (CodePoint & 0x3F)));
+			}
+		}
+		else
+		{
+			Scratch.Add(static_cast<CharType>(CodePoint));
+		}
+	}
+	
+	bool ParseLiteral(uint32 Position, const ANSICHAR* Literal, int32 LiteralLength)
+	{
+		if (static_cast<int64>(Position) + LiteralLength > Length)
+		{
+			return Fail(Position, TEXT("Invalid literal"));
+		}
+		
+		for (int32 Offset = 0; Offset < LiteralLength; ++Offset)
+		{
+			if (Json[Position + Offset] != static_cast<CharType>(Literal[Offset]))
+			{
+				return Fail(Position, TEXT("Invalid literal"));
+			}
+		}
+		
+		const int64 EndPosition = static_cast<int64>(Position) + LiteralLength;
+		if (EndPosition < Length && !IsTokenEnd(Json[EndPosition]))
+		{
+			return Fail(Position, TEXT("Invalid literal"));
+		}
+		return true;
+	}
+	
+	bool ParseNumber(uint32 Position)
+	{
+		const CharType* Start = Json + Position;
+		const CharType* End = Json + Length;
+		const CharType* Current = Start;
+		
+		const bool bNegative = *Current == '-';
+		if (bNegative)
+		{
+			++Current;
+		}
+		
+		if (Current >= End || !IsDigit(*Current))
+		{
+			return Fail(Position, TEXT("Invalid value"));
+		}
+		
+		// Integer part (no leading zeros)
+		uint64 Mantissa = 0;
+		int32 NumDigits = 0;
+		if (*Current == '0')
+		{
+			++Current;
+			NumDigits = 1;
+		}
+		else
+		{
+			while (Current < End && IsDigit(*Current))
+			{
+				Mantissa = Mantissa * 10 + (*Current - '0');
+				++NumDigits;
+				++Current;
+			}
+		}
+		
+		bool bIntegral = true;
+		if (Current < End && *Current == '.')
+		{
+			bIntegral = false;
+			if (++Current >= End || !IsDigit(*Current))
+			{
+				return Fail(Position, TEXT("Invalid number"));
+			}
+			while (Current < End && IsDigit(*Current))
+			{
+				++Current;
+			}
+		}
+		
+		if (Current < End && (*Current == 'e' || *Current == 'E'))
+		{
+			bIntegral = false;
+			++Current;
+			if (Current < End && (*Current == '+' || *Current == '-'))
+			{
+				++Current;
+			}
+			if (Current >= End || !IsDigit(*Current))
+			{
+				return Fail(Position, TEXT("Invalid number"));
+			}
+			while (Current < End && IsDigit(*Current))
+			{
+				++Current;
+			}
+		}
+		
+		if (Current < End && !IsTokenEnd(*Current))
+		{
+			return Fail(Position, TEXT("Invalid number"));
+		}
+		
+		const TStringView<CharType> Text(Start, static_cast<int32>(Current - Start));
+		
+		// Integers of up to 15 digits are exact in a double; everything else goes through Atod
+		double Value;
+		if (bIntegral && NumDigits <= 15)
+		{
+			Value = bNegative ? -static_cast<double>(Mantissa) : static_cast<double>(Mantissa);
+		}
+		else
+		{
+			TArray<TCHAR, TInlineAllocator<64>> Buffer;
+			Buffer.Reserve(Text.Len() + 1);
+			for (const CharType Char : Text)
+			{
+				Buffer.Add(static_cast<TCHAR>(Char));
+			}
+			Buffer.Add(TEXT('\0'));
+			Value = FCString::Atod(Buffer.GetData());
+		}
+		
+		return Handler.OnNumber(Value, Text) || Abort();
+	}
+	
+	const CharType* Json;
+	int32 Length;
+	const FEasyJsonStructuralIndexV2& Index;
+	HandlerType& Handler;
+	
+	// Next index entry to read
+	int32 Cursor;
+	
+	// Decoded text of the last string that contained escapes
+	TArray<CharType> Scratch;
+	
+	// Containers to step over and the next one in input order
+	TArrayView<const FEasyJsonSkippedRangeV2> SkippedRanges;
+	int32 NextSkippedRange = 0;
+	
+	FString ErrorMessage;
+};
@@ -0,0 +1,28 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonTextV2.h"
+
+int32 EasyJsonText::FormatNumber(double Value, ANSICHAR (&OutChars)[32])
+{
+	if (!FMath::IsFinite(Value))
+	{
+		return 0;
+	}
+	
+	if (FMath::Abs(Value) < 1e15 && Value == FMath::FloorToDouble(Value))
+	{
+		return FCStringAnsi::Snprintf(OutChars, UE_ARRAY_COUNT(OutChars), "%lld", static_cast<long long>(Value));
+	}
+	
+	// Shortest spelling that reads back as the same double
+	int32 Length = 0;
+	for (int32 Precision = 15; Precision <= 17; ++Precision)
+	{
+		Length = FCStringAnsi::Snprintf(OutChars, UE_ARRAY_COUNT(OutChars), "%.*g", Precision, Value);
+		if (FCStringAnsi::Atod(OutChars) == Value)
+		{
+			break;
+		}
+	}
+	return Length;
+}
@@ -0,0 +1,93 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// UTF-8 spelling of JSON scalars shared by FEasyJsonWriterV2 and FEasyJsonBuilderV2
+namespace EasyJsonText
+{
+	// Most bytes EncodeCharacter writes (a \u escape)
+	static constexpr int32 MaxCharacterBytes = 6;
+	
+	/**
+	 * Spell a number: integers exactly, other values with the fewest digits that read back as the same double
+	 * @param OutChars Receives the text (not terminated)
+	 * @return Length of the text, or 0 for NaN and infinities, which have no JSON spelling
+	 */
+	int32 FormatNumber(double Value, ANSICHAR (&OutChars)[32]);
+	
+	/**
+	 * Write one character of a string value as escaped UTF-8.
+	 * Surrogate pairs are combined (CharIndex is moved to the second half); unpaired surrogates become U+FFFD.
+	 * @param Out Room for MaxCharacterBytes bytes
+	 * @return Bytes written
+	 */
+	FORCEINLINE int32 EncodeCharacter(const TCHAR* Chars, int32 Length, int32& CharIndex, uint8* Out)
+	{
+		static const ANSICHAR HexDigits[] = "0123456789abcdef";
+		
+		uint8* const Start = Out;
+		uint32 CodePoint = static_cast<uint32>(Chars[CharIndex]);
+		
+		if (CodePoint < 0x80)
+		{
+			switch (CodePoint)
+			{
+			case '"': *Out++ = '\\'; *Out++ = '"'; break;
+			case '\\': *Out++ = '\\'; *Out++ = '\\'; break;
+			case '\b': *Out++ = '\\'; *Out++ = 'b'; break;
+			case '\f': *Out++ = '\\'; *Out++ = 'f'; break;
+			case '\n': *Out++ = '\\'; *Out++ = 'n'; break;
+			case '\r': *Out++ = '\\'; *Out++ = 'r'; break;
+			case '\t': *Out++ = '\\'; *Out++ = 't'; break;
+			default:
+				if (CodePoint < 0x20)
+				{
+					*Out++ = '\\';
+					*Out++ = 'u';
+					*Out++ = '0';
+					*Out++ = '0';
+					*Out++ = HexDigits[CodePoint >> 4];
+					*Out++ = HexDigits[CodePoint & 0xF];
+				}
+				else
+				{
+					*Out++ = static_cast<uint8>(CodePoint);
+				}
+				break;
+			}
+			return static_cast<int32>(Out - Start);
+		}
+		
+		if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && CharIndex + 1 < Length
+			&& static_cast<uint32>(Chars[CharIndex + 1]) >= 0xDC00 && static_cast<uint32>(Chars[CharIndex + 1]) <= 0xDFFF)
+		{
+			CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (static_cast<uint32>(Chars[++CharIndex]) - 0xDC00);
+		}
+		else if ((CodePoint >= 0xD800 && CodePoint <= 0xDFFF) || CodePoint > 0x10FFFF)
+		{
+			CodePoint = 0xFFFD;
+		}
+		
+		if (CodePoint < 0x800)
+		{
+			*Out++ = static_cast<uint8>(0xC0 | (CodePoint >> 6));
+			*Out++ = static_cast<uint8>(0x80 | (CodePoint & 0x3F));
+		}
+		else if (CodePoint < 0x10000)
+		{
+			*Out++ = static_cast<uint8>(0xE0 | (CodePoint >> 12));
+			*Out++ = static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F));
+			*Out++ = static_cast<uint8>(0x80 | (CodePoint & 0x3F));
+		}
+		else
+		{
+			*Out++ = static_cast<uint8>(0xF0 | (CodePoint >> 18));
+			*Out++ = static_cast<uint8>(0x80 | ((CodePoint >> 12) & 0x3F));
+			*Out++ = static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F));
+			*Out++ = static_cast<uint8>(0x80 | (CodePoint & 0x3F));
+		}
+		return static_cast<int32>(Out - Start);
+	}
+}
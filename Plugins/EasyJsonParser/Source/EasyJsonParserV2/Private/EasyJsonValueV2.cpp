@@ -1,6 +1,7 @@
 // Copyright 2025 ayumax. All Rights Reserved.
 
 #include "EasyJsonValueV2.h"
+#include "EasyJsonObjectV2.h"
 
 FEasyJsonValueV2::FEasyJsonValueV2()
 {
@@ -11,8 +12,16 @@ FEasyJsonValueV2::FEasyJsonValueV2(TSharedPtr<FJsonValue> InJsonValue)
 {
 }
 
+FEasyJsonValueV2::FEasyJsonValueV2(const TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe>& InDocument, int32 InDocumentIndex)
+	: Document(InDocument)
+	, DocumentIndex(InDocumentIndex)
+{
+}
+
 FEasyJsonValueV2::FEasyJsonValueV2(const FEasyJsonValueV2& Other)
 	: InnerValue(Other.InnerValue)
+	, Document(Other.Document)
+	, DocumentIndex(Other.DocumentIndex)
 {
 }
 
@@ -21,12 +30,16 @@ FEasyJsonValueV2& FEasyJsonValueV2::operator=(const FEasyJsonValueV2& Other)
 	if (this != &Other)
 	{
 		InnerValue = Other.InnerValue;
+		Document = Other.Document;
+		DocumentIndex = Other.DocumentIndex;
 	}
 	return *this;
 }
 
 FEasyJsonValueV2::FEasyJsonValueV2(FEasyJsonValueV2&& Other) noexcept
 	: InnerValue(MoveTemp(Other.InnerValue))
+	, Document(MoveTemp(Other.Document))
+	, DocumentIndex(Other.DocumentIndex)
 {
 }
 
@@ -35,6 +48,8 @@ FEasyJsonValueV2& FEasyJsonValueV2::operator=(FEasyJsonValueV2&& Other) noexcept
 	if (this != &Other)
 	{
 		InnerValue = MoveTemp(Other.InnerValue);
+		Document = MoveTemp(Other.Document);
+		DocumentIndex = Other.DocumentIndex;
 	}
 	return *this;
 }
@@ -47,7 +62,7 @@ int32 FEasyJsonValueV2::GetIntValue(int32 DefaultValue) const
 	}
 	
 	double DoubleValue;
-	if (InnerValue->TryGetNumber(DoubleValue))
+	if (TryGetNumber(DoubleValue))
 	{
 		return static_cast<int32>(DoubleValue);
 	}
@@ -63,7 +78,7 @@ float FEasyJsonValueV2::GetFloatValue(float DefaultValue) const
 	}
 	
 	double DoubleValue;
-	if (InnerValue->TryGetNumber(DoubleValue))
+	if (TryGetNumber(DoubleValue))
 	{
 		return static_cast<float>(DoubleValue);
 	}
@@ -79,7 +94,7 @@ FString FEasyJsonValueV2::GetStringValue(const FString& DefaultValue) const
 	}
 	
 	FString StringValue;
-	if (InnerValue->TryGetString(StringValue))
+	if (TryGetString(StringValue))
 	{
 		return StringValue;
 	}
@@ -95,7 +110,7 @@ bool FEasyJsonValueV2::GetBoolValue(bool DefaultValue) const
 	}
 	
 	bool BoolValue;
-	if (InnerValue->TryGetBool(BoolValue))
+	if (TryGetBool(BoolValue))
 	{
 		return BoolValue;
 	}
@@ -105,30 +120,202 @@ bool FEasyJsonValueV2::GetBoolValue(bool DefaultValue) const
 
 bool FEasyJsonValueV2::IsNull() const
 {
+	if (Document.IsValid())
+	{
+		return Document->GetType(DocumentIndex) == EEasyJsonTapeType::Null;
+	}
 	return IsValid() && InnerValue->IsNull();
 }
 
 bool FEasyJsonValueV2::IsNumber() const
 {
+	if (Document.IsValid())
+	{
+		return Document->GetType(DocumentIndex) == EEasyJsonTapeType::Number;
+	}
 	return IsValid() && InnerValue->Type == EJson::Number;
 }
 
 bool FEasyJsonValueV2::IsString() const
 {
+	if (Document.IsValid())
+	{
+		return Document->GetType(DocumentIndex) == EEasyJsonTapeType::String;
+	}
 	return IsValid() && InnerValue->Type == EJson::String;
 }
 
 bool FEasyJsonValueV2::IsBool() const
 {
+	if (Document.IsValid())
+	{
+		const EEasyJsonTapeType Type = Document->GetType(DocumentIndex);
+		return Type == EEasyJsonTapeType::True || Type == EEasyJsonTapeType::False;
+	}
 	return IsValid() && InnerValue->Type == EJson::Boolean;
 }
 
 bool FEasyJsonValueV2::IsArray() const
 {
+	if (Document.IsValid())
+	{
+		return Document->GetType(DocumentIndex) == EEasyJsonTapeType::Array;
+	}
 	return IsValid() && InnerValue->Type == EJson::Array;
 }
 
 bool FEasyJsonValueV2::IsObject() const
 {
+	if (Document.IsValid())
+	{
+		return Document->GetType(DocumentIndex) == EEasyJsonTapeType::Object;
+	}
 	return IsValid() && InnerValue->Type == EJson::Object;
-}
\ No newline at end of file
+}
+
+int32 FEasyJsonValueV2::GetArraySize() const
+{
+	if (Document.IsValid())
+	{
+		return IsArray() ? Document->GetNum(DocumentIndex) : 0;
+	}
+	
+	const TArray<TSharedPtr<FJsonValue>>* Array;
+	if (IsValid() && InnerValue->TryGetArray(Array))
+	{
+		return Array->Num();
+	}
+	
+	return 0;
+}
+
+FEasyJsonValueV2 FEasyJsonValueV2::GetArrayElement(int32 Index) const
+{
+	if (Document.IsValid())
+	{
+		const int32 ElementIndex = Document->GetArrayElement(DocumentIndex, Index);
+		return ElementIndex != INDEX_NONE ? FEasyJsonValueV2(Document, ElementIndex) : FEasyJsonValueV2();
+	}
+	
+	const TArray<TSharedPtr<FJsonValue>>* Array;
+	if (IsValid() && InnerValue->TryGetArray(Array) && Array->IsValidIndex(Index))
+	{
+		return FEasyJsonValueV2((*Array)[Index]);
+	}
+	
+	return FEasyJsonValueV2();
+}
+
+TArray<FEasyJsonValueV2> FEasyJsonValueV2::GetArrayElements() const
+{
+	TArray<FEasyJsonValueV2> Elements;
+	
+	if (Document.IsValid())
+	{
+		if (IsArray())
+		{
+			Elements.Reserve(Document->GetNum(DocumentIndex));
+			const int32 EndIndex = Document->GetEndIndex(DocumentIndex);
+			for (int32 ElementIndex = Document->GetFirstChildIndex(DocumentIndex); ElementIndex < EndIndex; ElementIndex = Document->GetNextIndex(ElementIndex))
+			{
+				Elements.Emplace(Document, ElementIndex);
+			}
+		}
+		return Elements;
+	}
+	
+	const TArray<TSharedPtr<FJsonValue>>* Array;
+	if (IsValid() && InnerValue->TryGetArray(Array))
+	{
+		Elements.Reserve(Array->Num());
+		for (const TSharedPtr<FJsonValue>& Element : *Array)
+		{
+			Elements.Emplace(Element);
+		}
+	}
+	
+	return Elements;
+}
+
+FEasyJsonObjectV2 FEasyJsonValueV2::GetObjectValue() const
+{
+	if (Document.IsValid())
+	{
+		return IsObject() ? FEasyJsonObjectV2(Document, DocumentIndex) : FEasyJsonObjectV2();
+	}
+	
+	const TSharedPtr<FJsonObject>* Object;
+	if (IsValid() && InnerValue->TryGetObject(Object))
+	{
+		return FEasyJsonObjectV2(*Object);
+	}
+	
+	return FEasyJsonObjectV2();
+}
+
+TSharedPtr<FJsonValue> FEasyJsonValueV2::GetJsonValue() const
+{
+	if (Document.IsValid())
+	{
+		return Document->ToJsonValue(DocumentIndex);
+	}
+	return InnerValue;
+}
+
+bool FEasyJsonValueV2::TryGetNumber(double& OutNumber) const
+{
+	if (Document.IsValid())
+	{
+		switch (Document->GetType(DocumentIndex))
+		{
+		case EEasyJsonTapeType::Number:
+			// Lazy values that fail to parse read as missing
+			return Document->TryGetNumber(DocumentIndex, OutNumber);
+		case EEasyJsonTapeType::Array:
+		case EEasyJsonTapeType::Object:
+			return false;
+		default:
+			// Scalars of other types convert exactly like the engine values
+			return Document->ToJsonValue(DocumentIndex)->TryGetNumber(OutNumber);
+		}
+	}
+	return InnerValue->TryGetNumber(OutNumber);
+}
+
+bool FEasyJsonValueV2::TryGetString(FString& OutString) const
+{
+	if (Document.IsValid())
+	{
+		switch (Document->GetType(DocumentIndex))
+		{
+		case EEasyJsonTapeType::String:
+			return Document->TryGetStringValue(DocumentIndex, OutString);
+		case EEasyJsonTapeType::Array:
+		case EEasyJsonTapeType::Object:
+			return false;
+		default:
+			return Document->ToJsonValue(DocumentIndex)->TryGetString(OutString);
+		}
+	}
+	return InnerValue->TryGetString(OutString);
+}
+
+bool FEasyJsonValueV2::TryGetBool(bool& OutBool) const
+{
+	if (Document.IsValid())
+	{
+		switch (Document->GetType(DocumentIndex))
+		{
+		case EEasyJsonTapeType::True:
+		case EEasyJsonTapeType::False:
+			OutBool = Document->GetType(DocumentIndex) == EEasyJsonTapeType::True;
+			return true;
+		case EEasyJsonTapeType::Array:
+		case EEasyJsonTapeType::Object:
+			return false;
+		default:
+			return Document->ToJsonValue(DocumentIndex)->TryGetBool(OutBool);
+		}
+	}
+	return InnerValue->TryGetBool(OutBool);
+}
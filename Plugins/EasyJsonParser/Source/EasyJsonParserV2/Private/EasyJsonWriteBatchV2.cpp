@@ -0,0 +1,267 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonWriteBatchV2.h"
+#include "EasyJsonObjectEditV2.h"
+#include "EasyJsonParserV2Debug.h"
+#include "Dom/JsonObject.h"
+
+FEasyJsonWriteBatchV2::FEasyJsonWriteBatchV2()
+{
+	Reset();
+}
+
+void FEasyJsonWriteBatchV2::WriteInt(const FString& AccessString, int32 Value)
+{
+	WriteInt(FEasyJsonPathV2(AccessString), Value);
+}
+
+void FEasyJsonWriteBatchV2::WriteFloat(const FString& AccessString, float Value)
+{
+	WriteFloat(FEasyJsonPathV2(AccessString), Value);
+}
+
+void FEasyJsonWriteBatchV2::WriteString(const FString& AccessString, const FString& Value)
+{
+	WriteString(FEasyJsonPathV2(AccessString), Value);
+}
+
+void FEasyJsonWriteBatchV2::WriteBool(const FString& AccessString, bool Value)
+{
+	WriteBool(FEasyJsonPathV2(AccessString), Value);
+}
+
+void FEasyJsonWriteBatchV2::WriteObject(const FString& AccessString, const FEasyJsonObjectV2& Object)
+{
+	WriteObject(FEasyJsonPathV2(AccessString), Object);
+}
+
+void FEasyJsonWriteBatchV2::WriteInt(const FEasyJsonPathV2& Path, int32 Value)
+{
+	AddWrite(Path, MakeShareable(new FJsonValueNumber(static_cast<double>(Value))));
+}
+
+void FEasyJsonWriteBatchV2::WriteFloat(const FEasyJsonPathV2& Path, float Value)
+{
+	AddWrite(Path, MakeShareable(new FJsonValueNumber(static_cast<double>(Value))));
+}
+
+void FEasyJsonWriteBatchV2::WriteString(const FEasyJsonPathV2& Path, const FString& Value)
+{
+	AddWrite(Path, MakeShareable(new FJsonValueString(Value)));
+}
+
+void FEasyJsonWriteBatchV2::WriteBool(const FEasyJsonPathV2& Path, bool Value)
+{
+	AddWrite(Path, MakeShareable(new FJsonValueBoolean(Value)));
+}
+
+void FEasyJsonWriteBatchV2::WriteObject(const FEasyJsonPathV2& Path, const FEasyJsonObjectV2& Object)
+{
+	if (!Object.IsValid())
+	{
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("InvalidObject"), TEXT("Cannot write invalid object"));
+		return;
+	}
+	
+	AddWrite(Path, MakeShareable(new FJsonValueObject(Object.ToJsonObject())));
+}
+
+void FEasyJsonWriteBatchV2::Reset()
+{
+	Writes.Reset();
+	Children.Reset();
+	Nodes.Reset();
+	Nodes.AddDefaulted();
+}
+
+void FEasyJsonWriteBatchV2::AddWrite(const FEasyJsonPathV2& Path, TSharedPtr<FJsonValue>&& Value)
+{
+	// Rejected like FEasyJsonObjectV2::CreateValue rejects them
+	if (!Path.IsValid())
+	{
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("EmptyPath"), TEXT("Access string is empty"));
+		return;
+	}
+	if (Path.GetMaxArrayDepth() > 1)
+	{
+		EASYJSON_DEBUG_ERROR(Path.GetAccessString(), TEXT("UnsupportedPath"), TEXT("Multi-dimensional indices are not supported when writing"));
+		return;
+	}
+	
+	FWrite& Write = Writes.AddDefaulted_GetRef();
+	Write.Path = Path;
+	Write.Value = MoveTemp(Value);
+	
+	// Steps are taken from the stored path, which keeps them alive for the nodes
+	const TArray<FAccessStep>& Steps = Write.Path.GetSteps();
+	int32 NodeIndex = 0;
+	for (int32 Depth = 0; Depth < Steps.Num(); ++Depth)
+	{
+		const FAccessStep& Step = Steps[Depth];
+		NodeIndex = FindOrAddChild(NodeIndex, Step, Depth, INDEX_NONE);
+		if (Step.bIsArrayAccess)
+		{
+			NodeIndex = FindOrAddChild(NodeIndex, Step, Depth, Step.ArrayIndices[0]);
+		}
+	}
+	
+	Write.NodeIndex = NodeIndex;
+	Nodes[NodeIndex].ValueWrite = Writes.Num() - 1;
+}
+
+int32 FEasyJsonWriteBatchV2::FindOrAddChild(int32 ParentIndex, const FAccessStep& Step, int32 Depth, int32 ElementIndex)
+{
+	const FChildKey Key{ParentIndex, ElementIndex, &Step.PropertyName, Step.PropertyNameHash};
+	if (const int32* ChildIndex = Children.Find(Key))
+	{
+		return *ChildIndex;
+	}
+	
+	const int32 ChildIndex = Nodes.AddDefaulted();
+	FNode& Child = Nodes[ChildIndex];
+	Child.Step = &Step;
+	Child.Depth = Depth;
+	Child.ElementIndex = ElementIndex;
+	Child.ParentIndex = ParentIndex;
+	Child.FirstWrite = Writes.Num() - 1;
+	
+	FNode& Parent = Nodes[ParentIndex];
+	(ElementIndex == INDEX_NONE ? Parent.Members : Parent.Elements).Add(ChildIndex);
+	Children.Add(Key, ChildIndex);
+	return ChildIndex;
+}
+
+void FEasyJsonWriteBatchV2::Apply(FEasyJsonObjectV2& Target) const
+{
+	EASYJSON_DEBUG_SCOPE(FString::Printf(TEXT("WriteBatch.Apply(%d writes)"), Writes.Num()));
+	
+	Target.DetachFromDocument();
+	if (!Target.IsValid())
+	{
+		Target.InnerObject = MakeShareable(new FJsonObject());
+	}
+	
+	ApplyMembers(Target, *Target.InnerObject, 0);
+}
+
+void FEasyJsonWriteBatchV2::ApplyMembers(FEasyJsonObjectV2& Target, FJsonObject& Object, int32 NodeIndex) const
+{
+	for (const int32 FieldIndex : Nodes[NodeIndex].Members)
+	{
+		ApplyField(Target, Object, FieldIndex);
+	}
+}
+
+void FEasyJsonWriteBatchV2::ApplyField(FEasyJsonObjectV2& Target, FJsonObject& Object, int32 NodeIndex) const
+{
+	const FNode& Node = Nodes[NodeIndex];
+	const FAccessStep& Step = *Node.Step;
+	TSharedPtr<FJsonValue>* Field = Object.Values.FindByHash(Step.PropertyNameHash, Step.PropertyName);
+	const bool bExists = Field != nullptr && Field->IsValid();
+	
+	bool bElementMembers = false;
+	bool bMixedElement = false;
+	for (const int32 ElementIndex : Node.Elements)
+	{
+		const FNode& Element = Nodes[ElementIndex];
+		bElementMembers |= Element.Members.Num() > 0;
+		bMixedElement |= Element.Members.Num() > 0 && Element.ValueWrite != INDEX_NONE;
+	}
+	
+	// Cases where the outcome depends on the order of the writes (a value replaced by writes below it,
+	// or writes that pass through a field of another type) keep the one-by-one behavior
+	const bool bOneByOne = (Node.ValueWrite != INDEX_NONE && (Node.Members.Num() > 0 || Node.Elements.Num() > 0))
+		|| (Node.Members.Num() > 0 && Node.Elements.Num() > 0)
+		|| bMixedElement
+		|| (bExists && Node.Members.Num() > 0 && (*Field)->Type != EJson::Object)
+		|| (bExists && bElementMembers && (*Field)->Type != EJson::Array);
+	if (bOneByOne)
+	{
+		ApplyOneByOne(Target, NodeIndex);
+		return;
+	}
+	
+	if (Node.ValueWrite != INDEX_NONE)
+	{
+		Object.Values.AddByHash(Step.PropertyNameHash, Step.PropertyName, Writes[Node.ValueWrite].Value);
+		return;
+	}
+	
+	if (Node.Members.Num() > 0)
+	{
+		TSharedPtr<FJsonObject> ChildObject;
+		const TSharedPtr<FJsonObject>* ObjectPtr;
+		if (bExists && (*Field)->TryGetObject(ObjectPtr))
+		{
+			ChildObject = *ObjectPtr;
+		}
+		else
+		{
+			ChildObject = MakeShareable(new FJsonObject());
+			Object.Values.AddByHash(Step.PropertyNameHash, Step.PropertyName, MakeShareable(new FJsonValueObject(ChildObject)));
+		}
+		ApplyMembers(Target, *ChildObject, NodeIndex);
+		return;
+	}
+	
+	// A missing array created by a write that continues two or more steps below the element starts out
+	// filled with objects, as FEasyJsonObjectV2::CreateOrGetObject creates it
+	const FWrite& FirstWrite = Writes[Node.FirstWrite];
+	if (!bExists && Node.Depth + 2 < FirstWrite.Path.Num())
+	{
+		const int32 NumElements = FirstWrite.Path.GetSteps()[Node.Depth].ArrayIndices[0] + 1;
+		TArray<TSharedPtr<FJsonValue>> NewArray;
+		NewArray.Reserve(NumElements);
+		for (int32 Index = 0; Index < NumElements; ++Index)
+		{
+			NewArray.Add(MakeShareable(new FJsonValueObject(MakeShareable(new FJsonObject()))));
+		}
+		Object.Values.AddByHash(Step.PropertyNameHash, Step.PropertyName, MakeShareable(new FJsonValueArray(MoveTemp(NewArray))));
+	}
+	
+	TArray<TSharedPtr<FJsonValue>>& Array = EasyJsonObject::FindOrAddArrayField(Object, Step);
+	for (const int32 ElementIndex : Node.Elements)
+	{
+		const FNode& Element = Nodes[ElementIndex];
+		EasyJsonObject::PadArray(Array, Element.ElementIndex);
+		
+		TSharedPtr<FJsonValue>& Slot = Array[Element.ElementIndex];
+		if (Element.ValueWrite != INDEX_NONE)
+		{
+			Slot = Writes[Element.ValueWrite].Value;
+			continue;
+		}
+		
+		TSharedPtr<FJsonObject> ElementObject;
+		const TSharedPtr<FJsonObject>* ObjectPtr;
+		if (Slot.IsValid() && Slot->Type == EJson::Object && Slot->TryGetObject(ObjectPtr))
+		{
+			ElementObject = *ObjectPtr;
+		}
+		else
+		{
+			ElementObject = MakeShareable(new FJsonObject());
+			Slot = MakeShareable(new FJsonValueObject(ElementObject));
+		}
+		ApplyMembers(Target, *ElementObject, ElementIndex);
+	}
+}
+
+void FEasyJsonWriteBatchV2::ApplyOneByOne(FEasyJsonObjectV2& Target, int32 NodeIndex) const
+{
+	for (int32 WriteIndex = Nodes[NodeIndex].FirstWrite; WriteIndex < Writes.Num(); ++WriteIndex)
+	{
+		const FWrite& Write = Writes[WriteIndex];
+		
+		// Only writes whose path goes through the node
+		int32 AncestorIndex = Write.NodeIndex;
+		while (AncestorIndex > NodeIndex)
+		{
+			AncestorIndex = Nodes[AncestorIndex].ParentIndex;
+		}
+		if (AncestorIndex == NodeIndex)
+		{
+			Target.CreateValue(Write.Path, Write.Value);
+		}
+	}
+}
@@ -0,0 +1,351 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "EasyJsonWriterV2.h"
+#include "EasyJsonDocumentV2.h"
+#include "EasyJsonTextV2.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Serialization/Archive.h"
+
+FEasyJsonWriterV2::FEasyJsonWriterV2(FArchive& InArchive, bool bInPrettyPrint, int32 InBufferSize)
+	: Archive(InArchive)
+	, bPrettyPrint(bInPrettyPrint)
+{
+	// Room for the longest single token written through Reserve
+	Buffer.SetNumUninitialized(FMath::Max(InBufferSize, 64));
+}
+
+FEasyJsonWriterV2::~FEasyJsonWriterV2()
+{
+	Flush();
+}
+
+void FEasyJsonWriterV2::WriteObject(const FEasyJsonObjectV2& Object)
+{
+	if (Object.IsDocumentView())
+	{
+		WriteDocumentValue(*Object.GetDocument(), Object.GetDocumentIndex());
+	}
+	else if (Object.IsValid())
+	{
+		WriteJsonObject(Object.ToJsonObject());
+	}
+}
+
+void FEasyJsonWriterV2::WriteValue(const TSharedPtr<FJsonValue>& Value)
+{
+	WriteJsonValue(Value);
+}
+
+void FEasyJsonWriterV2::Flush()
+{
+	if (BufferNum > 0)
+	{
+		Archive.Serialize(Buffer.GetData(), BufferNum);
+		BytesFlushed += BufferNum;
+		BufferNum = 0;
+	}
+}
+
+bool FEasyJsonWriterV2::IsError() const
+{
+	return Archive.IsError();
+}
+
+bool FEasyJsonWriterV2::WriteToFile(const FEasyJsonObjectV2& Object, const FString& FilePath, bool bPrettyPrint, FString& OutErrorMessage)
+{
+	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!FileWriter.IsValid())
+	{
+		OutErrorMessage = FString::Printf(TEXT("Failed to open file for writing: %s"), *FilePath);
+		return false;
+	}
+	
+	{
+		FEasyJsonWriterV2 Writer(*FileWriter, bPrettyPrint);
+		Writer.WriteObject(Object);
+	}
+	
+	if (!FileWriter->Close())
+	{
+		OutErrorMessage = FString::Printf(TEXT("Failed to save file: %s"), *FilePath);
+		return false;
+	}
+	
+	OutErrorMessage.Empty();
+	return true;
+}
+
+void FEasyJsonWriterV2::WriteJsonValue(const TSharedPtr<FJsonValue>& Value)
+{
+	if (!Value.IsValid())
+	{
+		WriteAnsi("null", 4);
+		LastToken = ELastToken::ShortValue;
+		return;
+	}
+	
+	switch (Value->Type)
+	{
+	case EJson::String:
+		WriteString(Value->AsString());
+		LastToken = ELastToken::String;
+		break;
+	case EJson::Number:
+		WriteNumber(Value->AsNumber());
+		LastToken = ELastToken::ShortValue;
+		break;
+	case EJson::Boolean:
+		Value->AsBool() ? WriteAnsi("true", 4) : WriteAnsi("false", 5);
+		LastToken = ELastToken::ShortValue;
+		break;
+	case EJson::Array:
+	{
+		BeginArray();
+		for (const TSharedPtr<FJsonValue>& Element : Value->AsArray())
+		{
+			BeginElement(Element.IsValid() && (Element->Type == EJson::Array || Element->Type == EJson::Object));
+			WriteJsonValue(Element);
+		}
+		EndArray();
+		break;
+	}
+	case EJson::Object:
+		WriteJsonObject(Value->AsObject());
+		break;
+	default:
+		WriteAnsi("null", 4);
+		LastToken = ELastToken::ShortValue;
+		break;
+	}
+}
+
+void FEasyJsonWriterV2::WriteJsonObject(const TSharedPtr<FJsonObject>& Object)
+{
+	BeginObject();
+	if (Object.IsValid())
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object->Values)
+		{
+			WriteKey(Field.Key);
+			WriteJsonValue(Field.Value);
+		}
+	}
+	EndObject();
+}
+
+void FEasyJsonWriterV2::WriteDocumentValue(const FEasyJsonDocumentV2& Document, int32 Index)
+{
+	if (Document.IsLazy())
+	{
+		// Lazy documents hold no tape; the value is parsed once and written from the tree
+		WriteJsonValue(Document.ToJsonValue(Index));
+		return;
+	}
+	
+	switch (Document.GetType(Index))
+	{
+	case EEasyJsonTapeType::String:
+		WriteString(Document.GetString(Index));
+		LastToken = ELastToken::String;
+		break;
+	case EEasyJsonTapeType::Number:
+		WriteNumber(Document.GetNumber(Index));
+		LastToken = ELastToken::ShortValue;
+		break;
+	case EEasyJsonTapeType::True:
+		WriteAnsi("true", 4);
+		LastToken = ELastToken::ShortValue;
+		break;
+	case EEasyJsonTapeType::False:
+		WriteAnsi("false", 5);
+		LastToken = ELastToken::ShortValue;
+		break;
+	case EEasyJsonTapeType::Array:
+	{
+		BeginArray();
+		const int32 EndIndex = Document.GetEndIndex(Index);
+		for (int32 ChildIndex = Document.GetFirstChildIndex(Index); ChildIndex < EndIndex; ChildIndex = Document.GetNextIndex(ChildIndex))
+		{
+			const EEasyJsonTapeType ChildType = Document.GetType(ChildIndex);
+			BeginElement(ChildType == EEasyJsonTapeType::Array || ChildType == EEasyJsonTapeType::Object);
+			WriteDocumentValue(Document, ChildIndex);
+		}
+		EndArray();
+		break;
+	}
+	case EEasyJsonTapeType::Object:
+	{
+		// Only the last of duplicate keys is written, as the engine tree would keep it.
+		// The last value of each key id is found in one pass, before nested objects reuse the scratch map.
+		const int32 EndIndex = Document.GetEndIndex(Index);
+		LastValueByKeyId.Reset();
+		for (int32 KeyIndex = Document.GetFirstChildIndex(Index); KeyIndex < EndIndex; KeyIndex = Document.GetNextIndex(KeyIndex + 1))
+		{
+			const int32 KeyId = Document.GetKeyId(KeyIndex);
+			if (KeyId != INDEX_NONE)
+			{
+				LastValueByKeyId.Add(KeyId, KeyIndex + 1);
+			}
+		}
+		
+		TArray<int32, TInlineAllocator<32>> KeyIndices;
+		for (int32 KeyIndex = Document.GetFirstChildIndex(Index); KeyIndex < EndIndex; KeyIndex = Document.GetNextIndex(KeyIndex + 1))
+		{
+			// Keys without a stored id (beyond 16M distinct keys) are compared by name
+			const int32 KeyId = Document.GetKeyId(KeyIndex);
+			const int32 LastValueIndex = KeyId != INDEX_NONE ? LastValueByKeyId.FindChecked(KeyId) : Document.FindField(Index, Document.GetString(KeyIndex));
+			if (LastValueIndex == KeyIndex + 1)
+			{
+				KeyIndices.Add(KeyIndex);
+			}
+		}
+		
+		BeginObject();
+		for (const int32 KeyIndex : KeyIndices)
+		{
+			WriteKey(Document.GetString(KeyIndex));
+			WriteDocumentValue(Document, KeyIndex + 1);
+		}
+		EndObject();
+		break;
+	}
+	default:
+		WriteAnsi("null", 4);
+		LastToken = ELastToken::ShortValue;
+		break;
+	}
+}
+
+void FEasyJsonWriterV2::BeginObject()
+{
+	WriteChar('{');
+	++IndentLevel;
+	LastToken = ELastToken::Open;
+}
+
+void FEasyJsonWriterV2::EndObject()
+{
+	--IndentLevel;
+	WriteNewLine();
+	WriteChar('}');
+	LastToken = ELastToken::Close;
+}
+
+void FEasyJsonWriterV2::BeginArray()
+{
+	WriteChar('[');
+	++IndentLevel;
+	LastToken = ELastToken::Open;
+}
+
+void FEasyJsonWriterV2::EndArray()
+{
+	--IndentLevel;
+	if (LastToken == ELastToken::ShortValue)
+	{
+		if (bPrettyPrint)
+		{
+			WriteChar(' ');
+		}
+	}
+	else if (LastToken != ELastToken::Open)
+	{
+		WriteNewLine();
+	}
+	WriteChar(']');
+	LastToken = ELastToken::Close;
+}
+
+void FEasyJsonWriterV2::BeginElement(bool bContainer)
+{
+	if (LastToken != ELastToken::Open)
+	{
+		WriteChar(',');
+	}
+	
+	// Scalars stay on the line after an opening bracket or a number, boolean or null; containers start a new one
+	if (!bContainer && (LastToken == ELastToken::Open || LastToken == ELastToken::ShortValue))
+	{
+		if (bPrettyPrint)
+		{
+			WriteChar(' ');
+		}
+	}
+	else
+	{
+		WriteNewLine();
+	}
+}
+
+void FEasyJsonWriterV2::WriteKey(FStringView Key)
+{
+	if (LastToken != ELastToken::Open)
+	{
+		WriteChar(',');
+	}
+	WriteNewLine();
+	WriteString(Key);
+	WriteChar(':');
+	if (bPrettyPrint)
+	{
+		WriteChar(' ');
+	}
+	LastToken = ELastToken::Key;
+}
+
+void FEasyJsonWriterV2::WriteNewLine()
+{
+	if (!bPrettyPrint)
+	{
+		return;
+	}
+	
+	WriteAnsi(LINE_TERMINATOR_ANSI, sizeof(LINE_TERMINATOR_ANSI) - 1);
+	for (int32 Level = 0; Level < IndentLevel; ++Level)
+	{
+		WriteChar('\t');
+	}
+}
+
+void FEasyJsonWriterV2::WriteNumber(double Value)
+{
+	ANSICHAR Chars[32];
+	const int32 Length = EasyJsonText::FormatNumber(Value, Chars);
+	if (Length == 0)
+	{
+		WriteAnsi("null", 4);
+		return;
+	}
+	WriteAnsi(Chars, Length);
+}
+
+void FEasyJsonWriterV2::WriteString(FStringView Value)
+{
+	WriteChar('"');
+	
+	const TCHAR* Chars = Value.GetData();
+	const int32 Length = Value.Len();
+	for (int32 CharIndex = 0; CharIndex < Length; ++CharIndex)
+	{
+		BufferNum += EasyJsonText::EncodeCharacter(Chars, Length, CharIndex, Reserve(EasyJsonText::MaxCharacterBytes));
+	}
+	
+	WriteChar('"');
+}
+
+void FEasyJsonWriterV2::WriteAnsi(const ANSICHAR* Chars, int32 Count)
+{
+	while (Count > 0)
+	{
+		if (BufferNum == Buffer.Num())
+		{
+			Flush();
+		}
+		const int32 Chunk = FMath::Min(Count, Buffer.Num() - BufferNum);
+		FMemory::Memcpy(Buffer.GetData() + BufferNum, Chars, Chunk);
+		BufferNum += Chunk;
+		Chars += Chunk;
+		Count -= Chunk;
+	}
+}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/StringView.h"
 #include "AdvancedAccessParser.generated.h"
 
 USTRUCT(BlueprintType)
@@ -19,16 +20,22 @@ struct EASYJSONPARSERV2_API FAccessStep
 	UPROPERTY(BlueprintReadOnly, Category = "EasyJsonParserV2|Load")
 	bool bIsArrayAccess = false;
 
+	// Case-insensitive hash of PropertyName (GetTypeHash), so field lookups skip rehashing the name.
+	// Computed by the constructors; call UpdatePropertyNameHash() after changing PropertyName.
+	uint32 PropertyNameHash = 0;
+
 	FAccessStep()
 		: PropertyName(TEXT(""))
 		, bIsArrayAccess(false)
 	{
+		UpdatePropertyNameHash();
 	}
 
 	FAccessStep(const FString& InPropertyName)
 		: PropertyName(InPropertyName)
 		, bIsArrayAccess(false)
 	{
+		UpdatePropertyNameHash();
 	}
 
 	FAccessStep(const FString& InPropertyName, const TArray<int32>& InArrayIndices)
@@ -36,9 +43,98 @@ struct EASYJSONPARSERV2_API FAccessStep
 		, ArrayIndices(InArrayIndices)
 		, bIsArrayAccess(true)
 	{
+		UpdatePropertyNameHash();
+	}
+
+	FORCEINLINE void UpdatePropertyNameHash()
+	{
+		PropertyNameHash = GetTypeHash(PropertyName);
 	}
 };
 
+/**
+ * Access step produced by FAccessStringTokenizer.
+ * The property name is a view into the tokenized string and the indices are stored inline,
+ * so tokenizing a typical path does not touch the heap.
+ */
+struct EASYJSONPARSERV2_API FAccessToken
+{
+	// Property name (view into the tokenized access string)
+	FStringView PropertyName;
+
+	// Array indices in access order
+	TArray<int32, TInlineAllocator<4>> ArrayIndices;
+
+	// True if the component strictly matches identifier followed by [index] groups
+	bool bWellFormed = false;
+
+	// False if text after the property name is not a sequence of index groups (that text is ignored)
+	bool bIndicesValid = true;
+
+	FORCEINLINE bool IsArrayAccess() const { return ArrayIndices.Num() > 0; }
+};
+
+typedef TArray<FAccessToken, TInlineAllocator<8>> FAccessTokenArray;
+
+/**
+ * Single-pass, regex-free access string tokenizer
+ */
+class EASYJSONPARSERV2_API FAccessStringTokenizer
+{
+public:
+	/**
+	 * Split an access string into tokens. Whitespace around dots and brackets is ignored and
+	 * empty components are skipped, matching SanitizeAccessString + ParseAccessString.
+	 * @param AccessString The access string to tokenize (must outlive the tokens)
+	 * @param OutTokens Receives one token per non-empty component
+	 * @param bAllowSelectors Also accept [*] (stored as AnyIndex) and components made only of index groups
+	 */
+	static void Tokenize(FStringView AccessString, FAccessTokenArray& OutTokens, bool bAllowSelectors = false);
+
+	/**
+	 * Tokenize a single component (the text between two dots)
+	 * @param Component The component to tokenize
+	 * @param OutToken Receives the property name and indices
+	 * @param bAllowSelectors Also accept [*] (stored as AnyIndex) and components made only of index groups
+	 * @return False if the component has no property name (and, with selectors, no index either)
+	 */
+	static bool TokenizeComponent(FStringView Component, FAccessToken& OutToken, bool bAllowSelectors = false);
+
+	/**
+	 * Check that a component strictly matches identifier([digits])* with no whitespace
+	 * @param Component The component to check
+	 * @return True if the component is well formed
+	 */
+	static bool IsWellFormedComponent(FStringView Component);
+
+	// Index stored for a [*] group when selectors are allowed
+	static constexpr int32 AnyIndex = -2;
+};
+
+/**
+ * Statistics of the process-wide parsed access string cache
+ */
+struct EASYJSONPARSERV2_API FAccessStringCacheStats
+{
+	// Lookups answered from the cache
+	uint64 Hits = 0;
+
+	// Lookups that had to parse the access string
+	uint64 Misses = 0;
+
+	// Entries dropped because a shard was full
+	uint64 Evictions = 0;
+
+	// Entries currently cached
+	int32 NumEntries = 0;
+
+	// Maximum number of cached entries
+	int32 Capacity = 0;
+};
+
+// Shared immutable result of parsing an access string
+typedef TSharedRef<const TArray<FAccessStep>, ESPMode::ThreadSafe> FAccessStepsRef;
+
 /**
  * Advanced access string parser that supports nested array access patterns
  * like "matrix[0][1]", "data[1][2][0]", "users[0].contacts[1].emails[0]"
@@ -53,6 +149,29 @@ public:
 	 */
 	static TArray<FAccessStep> ParseAccessString(const FString& AccessString);
 
+	/**
+	 * Parse an access string through the process-wide cache.
+	 * Safe to call from any thread; the returned steps must not be modified.
+	 * @param AccessString The access string to parse
+	 * @return Shared parsed steps (empty if the access string could not be parsed)
+	 */
+	static FAccessStepsRef ParseAccessStringCached(const FString& AccessString);
+
+	/**
+	 * Get hit/miss statistics of the parse cache
+	 * @return Current cache statistics
+	 */
+	static FAccessStringCacheStats GetCacheStats();
+
+	/**
+	 * Drop all cached entries, reset the statistics and set the capacity
+	 * @param MaxEntries Maximum number of cached access strings (0 disables the cache)
+	 */
+	static void ResetCache(int32 MaxEntries = DefaultCacheCapacity);
+
+	// Default maximum number of cached access strings
+	static constexpr int32 DefaultCacheCapacity = 4096;
+
 	/**
 	 * Validate if an access string has correct syntax
 	 * @param AccessString The access string to validate
@@ -0,0 +1,78 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Linear bump allocator.
+ * Memory is handed out from large blocks and is only released all at once, when the arena is
+ * reset or destroyed; nothing allocated from it is destructed.
+ * An arena sized up front with the total it will hand out performs exactly one heap allocation.
+ */
+class EASYJSONPARSERV2_API FEasyJsonArenaV2
+{
+public:
+	FEasyJsonArenaV2() = default;
+
+	/**
+	 * @param InitialBlockSize Usable bytes of the first block (allocated on the first request)
+	 */
+	explicit FEasyJsonArenaV2(SIZE_T InitialBlockSize);
+
+	~FEasyJsonArenaV2();
+
+	FEasyJsonArenaV2(const FEasyJsonArenaV2&) = delete;
+	FEasyJsonArenaV2& operator=(const FEasyJsonArenaV2&) = delete;
+	FEasyJsonArenaV2(FEasyJsonArenaV2&& Other);
+	FEasyJsonArenaV2& operator=(FEasyJsonArenaV2&& Other);
+
+	/**
+	 * Allocate uninitialized memory
+	 * @param Size Number of bytes
+	 * @param Alignment Required alignment (power of two, at most 16)
+	 * @return The memory, or null if Size is 0
+	 */
+	void* Allocate(SIZE_T Size, SIZE_T Alignment = alignof(uint64));
+
+	// Allocate an uninitialized array of a trivially destructible type
+	template <typename T>
+	FORCEINLINE T* AllocateArray(int32 Count)
+	{
+		static_assert(std::is_trivially_destructible_v<T>, "Arena memory is never destructed");
+		return static_cast<T*>(Allocate(static_cast<SIZE_T>(Count) * sizeof(T), alignof(T)));
+	}
+
+	// Release everything; the newest block is kept for reuse
+	void Reset();
+
+	// Bytes of all blocks, including unused space
+	SIZE_T GetAllocatedSize() const;
+
+	// Bytes handed out since the last reset (including alignment padding)
+	SIZE_T GetUsedSize() const;
+
+	int32 GetNumBlocks() const;
+
+private:
+	// Header stored at the start of every block, so a block is one heap allocation
+	struct alignas(16) FBlock
+	{
+		FBlock* Previous;
+		SIZE_T Size;
+	};
+
+	void AddBlock(SIZE_T MinUsableSize);
+	void FreeBlocks(FBlock* Block);
+
+	// Size of the first block, and of later blocks before doubling
+	static constexpr SIZE_T DefaultBlockSize = 4096;
+
+	FBlock* CurrentBlock = nullptr;
+	uint8* Cursor = nullptr;
+	uint8* End = nullptr;
+	SIZE_T NextBlockSize = DefaultBlockSize;
+
+	// Bytes handed out from blocks that are already full
+	SIZE_T UsedInPreviousBlocks = 0;
+};
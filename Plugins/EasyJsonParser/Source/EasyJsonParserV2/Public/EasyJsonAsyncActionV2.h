@@ -0,0 +1,44 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/ThreadSafeBool.h"
+#include "EasyJsonParserV2Enums.h"
+#include "EasyJsonAsyncActionV2.generated.h"
+
+/**
+ * Base of the V2 async nodes.
+ * The work runs on a task graph worker and only holds a weak reference to the action and the
+ * shared cancel flag, so the action can be cancelled or garbage collected while work is in flight.
+ */
+UCLASS(Abstract)
+class EASYJSONPARSERV2_API UEasyJsonAsyncActionV2 : public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Cancel the action. No result is delivered; work that already started finishes on its
+	 * worker and its result is discarded.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2|Async")
+	void Cancel();
+
+	// True once the action has been cancelled
+	UFUNCTION(BlueprintPure, Category = "EasyJsonParserV2|Async")
+	bool IsCancelled() const;
+
+	virtual void BeginDestroy() override;
+
+protected:
+	// Task graph thread for the requested priority
+	ENamedThreads::Type GetWorkerThread() const;
+
+	EEasyJsonAsyncPriorityV2 Priority = EEasyJsonAsyncPriorityV2::Normal;
+
+	// Set by Cancel (and when the action is destroyed); shared with the work in flight
+	TSharedRef<FThreadSafeBool, ESPMode::ThreadSafe> CancelFlag = MakeShared<FThreadSafeBool, ESPMode::ThreadSafe>(false);
+};
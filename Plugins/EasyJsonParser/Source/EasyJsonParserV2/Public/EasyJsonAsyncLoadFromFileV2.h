@@ -0,0 +1,45 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EasyJsonAsyncActionV2.h"
+#include "EasyJsonObjectV2.h"
+#include "EasyJsonAsyncLoadFromFileV2.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FEasyJsonAsyncLoadResultV2, const FEasyJsonObjectV2&, JsonObject, const FString&, ErrorMessage);
+
+/**
+ * Loads and parses a JSON file on a worker thread
+ */
+UCLASS()
+class EASYJSONPARSERV2_API UEasyJsonAsyncLoadFromFileV2 : public UEasyJsonAsyncActionV2
+{
+	GENERATED_BODY()
+
+public:
+	// Fires on the game thread with the parsed object
+	UPROPERTY(BlueprintAssignable)
+	FEasyJsonAsyncLoadResultV2 OnCompleted;
+
+	// Fires on the game thread with the reason the file could not be loaded
+	UPROPERTY(BlueprintAssignable)
+	FEasyJsonAsyncLoadResultV2 OnFailed;
+
+	/**
+	 * Load a JSON file without blocking the game thread
+	 * @param FilePath Path of the file
+	 * @param IsAbsolute True if FilePath is absolute (otherwise relative to the content directory)
+	 * @param Priority Worker thread priority
+	 * @param bMemoryMapped Map the file instead of reading it into memory
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2|Async", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true", AdvancedDisplay = "Priority,bMemoryMapped"))
+	static UEasyJsonAsyncLoadFromFileV2* AsyncLoadFromFile(UObject* WorldContextObject, const FString& FilePath, bool IsAbsolute, EEasyJsonAsyncPriorityV2 Priority = EEasyJsonAsyncPriorityV2::Normal, bool bMemoryMapped = false);
+
+	virtual void Activate() override;
+
+private:
+	FString JsonFile;
+	bool bIsAbsolute = false;
+	bool bUseMemoryMapping = false;
+};
@@ -0,0 +1,47 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EasyJsonAsyncActionV2.h"
+#include "EasyJsonObjectV2.h"
+#include "EasyJsonAsyncSaveToFileV2.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEasyJsonAsyncSaveResultV2, const FString&, ErrorMessage);
+
+/**
+ * Serializes a JSON object and writes it to a file on a worker thread.
+ * The object is copied when the node is called, so later changes to it are not saved.
+ */
+UCLASS()
+class EASYJSONPARSERV2_API UEasyJsonAsyncSaveToFileV2 : public UEasyJsonAsyncActionV2
+{
+	GENERATED_BODY()
+
+public:
+	// Fires on the game thread once the file is written
+	UPROPERTY(BlueprintAssignable)
+	FEasyJsonAsyncSaveResultV2 OnCompleted;
+
+	// Fires on the game thread with the reason the file could not be written
+	UPROPERTY(BlueprintAssignable)
+	FEasyJsonAsyncSaveResultV2 OnFailed;
+
+	/**
+	 * Save a JSON object without blocking the game thread
+	 * @param JsonObject The object to save, as it is at the time of the call
+	 * @param FilePath Path of the file
+	 * @param IsAbsolute True if FilePath is absolute (otherwise relative to the content directory)
+	 * @param Priority Worker thread priority
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2|Async", meta = (WorldContext = "WorldContextObject", BlueprintInternalUseOnly = "true", AdvancedDisplay = "Priority"))
+	static UEasyJsonAsyncSaveToFileV2* AsyncSaveToFile(UObject* WorldContextObject, const FEasyJsonObjectV2& JsonObject, const FString& FilePath, bool IsAbsolute, EEasyJsonAsyncPriorityV2 Priority = EEasyJsonAsyncPriorityV2::Normal);
+
+	virtual void Activate() override;
+
+private:
+	// Immutable snapshot of the object to save
+	FEasyJsonObjectV2 JsonObject;
+	FString JsonFile;
+	bool bIsAbsolute = false;
+};
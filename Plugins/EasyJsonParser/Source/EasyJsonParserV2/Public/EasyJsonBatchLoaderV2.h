@@ -0,0 +1,71 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EasyJsonObjectV2.h"
+
+/**
+ * Result of one file of a batch
+ */
+struct EASYJSONPARSERV2_API FEasyJsonBatchFileResultV2
+{
+	// Position of the file in the list passed to the loader
+	int32 FileIndex = INDEX_NONE;
+
+	FString FilePath;
+	FEasyJsonObjectV2 Object;
+	bool bSuccess = false;
+	FString ErrorMessage;
+
+	// Size of the file in bytes
+	int64 FileSize = 0;
+
+	// Time spent reading the file and parsing it
+	double ReadSeconds = 0.0;
+	double ParseSeconds = 0.0;
+};
+
+/**
+ * Loads many JSON files at once.
+ * A bounded number of workers each take the next file from the list. Every worker reads its next
+ * file on the engine thread pool while it parses the current one, overlapping disk reads with parsing,
+ * so up to twice MaxConcurrency file buffers are in memory at a time. LoadAll also keeps every
+ * parsed result until it returns; Load hands each one over instead.
+ */
+class EASYJSONPARSERV2_API FEasyJsonBatchLoaderV2
+{
+public:
+	/**
+	 * @param InMaxConcurrency Number of files processed at once (0 = one per task graph worker)
+	 */
+	explicit FEasyJsonBatchLoaderV2(int32 InMaxConcurrency = 0);
+
+	/**
+	 * Load every file and wait for all of them
+	 * @param FilePaths Absolute paths of the files
+	 * @return One result per file, in the order of FilePaths
+	 */
+	TArray<FEasyJsonBatchFileResultV2> LoadAll(const TArray<FString>& FilePaths) const;
+
+	/**
+	 * Load every file and hand each result over as soon as it is parsed.
+	 * The callback runs on worker threads, concurrently and in completion order; the call returns once every file is done.
+	 * @param FilePaths Absolute paths of the files
+	 * @param OnFileLoaded Receives each result
+	 * @return true if every file loaded
+	 */
+	bool Load(const TArray<FString>& FilePaths, TFunctionRef<void(FEasyJsonBatchFileResultV2&& Result)> OnFileLoaded) const;
+
+	/**
+	 * Write the slowest files of a batch to the debug log (debug level Detailed or higher)
+	 * @param Results Results of a batch
+	 * @param MaxFiles Number of files to report
+	 */
+	static void LogTimings(const TArray<FEasyJsonBatchFileResultV2>& Results, int32 MaxFiles = 10);
+
+	FORCEINLINE int32 GetMaxConcurrency() const { return MaxConcurrency; }
+
+private:
+	int32 MaxConcurrency;
+};
@@ -0,0 +1,111 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Builds condensed JSON text directly as UTF-8, for output that is only serialized and never read back.
+ * No JSON tree is created: each call appends to one buffer, which keeps its capacity across Reset
+ * so a builder reused for every payload stops allocating once it has grown to the largest one.
+ * Calls chain, e.g. Builder.BeginObject().Key(TEXT("id")).Value(7).EndObject().
+ * A call out of place (a value where a key is expected, an unbalanced end, a second root value)
+ * writes nothing and marks the builder as failed.
+ */
+class EASYJSONPARSERV2_API FEasyJsonBuilderV2
+{
+public:
+	/**
+	 * @param InitialCapacity Bytes to reserve up front
+	 */
+	explicit FEasyJsonBuilderV2(int32 InitialCapacity = 0);
+	
+	FEasyJsonBuilderV2& BeginObject();
+	FEasyJsonBuilderV2& EndObject();
+	FEasyJsonBuilderV2& BeginArray();
+	FEasyJsonBuilderV2& EndArray();
+	
+	// Name of the next member of the open object
+	FEasyJsonBuilderV2& Key(FStringView Name);
+	
+	// Values: the root value, an array element or the value of the last key
+	FEasyJsonBuilderV2& Value(FStringView String);
+	FEasyJsonBuilderV2& Value(const TCHAR* String) { return Value(FStringView(String)); }
+	FEasyJsonBuilderV2& Value(const FString& String) { return Value(FStringView(String)); }
+	FEasyJsonBuilderV2& Value(bool bValue);
+	FEasyJsonBuilderV2& Value(int32 Number) { return Value(static_cast<int64>(Number)); }
+	FEasyJsonBuilderV2& Value(int64 Number);
+	FEasyJsonBuilderV2& Value(uint32 Number) { return Value(static_cast<int64>(Number)); }
+	FEasyJsonBuilderV2& Value(uint64 Number);
+	
+	// Narrow literals would otherwise convert to bool; wrap them in TEXT()
+	FEasyJsonBuilderV2& Value(const ANSICHAR* String) = delete;
+	
+	// NaN and infinities are written as null
+	FEasyJsonBuilderV2& Value(double Number);
+	FEasyJsonBuilderV2& Null();
+	
+	// Reserve hint: make room for at least this many more bytes
+	void Reserve(int32 Bytes);
+	
+	// Start a new document, keeping the buffer's capacity
+	void Reset();
+	
+	// True if a call was out of place
+	FORCEINLINE bool IsError() const { return bError; }
+	
+	// True once a whole root value has been written without errors
+	FORCEINLINE bool IsComplete() const { return !bError && bHasRoot && Containers.Num() == 0; }
+	
+	// The text so far as UTF-8 (no terminator); valid until the next call that writes
+	FORCEINLINE TArrayView<const uint8> GetUtf8() const { return TArrayView<const uint8>(Buffer.GetData(), BufferNum); }
+	
+	// Size of the text so far in bytes
+	FORCEINLINE int32 Num() const { return BufferNum; }
+	
+	// The text so far converted to an FString
+	FString ToString() const;
+
+private:
+	// Separator before a value; false (and the builder fails) if no value may go here
+	bool BeginValue();
+	
+	void WriteString(FStringView String);
+	
+	// Make room for Count more bytes and return where they go
+	FORCEINLINE uint8* Grow(int32 Count)
+	{
+		if (BufferNum + Count > Buffer.Num())
+		{
+			GrowBuffer(Count);
+		}
+		return Buffer.GetData() + BufferNum;
+	}
+	
+	FORCEINLINE void WriteChar(ANSICHAR Char)
+	{
+		*Grow(1) = static_cast<uint8>(Char);
+		++BufferNum;
+	}
+	
+	// Enlarge the buffer geometrically so that appending stays linear
+	void GrowBuffer(int32 Count);
+	
+	void WriteAnsi(const ANSICHAR* Chars, int32 Count);
+	
+	// An open object or array
+	struct FContainer
+	{
+		bool bObject = false;
+		bool bHasMembers = false;
+	};
+	
+	// Allocated bytes are Buffer.Num(); the text is the first BufferNum of them
+	TArray<uint8> Buffer;
+	int32 BufferNum = 0;
+	
+	TArray<FContainer, TInlineAllocator<16>> Containers;
+	bool bAfterKey = false;
+	bool bHasRoot = false;
+	bool bError = false;
+};
@@ -0,0 +1,85 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "EasyJsonObjectV2.h"
+
+/**
+ * Cache of parsed JSON files.
+ * Entries are keyed by absolute path and checked against the file's size and modification time
+ * on every lookup, so a changed file is parsed again. Files are kept as immutable documents:
+ * every caller shares one parsed copy, and writing to a returned object copies it first.
+ * When the documents outgrow the memory budget, the least recently used ones are dropped.
+ * All methods are thread-safe.
+ */
+class EASYJSONPARSERV2_API FEasyJsonDocumentCacheV2
+{
+public:
+	/**
+	 * @param InMaxBytes Memory budget for the cached documents
+	 */
+	explicit FEasyJsonDocumentCacheV2(int64 InMaxBytes = DefaultMaxBytes);
+
+	/**
+	 * Get a file from the cache, loading it if it is missing or changed on disk
+	 * @param FilePath Absolute path of the file
+	 * @param bSuccess Set to true if the file was loaded
+	 * @param ErrorMessage Receives the reason on failure
+	 * @return A view into the shared document
+	 */
+	FEasyJsonObjectV2 LoadFile(const FString& FilePath, bool& bSuccess, FString& ErrorMessage);
+
+	// Drop one file; the next lookup parses it again
+	void Invalidate(const FString& FilePath);
+
+	// Drop every file
+	void Clear();
+
+	// Change the memory budget (evicts right away if the cache is over it)
+	void SetMaxBytes(int64 InMaxBytes);
+
+	int64 GetMaxBytes() const;
+
+	// Memory held by the cached documents
+	int64 GetUsedBytes() const;
+
+	// Number of cached files
+	int32 Num() const;
+
+	// Lookups served from the cache, and lookups that had to load the file
+	int64 GetNumHits() const;
+	int64 GetNumMisses() const;
+
+	// The cache used by UEasyJsonParseManagerV2
+	static FEasyJsonDocumentCacheV2& Get();
+
+	static constexpr int64 DefaultMaxBytes = 64 * 1024 * 1024;
+
+private:
+	struct FEntry
+	{
+		FEasyJsonObjectV2 Object;
+
+		// File state the document was parsed from
+		int64 FileSize = 0;
+		FDateTime ModificationTime;
+
+		int64 Bytes = 0;
+		uint64 LastUse = 0;
+	};
+
+	static FString MakeKey(const FString& FilePath);
+
+	// Drop least recently used entries until the budget is met (lock held)
+	void EvictToBudget();
+
+	mutable FCriticalSection Lock;
+	TMap<FString, FEntry> Entries;
+	int64 MaxBytes;
+	int64 UsedBytes = 0;
+	uint64 UseCounter = 0;
+	int64 NumHits = 0;
+	int64 NumMisses = 0;
+};
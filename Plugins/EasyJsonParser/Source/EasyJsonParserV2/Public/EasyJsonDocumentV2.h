@@ -0,0 +1,254 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "EasyJsonArenaV2.h"
+#include "EasyJsonSourceV2.h"
+
+class FEasyJsonLazyIndexV2;
+
+namespace EasyJsonDocument
+{
+	template <typename CharType>
+	class TTapeBuilder;
+}
+
+/**
+ * Type of a tape entry
+ */
+enum class EEasyJsonTapeType : uint8
+{
+	Null = 0,
+	True,
+	False,
+	Number,
+	String,
+	Array,
+	Object,
+	Key
+};
+
+/**
+ * Immutable parsed JSON document stored as one flat tape of 64-bit entries plus one string buffer.
+ *
+ * Every value is an entry (the top 8 bits are its type):
+ * - Number: the entry is followed by one entry holding the double bits
+ * - String: the payload is the offset of the string in the string buffer (prefixed by its length)
+ * - Array/Object: the payload holds the index one past the last entry of the container (low 32 bits)
+ *   and the number of elements (high 24 bits, saturated); objects contain key/value entry pairs
+ * - Key: the payload is the offset of the key in the string buffer (low 32 bits) and its key id (high 24 bits)
+ *
+ * Keys are interned: each distinct spelling is stored once, and spellings that are equal ignoring case
+ * share a key id, so a field lookup hashes the name once and then compares integers.
+ *
+ * Values are addressed by their entry index; the root value is entry 0.
+ * Skipping a container is a single lookup, so scans touch only contiguous memory.
+ *
+ * The tape and the string buffer are sized up front and carved out of one arena block,
+ * so building a document is one allocation and destroying it is one free.
+ *
+ * A lazy document (ParseLazy) has no tape: it keeps the JSON text with its structural index,
+ * indices address positions in that index, and values are only parsed when they are read.
+ */
+class EASYJSONPARSERV2_API FEasyJsonDocumentV2
+{
+public:
+	/**
+	 * Parse a JSON document of any root type
+	 * @param Json The JSON text
+	 * @param OutErrorMessage Receives the reason when parsing fails
+	 * @return The document, or null if the input is not valid JSON
+	 */
+	static TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> Parse(FStringView Json, FString& OutErrorMessage);
+	static TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> Parse(FUtf8StringView Json, FString& OutErrorMessage);
+
+	/**
+	 * Copy an engine JSON tree into a document
+	 * @param Value The root value
+	 * @return The document, or null if Value is null
+	 */
+	static TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> FromJsonValue(const TSharedPtr<FJsonValue>& Value);
+
+	/**
+	 * Index a JSON document without parsing its values.
+	 * Loading only builds the structural index and matches brackets, so its cost does not depend on how
+	 * much is read; every read parses just the value it visits. Only the bracket structure is checked
+	 * up front: malformed values are not reported by the load and read as missing.
+	 * @param Json The JSON text (moved into the document)
+	 * @param OutErrorMessage Receives the reason when the structure is invalid
+	 * @return The document, or null on failure
+	 */
+	static TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> ParseLazy(FString&& Json, FString& OutErrorMessage);
+
+	/**
+	 * Index UTF-8 source bytes without parsing its values (see above); the document keeps the source alive
+	 * @param Source The JSON bytes (a leading BOM is skipped)
+	 * @param OutErrorMessage Receives the reason when the structure is invalid
+	 * @return The document, or null on failure
+	 */
+	static TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> ParseLazy(const TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe>& Source, FString& OutErrorMessage);
+
+	~FEasyJsonDocumentV2();
+
+	// Index of the root value
+	static constexpr int32 RootIndex = 0;
+
+	FORCEINLINE bool IsLazy() const { return Lazy.IsValid(); }
+
+	FORCEINLINE EEasyJsonTapeType GetType(int32 Index) const { return IsLazy() ? GetLazyType(Index) : static_cast<EEasyJsonTapeType>(Tape[Index] >> 56); }
+
+	// Index of the entry after the value at Index (skips containers)
+	int32 GetNextIndex(int32 Index) const;
+
+	double GetNumber(int32 Index) const;
+
+	// Number value; false if the value of a lazy document is not a valid number
+	bool TryGetNumber(int32 Index, double& OutNumber) const;
+
+	// View of a string in the string buffer (not available on lazy documents)
+	FStringView GetString(int32 Index) const;
+
+	// Copy of a string value (works on every document)
+	FString GetStringValue(int32 Index) const;
+
+	// Copy of a string value; false if the value of a lazy document is not a valid string
+	bool TryGetStringValue(int32 Index, FString& OutString) const;
+
+	// Number of elements of an array or fields of an object (0 for other types)
+	int32 GetNum(int32 Index) const;
+
+	/**
+	 * Find a field of an object.
+	 * Keys compare case-insensitively and the last duplicate wins, like FJsonObject.
+	 * @param ObjectIndex Index of the object
+	 * @param FieldName The key
+	 * @param FieldNameHash GetTypeHash of the key (e.g. FAccessStep::PropertyNameHash)
+	 * @return Index of the field's value, or INDEX_NONE
+	 */
+	int32 FindField(int32 ObjectIndex, FStringView FieldName, uint32 FieldNameHash) const;
+	FORCEINLINE int32 FindField(int32 ObjectIndex, FStringView FieldName) const { return FindField(ObjectIndex, FieldName, GetTypeHash(FieldName)); }
+
+	// Number of distinct key spellings stored in the document
+	FORCEINLINE int32 GetNumKeys() const { return Keys.Num(); }
+
+	/**
+	 * Id of the key at KeyIndex, shared by every key of the document that is equal ignoring case
+	 * (not available on lazy documents)
+	 * @return The id, or INDEX_NONE if there are too many distinct keys to store it (compare the names instead)
+	 */
+	FORCEINLINE int32 GetKeyId(int32 KeyIndex) const { return GetStoredKeyId(KeyIndex) < MaxStoredKeyId ? static_cast<int32>(GetStoredKeyId(KeyIndex)) : INDEX_NONE; }
+
+	/**
+	 * Find an element of an array
+	 * @param ArrayIndex Index of the array
+	 * @param ElementIndex Position of the element
+	 * @return Index of the element's value, or INDEX_NONE if out of range
+	 */
+	int32 GetArrayElement(int32 ArrayIndex, int32 ElementIndex) const;
+
+	// Indices of the first child entry and the entry after the last one (for iterating containers)
+	FORCEINLINE int32 GetFirstChildIndex(int32 Index) const { return Index + 1; }
+	FORCEINLINE int32 GetEndIndex(int32 Index) const { return IsLazy() ? GetLazyEndIndex(Index) : static_cast<int32>(Tape[Index] & 0xFFFFFFFFull); }
+
+	// Copy a value into an engine JSON tree
+	TSharedPtr<FJsonValue> ToJsonValue(int32 Index) const;
+	TSharedPtr<FJsonObject> ToJsonObject(int32 Index) const;
+
+	// Memory owned by the document
+	SIZE_T GetAllocatedSize() const;
+
+	// Number of tape entries and string buffer characters in use
+	FORCEINLINE int32 GetTapeNum() const { return TapeNum; }
+	FORCEINLINE int32 GetStringsNum() const { return StringsNum; }
+
+private:
+	template <typename CharType>
+	friend class EasyJsonDocument::TTapeBuilder;
+
+	// Element counts at or above this value are counted by walking the container
+	static constexpr uint32 MaxStoredCount = 0xFFFFFF;
+
+	// Key ids at or above this value are stored saturated and compared by name
+	static constexpr uint32 MaxStoredKeyId = 0xFFFFFF;
+
+	// String buffer elements used by the length prefix of each string
+	static constexpr int32 LengthPrefixChars = sizeof(uint32) > sizeof(TCHAR) ? sizeof(uint32) / sizeof(TCHAR) : 1;
+
+	FORCEINLINE static uint64 MakeEntry(EEasyJsonTapeType Type, uint64 Payload) { return (static_cast<uint64>(Type) << 56) | Payload; }
+	FORCEINLINE uint64 GetPayload(int32 Index) const { return Tape[Index] & 0x00FFFFFFFFFFFFFFull; }
+
+	// Out of line so the lazy index stays private
+	EEasyJsonTapeType GetLazyType(int32 Index) const;
+	int32 GetLazyEndIndex(int32 Index) const;
+	FORCEINLINE uint32 GetStoredKeyId(int32 Index) const { return static_cast<uint32>(GetPayload(Index) >> 32); }
+	FStringView GetStringAt(int32 Offset) const;
+
+	// Allocate the tape and string buffer with room for at most the given numbers of entries and characters
+	void AllocateStorage(int32 MaxEntries, int32 MaxChars);
+
+	// Move the contents into an exactly sized block when most of the reserved room went unused
+	void ShrinkStorage();
+
+	FORCEINLINE void AddEntry(uint64 Entry)
+	{
+		check(TapeNum < TapeMax);
+		Tape[TapeNum++] = Entry;
+	}
+
+	void AppendNumber(double Value);
+	void AppendString(const TCHAR* Chars, int32 Length);
+
+	// Add a string entry and return where its Length characters are to be written
+	TCHAR* AppendUninitializedString(int32 Length);
+
+	// Where the characters of the next string go (a key may be written here before AppendKey)
+	TCHAR* GetNextStringChars(int32 Length) const;
+
+	// Add a key entry, storing the characters only if this spelling is new
+	void AppendKey(FStringView Key);
+
+	// Id shared by all spellings of a key that are equal ignoring case, or INDEX_NONE if no object has the key
+	int32 FindKeyId(FStringView Key, uint32 KeyHash) const;
+
+	// Rebuild the key hash table with the given number of buckets
+	void RehashKeys(int32 NumBuckets);
+
+	void AppendJsonValue(const TSharedPtr<FJsonValue>& Value);
+
+	// Write the end index and element count of a container that starts at Index
+	void CloseContainer(int32 Index, int32 Count);
+
+	// Owns the memory of Tape and Strings
+	FEasyJsonArenaV2 Arena;
+
+	uint64* Tape = nullptr;
+	int32 TapeNum = 0;
+	int32 TapeMax = 0;
+
+	TCHAR* Strings = nullptr;
+	int32 StringsNum = 0;
+	int32 StringsMax = 0;
+
+	// One distinct key spelling
+	struct FKeyRecord
+	{
+		int32 StringOffset;
+		uint32 Hash;
+		int32 Id;
+	};
+
+	TArray<FKeyRecord> Keys;
+
+	// Open-addressed hash table of indices into Keys (power of two size, INDEX_NONE when empty)
+	TArray<int32> KeyBuckets;
+
+	// Number of key ids handed out
+	int32 NumKeyIds = 0;
+
+	// Set instead of the tape for lazy documents
+	TUniquePtr<FEasyJsonLazyIndexV2> Lazy;
+};
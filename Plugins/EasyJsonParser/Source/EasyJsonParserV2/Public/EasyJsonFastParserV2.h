@@ -0,0 +1,102 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "EasyJsonSourceV2.h"
+
+/**
+ * Instruction set used by the structural scan of the fast parser
+ */
+enum class EEasyJsonSimdLevel : uint8
+{
+	Scalar = 0,
+	SSE42 = 1,
+	AVX2 = 2
+};
+
+/**
+ * Two-stage JSON parser.
+ * Stage 1 scans the input 64 characters at a time with SIMD and records the position of
+ * every structural character, string start and scalar start. Stage 2 walks that index and
+ * builds the FJsonValue tree without looking at the characters in between.
+ * In large documents, big arrays found by the scan are split into chunks of elements that are
+ * parsed on worker threads and stitched back into the same tree.
+ */
+class EASYJSONPARSERV2_API FEasyJsonFastParserV2
+{
+public:
+	/**
+	 * Parse a JSON document of any root type
+	 * @param Json The JSON text
+	 * @param OutValue Receives the root value
+	 * @param OutErrorMessage Receives the reason when parsing fails
+	 * @return true if the whole input is a single valid JSON value
+	 */
+	static bool ParseValue(FStringView Json, TSharedPtr<FJsonValue>& OutValue, FString& OutErrorMessage);
+
+	/**
+	 * Parse UTF-8 JSON without widening the whole input first
+	 * (only keys and string values are converted to FString)
+	 * @param Json The JSON text as UTF-8 (without BOM)
+	 * @param OutValue Receives the root value
+	 * @param OutErrorMessage Receives the reason when parsing fails
+	 * @return true if the whole input is a single valid JSON value
+	 */
+	static bool ParseValue(FUtf8StringView Json, TSharedPtr<FJsonValue>& OutValue, FString& OutErrorMessage);
+
+	/**
+	 * Parse UTF-8 source bytes (e.g. a mapped file) without copying values.
+	 * Unescaped strings and numbers stay views into the source, which the values keep alive.
+	 * @param Source The JSON bytes (a leading BOM is skipped)
+	 * @param OutValue Receives the root value
+	 * @param OutErrorMessage Receives the reason when parsing fails
+	 * @return true if the whole input is a single valid JSON value
+	 */
+	static bool ParseValue(const TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe>& Source, TSharedPtr<FJsonValue>& OutValue, FString& OutErrorMessage);
+
+	/**
+	 * Parse a JSON document whose root is an object
+	 * @param Json The JSON text
+	 * @param OutObject Receives the root object
+	 * @param OutErrorMessage Receives the reason when parsing fails
+	 * @return true if the input is a valid JSON object
+	 */
+	static bool ParseObject(FStringView Json, TSharedPtr<FJsonObject>& OutObject, FString& OutErrorMessage);
+	static bool ParseObject(FUtf8StringView Json, TSharedPtr<FJsonObject>& OutObject, FString& OutErrorMessage);
+
+	/**
+	 * Parse with the fast parser and fall back to FJsonSerializer if it rejects the input,
+	 * so that anything the engine reader accepted before is still accepted
+	 * @param Json The JSON text
+	 * @param OutObject Receives the root object
+	 * @return true if either parser produced an object
+	 */
+	static bool ParseObjectWithFallback(const FString& Json, TSharedPtr<FJsonObject>& OutObject);
+	static bool ParseObjectWithFallback(FUtf8StringView Json, TSharedPtr<FJsonObject>& OutObject);
+	static bool ParseObjectWithFallback(const TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe>& Source, TSharedPtr<FJsonObject>& OutObject);
+
+	// Instruction set picked for this CPU (or the override set for testing)
+	static EEasyJsonSimdLevel GetSimdLevel();
+
+	/**
+	 * Limit the instruction set used by the structural scan (e.g. to compare tiers in tests)
+	 * @param MaxLevel Highest level to use; clamped to what the CPU supports
+	 */
+	static void SetMaxSimdLevel(EEasyJsonSimdLevel MaxLevel);
+
+	/**
+	 * Set the size from which documents are parsed in parallel
+	 * @param MinIndexEntries Number of structural index entries (roughly one per token); MAX_int32 disables parallel parsing
+	 */
+	static void SetParallelThreshold(int32 MinIndexEntries);
+
+	// Default parallel threshold (a few megabytes of typical JSON)
+	static constexpr int32 DefaultParallelThreshold = 256 * 1024;
+
+	// Maximum nesting depth accepted by the fast parser
+	static constexpr int32 MaxDepth = 512;
+};
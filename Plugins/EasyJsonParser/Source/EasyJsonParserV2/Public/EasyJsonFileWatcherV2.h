@@ -0,0 +1,91 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Misc/DateTime.h"
+#include "EasyJsonObjectV2.h"
+#include <atomic>
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnEasyJsonFileReloadedV2, const FString& /*FilePath*/, const FEasyJsonObjectV2& /*Snapshot*/);
+
+/**
+ * Keeps parsed snapshots of JSON files up to date while the game runs.
+ * The files are polled (this works on every platform, dedicated servers included): a check
+ * stats each file on a background thread and parses only those whose size or modification
+ * time changed. A new snapshot replaces the old one in a single swap, so readers get either
+ * the old or the new document and never parse on the game thread. Snapshots are immutable
+ * documents; a reader that writes to one gets its own copy.
+ * Create with Create(), since in-flight checks only hold a weak reference to the watcher.
+ */
+class EASYJSONPARSERV2_API FEasyJsonFileWatcherV2 : public TSharedFromThis<FEasyJsonFileWatcherV2, ESPMode::ThreadSafe>
+{
+public:
+	/**
+	 * @param PollInterval Seconds between checks once Start is called
+	 */
+	static TSharedRef<FEasyJsonFileWatcherV2, ESPMode::ThreadSafe> Create(float PollInterval = 1.0f);
+	
+	~FEasyJsonFileWatcherV2();
+	
+	/**
+	 * Start watching a file. The first snapshot is parsed on the calling thread.
+	 * @param FilePath Absolute path of the file
+	 * @param ErrorMessage Receives the reason if the file could not be loaded
+	 * @return true if the first snapshot was loaded
+	 */
+	bool Watch(const FString& FilePath, FString& ErrorMessage);
+	
+	// Stop watching a file
+	void Unwatch(const FString& FilePath);
+	
+	/**
+	 * The latest snapshot of a watched file (invalid if the file is not watched)
+	 * @param OutVersion Optional; receives a number that goes up with every reload
+	 */
+	FEasyJsonObjectV2 GetSnapshot(const FString& FilePath, int32* OutVersion = nullptr) const;
+	
+	// Error of the last reload of a file that failed (the previous snapshot stays published)
+	FString GetLastError(const FString& FilePath) const;
+	
+	// Poll on the core ticker, checking on a background thread every PollInterval seconds
+	void Start();
+	void Stop();
+	
+	/**
+	 * Check every watched file now, on the calling thread, and publish the changed ones
+	 * @return Paths of the files that were reloaded
+	 */
+	TArray<FString> CheckForChanges();
+	
+	// Fires on the game thread after polling published new snapshots
+	FORCEINLINE FOnEasyJsonFileReloadedV2& OnFileReloaded() { return FileReloadedEvent; }
+
+private:
+	explicit FEasyJsonFileWatcherV2(float InPollInterval);
+	
+	bool Tick(float DeltaTime);
+	
+	static FString MakeKey(const FString& FilePath);
+	
+	struct FWatchedFile
+	{
+		FEasyJsonObjectV2 Snapshot;
+		int64 FileSize = 0;
+		FDateTime ModificationTime;
+		int32 Version = 0;
+		FString LastError;
+	};
+	
+	float PollInterval;
+	FTSTicker::FDelegateHandle TickerHandle;
+	
+	// Set while a background check runs
+	std::atomic<bool> bCheckInFlight;
+	
+	mutable FRWLock Lock;
+	TMap<FString, FWatchedFile> Files;
+	
+	FOnEasyJsonFileReloadedV2 FileReloadedEvent;
+};
@@ -6,6 +6,8 @@
 #include "Dom/JsonObject.h"
 #include "EasyJsonValueV2.h"
 #include "AdvancedAccessParser.h"
+#include "EasyJsonPathV2.h"
+#include "EasyJsonSourceV2.h"
 #include "EasyJsonObjectV2.generated.h"
 
 USTRUCT(BlueprintType)
@@ -18,6 +20,9 @@ public:
 	FEasyJsonObjectV2();
 	FEasyJsonObjectV2(TSharedPtr<FJsonObject> InJsonObject);
 	
+	// View of an object inside a document (writes copy it into an engine JSON tree first)
+	FEasyJsonObjectV2(const TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe>& InDocument, int32 InDocumentIndex);
+	
 	// Copy constructor and assignment
 	FEasyJsonObjectV2(const FEasyJsonObjectV2& Other);
 	FEasyJsonObjectV2& operator=(const FEasyJsonObjectV2& Other);
@@ -36,20 +41,36 @@ public:
 	FEasyJsonObjectV2 ReadObject(const FString& AccessString, bool& bFound) const;
 	TArray<FEasyJsonObjectV2> ReadObjects(const FString& AccessString, bool& bFound) const;
 
-	// Write methods
+	/**
+	 * Cursor to the object at a path, created if missing (a document view is copied first).
+	 * The cursor shares that object, so relative reads and writes on it skip walking the prefix,
+	 * and writes through either object are seen by both. It stays valid while siblings are written;
+	 * replacing the object itself (e.g. WriteObject at its path) leaves the cursor on the old one.
+	 * @param AccessString Path of the object (e.g. "stats.combat" or "inventory[2]")
+	 * @return The cursor, or an invalid object if a value on the path is not an object
+	 */
+	FEasyJsonObjectV2 Cursor(const FString& AccessString);
+	FEasyJsonObjectV2 Cursor(const FEasyJsonPathV2& Path);
+
+	// Write methods (at most one index per step; paths such as "m[0][1]" write nothing)
 	void WriteInt(const FString& AccessString, int32 Value);
 	void WriteFloat(const FString& AccessString, float Value);
 	void WriteString(const FString& AccessString, const FString& Value);
 	void WriteBool(const FString& AccessString, bool Value);
 	void WriteObject(const FString& AccessString, const FEasyJsonObjectV2& Object);
 
-	// Array manipulation
+	// Array manipulation (the array is addressed by name; paths ending in an index write nothing)
 	void AddIntToArray(const FString& AccessString, int32 Value);
 	void AddFloatToArray(const FString& AccessString, float Value);
 	void AddStringToArray(const FString& AccessString, const FString& Value);
 	void AddBoolToArray(const FString& AccessString, bool Value);
 	void AddObjectToArray(const FString& AccessString, const FEasyJsonObjectV2& Object);
 
+	// Bulk array appends (the array grows once for all values)
+	void AddIntsToArray(const FString& AccessString, TArrayView<const int32> Values);
+	void AddFloatsToArray(const FString& AccessString, TArrayView<const float> Values);
+	void AddStringsToArray(const FString& AccessString, TArrayView<const FString> Values);
+
 	// Advanced array access methods
 	int32 GetArraySize(const FString& AccessString) const;
 	bool IsArray(const FString& AccessString) const;
@@ -73,38 +94,118 @@ public:
 	// Multi-dimensional array access
 	FEasyJsonValueV2 ReadMultiDimensionalArray(const FString& ArrayPath, const TArray<int32>& Indices) const;
 
+	// Read methods using a precompiled path
+	int32 ReadInt(const FEasyJsonPathV2& Path, int32 DefaultValue = 0) const;
+	float ReadFloat(const FEasyJsonPathV2& Path, float DefaultValue = 0.0f) const;
+	FString ReadString(const FEasyJsonPathV2& Path, const FString& DefaultValue = TEXT("")) const;
+	bool ReadBool(const FEasyJsonPathV2& Path, bool DefaultValue = false) const;
+	FEasyJsonObjectV2 ReadObject(const FEasyJsonPathV2& Path, bool& bFound) const;
+	TArray<FEasyJsonObjectV2> ReadObjects(const FEasyJsonPathV2& Path, bool& bFound) const;
+
+	// Write methods using a precompiled path
+	void WriteInt(const FEasyJsonPathV2& Path, int32 Value);
+	void WriteFloat(const FEasyJsonPathV2& Path, float Value);
+	void WriteString(const FEasyJsonPathV2& Path, const FString& Value);
+	void WriteBool(const FEasyJsonPathV2& Path, bool Value);
+	void WriteObject(const FEasyJsonPathV2& Path, const FEasyJsonObjectV2& Object);
+
+	// Array manipulation using a precompiled path
+	void AddIntToArray(const FEasyJsonPathV2& Path, int32 Value);
+	void AddFloatToArray(const FEasyJsonPathV2& Path, float Value);
+	void AddStringToArray(const FEasyJsonPathV2& Path, const FString& Value);
+	void AddBoolToArray(const FEasyJsonPathV2& Path, bool Value);
+	void AddObjectToArray(const FEasyJsonPathV2& Path, const FEasyJsonObjectV2& Object);
+	void AddIntsToArray(const FEasyJsonPathV2& Path, TArrayView<const int32> Values);
+	void AddFloatsToArray(const FEasyJsonPathV2& Path, TArrayView<const float> Values);
+	void AddStringsToArray(const FEasyJsonPathV2& Path, TArrayView<const FString> Values);
+
+	// Advanced array access using a precompiled path
+	int32 GetArraySize(const FEasyJsonPathV2& Path) const;
+	bool IsArray(const FEasyJsonPathV2& Path) const;
+	FEasyJsonValueV2 SafeReadArrayElement(const FEasyJsonPathV2& Path, int32 Index) const;
+	TArray<FEasyJsonValueV2> ReadArrayValues(const FEasyJsonPathV2& Path) const;
+	int32 GetArrayDimensions(const FEasyJsonPathV2& Path) const;
+	TArray<int32> GetArrayDimensionSizes(const FEasyJsonPathV2& Path) const;
+
+	// 2D/3D/multi-dimensional array access using a precompiled path
+	int32 Read2DArrayInt(const FEasyJsonPathV2& ArrayPath, int32 Row, int32 Col, int32 DefaultValue = 0) const;
+	float Read2DArrayFloat(const FEasyJsonPathV2& ArrayPath, int32 Row, int32 Col, float DefaultValue = 0.0f) const;
+	FString Read2DArrayString(const FEasyJsonPathV2& ArrayPath, int32 Row, int32 Col, const FString& DefaultValue = TEXT("")) const;
+	bool Read2DArrayBool(const FEasyJsonPathV2& ArrayPath, int32 Row, int32 Col, bool DefaultValue = false) const;
+	int32 Read3DArrayInt(const FEasyJsonPathV2& ArrayPath, int32 X, int32 Y, int32 Z, int32 DefaultValue = 0) const;
+	float Read3DArrayFloat(const FEasyJsonPathV2& ArrayPath, int32 X, int32 Y, int32 Z, float DefaultValue = 0.0f) const;
+	FString Read3DArrayString(const FEasyJsonPathV2& ArrayPath, int32 X, int32 Y, int32 Z, const FString& DefaultValue = TEXT("")) const;
+	bool Read3DArrayBool(const FEasyJsonPathV2& ArrayPath, int32 X, int32 Y, int32 Z, bool DefaultValue = false) const;
+	FEasyJsonValueV2 ReadMultiDimensionalArray(const FEasyJsonPathV2& ArrayPath, const TArray<int32>& Indices) const;
+
 	// Static creation methods
 	static FEasyJsonObjectV2 CreateEmpty();
 	static FEasyJsonObjectV2 CreateFromString(const FString& JsonString, bool& bSuccess);
+	static FEasyJsonObjectV2 CreateFromUtf8(TArrayView<const uint8> Utf8Json, bool& bSuccess);
+	static FEasyJsonObjectV2 CreateFromSource(const TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe>& Source, bool& bSuccess);
 	static FEasyJsonObjectV2 CreateFromJsonObject(TSharedPtr<FJsonObject> JsonObject);
+	
+	// Read-optimized creation: the result is a view into an immutable FEasyJsonDocumentV2
+	static FEasyJsonObjectV2 CreateFromDocument(const TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe>& InDocument);
+	static FEasyJsonObjectV2 CreateDocumentFromString(const FString& JsonString, bool& bSuccess);
+	static FEasyJsonObjectV2 CreateDocumentFromUtf8(TArrayView<const uint8> Utf8Json, bool& bSuccess);
+	
+	// Lazy creation: only the structure is indexed, and values are parsed when they are read
+	static FEasyJsonObjectV2 CreateLazyFromString(const FString& JsonString, bool& bSuccess);
+	static FEasyJsonObjectV2 CreateLazyFromSource(const TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe>& Source, bool& bSuccess);
 
 	// Conversion methods
 	FString ToString(bool bPrettyPrint = false) const;
 	TSharedPtr<FJsonObject> ToJsonObject() const;
 	
 	// Validity check
-	FORCEINLINE bool IsValid() const { return InnerObject.IsValid(); }
+	FORCEINLINE bool IsValid() const { return InnerObject.IsValid() || Document.IsValid(); }
+	
+	// True if this is a view into a document
+	FORCEINLINE bool IsDocumentView() const { return Document.IsValid(); }
+	
+	// Document this object is a view into (null for regular objects)
+	FORCEINLINE const TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe>& GetDocument() const { return Document; }
+	
+	// Index of the viewed object in the document (INDEX_NONE for regular objects)
+	FORCEINLINE int32 GetDocumentIndex() const { return DocumentIndex; }
 	
 	// Comparison operators
 	bool operator==(const FEasyJsonObjectV2& Other) const;
 	bool operator!=(const FEasyJsonObjectV2& Other) const;
 
 private:
+	friend class FEasyJsonWriteBatchV2;
+	
 	// Internal JSON object
 	TSharedPtr<FJsonObject> InnerObject;
 	
+	// Set instead of InnerObject when this is a view into a document
+	TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> Document;
+	int32 DocumentIndex = INDEX_NONE;
+	
+	// Copy a document view into an engine JSON tree before writing
+	void DetachFromDocument();
+	
 	// Helper methods
-	FEasyJsonValueV2 ReadEasyJsonValue(const FString& AccessString) const;
-	bool IsAccessAsArray(const FString& AccessName, FString& ElementName, int32& ArrayIndex) const;
-	void GetObject(const TSharedPtr<FJsonObject> TargetObject, const FString& PropertyName, TArray<TSharedPtr<FJsonObject>>& Objects) const;
-	TSharedPtr<FJsonObject> CreateOrGetObject(const FString& AccessString);
-	TSharedPtr<FJsonValue> CreateValue(const FString& AccessString, TSharedPtr<FJsonValue> NewValue);
+	FEasyJsonValueV2 FindField(const FAccessStep& Step) const;
+	FEasyJsonValueV2 ReadEasyJsonValue(const FEasyJsonPathV2& Path) const;
+	FEasyJsonObjectV2 ResolveChildObject(const FEasyJsonObjectV2& ParentObject, const FAccessStep& Step) const;
+	void GetObject(const FEasyJsonObjectV2& TargetObject, const FAccessStep& Step, TArray<FEasyJsonObjectV2>& Objects) const;
+	
+	// Walk to the object at the steps, creating what is missing; when bStrict, a field of another type on the way fails (null) instead of being passed over
+	TSharedPtr<FJsonObject> CreateOrGetObject(TArrayView<const FAccessStep> Steps, bool bStrict = false);
+	TSharedPtr<FJsonValue> CreateValue(const FEasyJsonPathV2& Path, TSharedPtr<FJsonValue> NewValue);
+	
+	// The array a path addresses, created if missing, for appending in place
+	TArray<TSharedPtr<FJsonValue>>* FindOrAddArray(const FEasyJsonPathV2& Path);
 	
 	// Helper method for adding values to arrays
-	void AddToArrayInternal(const FString& AccessString, TSharedPtr<FJsonValue> NewValue, const FString& TypeName, const FString& ValueString);
+	void AddToArrayInternal(const FEasyJsonPathV2& Path, TSharedPtr<FJsonValue> NewValue, const FString& TypeName, const FString& ValueString);
 
 	// Advanced access methods using new parser
-	FEasyJsonValueV2 ReadEasyJsonValueAdvanced(const FString& AccessString) const;
-	TSharedPtr<FJsonValue> NavigateToValue(const TArray<FAccessStep>& Steps) const;
-	TSharedPtr<FJsonValue> NavigateToArrayElement(TSharedPtr<FJsonValue> ArrayValue, const TArray<int32>& Indices) const;
+	FEasyJsonValueV2 ReadEasyJsonValueAdvanced(const FEasyJsonPathV2& Path) const;
+	FEasyJsonValueV2 ReadArrayElementAdvanced(const FEasyJsonPathV2& ArrayPath, TArrayView<const int32> Indices) const;
+	FEasyJsonValueV2 NavigateToValue(TArrayView<const FAccessStep> Steps) const;
+	FEasyJsonValueV2 NavigateToArrayElement(const FEasyJsonValueV2& ArrayValue, TArrayView<const int32> Indices) const;
 };
\ No newline at end of file
@@ -14,15 +14,114 @@ class EASYJSONPARSERV2_API UEasyJsonParseManagerV2 : public UObject
 	GENERATED_BODY()
 
 public:
-	// File loading (returns struct)
-	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2")
-	static FEasyJsonObjectV2 LoadFromFile(const FString& FilePath, bool IsAbsolute, bool& bSuccess, FString& ErrorMessage);
+	/**
+	 * File loading (returns struct)
+	 * @param bMemoryMapped Map the file instead of reading it into memory; strings and numbers
+	 *        stay views into the mapping, which is released when the last value referring to it is gone
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2", meta = (AdvancedDisplay = "bMemoryMapped"))
+	static FEasyJsonObjectV2 LoadFromFile(const FString& FilePath, bool IsAbsolute, bool& bSuccess, FString& ErrorMessage, bool bMemoryMapped = false);
 
 	// String loading (returns struct)
 	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2")
 	static FEasyJsonObjectV2 LoadFromString(const FString& JsonString, bool& bSuccess, FString& ErrorMessage);
 
-	// File saving
+	/**
+	 * Parse UTF-8 bytes in place (no FString copy of the whole document)
+	 * @param Utf8Json The JSON text as UTF-8 (a leading BOM is skipped)
+	 * @param bSuccess Set to true if parsing succeeded
+	 * @param ErrorMessage Receives the reason when parsing fails
+	 * @return Parsed JSON object
+	 */
+	static FEasyJsonObjectV2 LoadFromUtf8(TArrayView<const uint8> Utf8Json, bool& bSuccess, FString& ErrorMessage);
+
+	/**
+	 * Parse the contents of a JSON file read into memory
+	 * @param FileData The file bytes: UTF-8 (with or without BOM) or UTF-16 with a BOM
+	 * @param bSuccess Set to true if parsing succeeded
+	 * @param ErrorMessage Receives the reason when parsing fails
+	 * @return Parsed JSON object
+	 */
+	static FEasyJsonObjectV2 LoadFromFileBytes(TArrayView<const uint8> FileData, bool& bSuccess, FString& ErrorMessage);
+
+	/**
+	 * Parse UTF-8 source bytes, keeping values as views into the source
+	 * @param Source The JSON bytes (a leading BOM is skipped)
+	 * @param bSuccess Set to true if parsing succeeded
+	 * @param ErrorMessage Receives the reason when parsing fails
+	 * @return Parsed JSON object
+	 */
+	static FEasyJsonObjectV2 LoadFromSource(const TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe>& Source, bool& bSuccess, FString& ErrorMessage);
+
+	/**
+	 * Load a file into an immutable, read-optimized document.
+	 * The result reads like any other object; writing to it copies it into a regular tree first.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2")
+	static FEasyJsonObjectV2 LoadDocumentFromFile(const FString& FilePath, bool IsAbsolute, bool& bSuccess, FString& ErrorMessage);
+
+	// String loading into an immutable, read-optimized document
+	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2")
+	static FEasyJsonObjectV2 LoadDocumentFromString(const FString& JsonString, bool& bSuccess, FString& ErrorMessage);
+
+	/**
+	 * Load a file lazily: only its structure is indexed up front, and each value is parsed when a read visits it.
+	 * Load time scales with what is read rather than with the file size; syntax errors inside values
+	 * are only found when those values are read (they read as missing).
+	 * @param bMemoryMapped Map the file instead of reading it into memory
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2")
+	static FEasyJsonObjectV2 LoadLazyFromFile(const FString& FilePath, bool IsAbsolute, bool& bSuccess, FString& ErrorMessage, bool bMemoryMapped = false);
+
+	// String loading with on-demand parsing of values
+	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2")
+	static FEasyJsonObjectV2 LoadLazyFromString(const FString& JsonString, bool& bSuccess, FString& ErrorMessage);
+
+	/**
+	 * Load a file through the shared document cache (see FEasyJsonDocumentCacheV2).
+	 * Repeated loads of an unchanged file return the same parsed document without reading the file;
+	 * the result is read-only and copies itself on the first write, so callers cannot affect each other.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2|Cache")
+	static FEasyJsonObjectV2 LoadFromFileCached(const FString& FilePath, bool IsAbsolute, bool& bSuccess, FString& ErrorMessage);
+
+	// Drop a file from the document cache so that the next cached load parses it again
+	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2|Cache")
+	static void InvalidateCachedFile(const FString& FilePath, bool IsAbsolute);
+
+	// Drop every file from the document cache
+	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2|Cache")
+	static void ClearFileCache();
+
+	// Memory budget of the document cache in bytes; least recently used files are dropped beyond it
+	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2|Cache")
+	static void SetFileCacheBudget(int64 MaxBytes);
+
+	/**
+	 * Load a JSON Lines (newline-delimited JSON) file. The lines are parsed in parallel on
+	 * task graph workers; blank lines are skipped.
+	 * @param FilePath Path of the file
+	 * @param IsAbsolute True if FilePath is absolute (otherwise relative to the content directory)
+	 * @param bSuccess Set to true if every line parsed
+	 * @param ErrorMessage Receives the first line that failed
+	 * @return One object per non-blank line, in file order (lines that failed are invalid objects)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2")
+	static TArray<FEasyJsonObjectV2> LoadJsonLines(const FString& FilePath, bool IsAbsolute, bool& bSuccess, FString& ErrorMessage);
+
+	// JSON Lines parsing of a string
+	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2")
+	static TArray<FEasyJsonObjectV2> LoadJsonLinesFromString(const FString& JsonLines, bool& bSuccess, FString& ErrorMessage);
+
+	/**
+	 * Load a JSON Lines file and hand each line to a callback instead of keeping the results.
+	 * The callback runs on worker threads, concurrently and in no particular order.
+	 * @param OnLine Receives the index of the non-blank line and its object (invalid if the line failed)
+	 * @return true if every line parsed
+	 */
+	static bool LoadJsonLines(const FString& FilePath, bool IsAbsolute, TFunctionRef<void(int32 LineIndex, FEasyJsonObjectV2&& Object)> OnLine, FString& ErrorMessage);
+
+	// File saving (pretty-printed UTF-8, streamed to the file through FEasyJsonWriterV2)
 	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2")
 	static bool SaveToFile(const FEasyJsonObjectV2& JsonObject, const FString& FilePath, bool IsAbsolute, FString& ErrorMessage);
 
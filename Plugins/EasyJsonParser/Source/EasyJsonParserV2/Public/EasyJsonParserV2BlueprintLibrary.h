@@ -27,10 +27,11 @@ public:
 	 * @param bAbsolutePath Whether to use absolute path
 	 * @param bSuccess Success flag for loading
 	 * @param ErrorMessage Error message
+	 * @param bMemoryMapped Map the file instead of reading it into memory (values stay views into the mapping)
 	 * @return Loaded JSON object
 	 */
-	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2|Load", meta = (Keywords = "json load file"))
-	static FEasyJsonObjectV2 LoadJsonFromFile(const FString& FilePath, bool bAbsolutePath, bool& bSuccess, FString& ErrorMessage);
+	UFUNCTION(BlueprintCallable, Category = "EasyJsonParserV2|Load", meta = (Keywords = "json load file", AdvancedDisplay = "bMemoryMapped"))
+	static FEasyJsonObjectV2 LoadJsonFromFile(const FString& FilePath, bool bAbsolutePath, bool& bSuccess, FString& ErrorMessage, bool bMemoryMapped = false);
 
 	/**
 	 * Load JSON from string
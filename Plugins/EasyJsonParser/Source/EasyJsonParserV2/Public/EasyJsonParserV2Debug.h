@@ -30,6 +30,7 @@ public:
 	
 	// Detailed log of access string parsing
 	static void LogAccessParsing(const FString& AccessString, const TArray<FString>& ParsedSteps);
+	static void LogAccessParsing(const FString& AccessString, const TArray<struct FAccessStep>& ParsedSteps);
 
 	// Check if debug mode is enabled
 	static bool IsDebugEnabled();
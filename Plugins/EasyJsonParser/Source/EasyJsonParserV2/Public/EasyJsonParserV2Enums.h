@@ -22,4 +22,12 @@ enum class EEasyJsonParserV2DebugLogLevel : uint8
 	Basic = 1 UMETA(DisplayName = "Basic"),      // Basic error information only
 	Detailed = 2 UMETA(DisplayName = "Detailed"), // Detailed debug information
 	Verbose = 3 UMETA(DisplayName = "Verbose")   // Record all operations in detail
-};
\ No newline at end of file
+};
+
+UENUM(BlueprintType)
+enum class EEasyJsonAsyncPriorityV2 : uint8
+{
+	Normal = 0 UMETA(DisplayName = "Normal"),
+	Low = 1 UMETA(DisplayName = "Low"),       // Background threads, behind other work
+	High = 2 UMETA(DisplayName = "High")      // High priority worker threads
+};
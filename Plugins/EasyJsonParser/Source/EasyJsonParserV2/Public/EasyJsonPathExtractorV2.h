@@ -0,0 +1,80 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EasyJsonValueV2.h"
+#include "AdvancedAccessParser.h"
+
+class FArchive;
+
+/**
+ * Pulls the values at a set of access strings out of a JSON stream in one pass.
+ * Access strings use the FAdvancedAccessParser syntax ("meta.version", "rows[2].cells[0]"),
+ * plus [*] to match every element of an array ("items[*].id") and a leading index group for
+ * root arrays ("[*].id"). Paths resolve as FEasyJsonObjectV2 reads do: a key without an index
+ * that more steps follow goes into element 0 of an array ("items.id" is "items[0].id"), and [0]
+ * also matches a value that is not an array. The last step yields its value as is, arrays included.
+ * Only matched values are built; every other subtree is skipped by the stream reader without being decoded.
+ */
+class EASYJSONPARSERV2_API FEasyJsonPathExtractorV2
+{
+public:
+	/**
+	 * Compile the access strings
+	 * @param AccessStrings The paths to extract
+	 */
+	explicit FEasyJsonPathExtractorV2(const TArray<FString>& AccessStrings);
+
+	// True if every access string compiled
+	FORCEINLINE bool IsValid() const { return ErrorMessage.IsEmpty(); }
+
+	// Reason the access strings did not compile
+	FORCEINLINE const FString& GetErrorMessage() const { return ErrorMessage; }
+
+	/**
+	 * Stream JSON from an archive and collect the matches
+	 * @param Archive A loading archive positioned at the start of the UTF-8 JSON text
+	 * @param OutValues One entry per access string, in order, holding every value found at it (in document order)
+	 * @param OutErrorMessage Receives the reason on failure
+	 * @return true if the whole input was read
+	 */
+	bool Extract(FArchive& Archive, TArray<TArray<FEasyJsonValueV2>>& OutValues, FString& OutErrorMessage) const;
+
+	/**
+	 * Stream a file and collect the matches
+	 * @param FilePath Absolute path of the file
+	 * @param OutValues One entry per access string, in order, holding every value found at it
+	 * @param OutErrorMessage Receives the reason on failure
+	 * @return true if the whole file was read
+	 */
+	bool ExtractFromFile(const FString& FilePath, TArray<TArray<FEasyJsonValueV2>>& OutValues, FString& OutErrorMessage) const;
+
+	/**
+	 * One step of a compiled path
+	 */
+	struct FSelector
+	{
+		// Field name for key steps (empty for index steps)
+		FString Key;
+
+		// Element position for index steps, AnyIndex for [*], INDEX_NONE for key steps
+		int32 Index = INDEX_NONE;
+
+		// True if the index step also matches a value that is not an array (as the value itself)
+		bool bMatchesSingleValue = false;
+
+		FORCEINLINE bool IsKey() const { return Index == INDEX_NONE; }
+	};
+
+	// Index of a [*] step
+	static constexpr int32 AnyIndex = FAccessStringTokenizer::AnyIndex;
+
+private:
+	bool CompilePath(const FString& AccessString, TArray<FSelector>& OutSelectors) const;
+
+	// Compiled selectors of each access string
+	TArray<TArray<FSelector>> Paths;
+
+	FString ErrorMessage;
+};
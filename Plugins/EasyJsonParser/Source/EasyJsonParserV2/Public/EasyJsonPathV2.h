@@ -0,0 +1,244 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AdvancedAccessParser.h"
+
+/**
+ * Access string compiled once into access steps.
+ * Keep an instance around and pass it to the FEasyJsonObjectV2 overloads so that
+ * repeated reads and writes on the same path skip parsing the access string.
+ */
+struct EASYJSONPARSERV2_API FEasyJsonPathV2
+{
+public:
+	// Constructors
+	FEasyJsonPathV2();
+	explicit FEasyJsonPathV2(const FString& InAccessString);
+	
+	/**
+	 * Compile an access string into a reusable path
+	 * @param InAccessString The access string to compile (e.g., "users[0].contacts[1].name")
+	 * @return Compiled path (check IsValid() for parse failures)
+	 */
+	static FEasyJsonPathV2 Compile(const FString& InAccessString);
+	
+	/**
+	 * Create a path from already parsed steps (used by EJ_PATH)
+	 * @param InAccessString The access string the steps were parsed from
+	 * @param InSteps The parsed access steps
+	 * @return Path using the given steps
+	 */
+	static FEasyJsonPathV2 FromSteps(const FString& InAccessString, TArray<FAccessStep>&& InSteps);
+	
+	// Validity check
+	FORCEINLINE bool IsValid() const { return Steps->Num() > 0; }
+	
+	// Accessors
+	FORCEINLINE const FString& GetAccessString() const { return AccessString; }
+	FORCEINLINE const TArray<FAccessStep>& GetSteps() const { return *Steps; }
+	FORCEINLINE int32 Num() const { return Steps->Num(); }
+	FORCEINLINE int32 GetMaxArrayDepth() const { return MaxArrayDepth; }
+	
+	// Steps leading to the object that holds the final step
+	FORCEINLINE TArrayView<const FAccessStep> GetParentSteps() const
+	{
+		return Steps->Num() > 0 ? TArrayView<const FAccessStep>(Steps->GetData(), Steps->Num() - 1) : TArrayView<const FAccessStep>();
+	}
+	
+	FORCEINLINE const FAccessStep& GetLastStep() const { return Steps->Last(); }
+
+private:
+	// Original access string (kept for debug output)
+	FString AccessString;
+	
+	// Parsed access steps (shared with the access string parse cache)
+	FAccessStepsRef Steps;
+	
+	// Highest number of indices on a single step
+	int32 MaxArrayDepth;
+};
+
+namespace EasyJsonStaticPath
+{
+	constexpr bool IsDigit(ANSICHAR Char)
+	{
+		return Char >= '0' && Char <= '9';
+	}
+	
+	constexpr bool IsIdentifierStart(ANSICHAR Char)
+	{
+		return (Char >= 'a' && Char <= 'z') || (Char >= 'A' && Char <= 'Z') || Char == '_';
+	}
+	
+	constexpr bool IsIdentifierChar(ANSICHAR Char)
+	{
+		return IsIdentifierStart(Char) || IsDigit(Char);
+	}
+	
+	/**
+	 * Check a string literal against the strict access string syntax
+	 * (identifier followed by [index] groups, separated by dots, no whitespace)
+	 */
+	template <int32 N>
+	constexpr bool IsValid(const ANSICHAR (&Path)[N])
+	{
+		const int32 Len = N - 1;
+		int32 Pos = 0;
+		while (true)
+		{
+			if (Pos >= Len || !IsIdentifierStart(Path[Pos]))
+			{
+				return false;
+			}
+			++Pos;
+			while (Pos < Len && IsIdentifierChar(Path[Pos]))
+			{
+				++Pos;
+			}
+			
+			while (Pos < Len && Path[Pos] == '[')
+			{
+				const int32 DigitsStart = ++Pos;
+				int64 Value = 0;
+				while (Pos < Len && IsDigit(Path[Pos]))
+				{
+					Value = Value * 10 + (Path[Pos] - '0');
+					if (Value > MAX_int32)
+					{
+						return false;
+					}
+					++Pos;
+				}
+				if (Pos == DigitsStart || Pos >= Len || Path[Pos] != ']')
+				{
+					return false;
+				}
+				++Pos;
+			}
+			
+			if (Pos == Len)
+			{
+				return true;
+			}
+			if (Path[Pos] != '.')
+			{
+				return false;
+			}
+			++Pos;
+		}
+	}
+	
+	template <int32 N>
+	constexpr int32 CountChar(const ANSICHAR (&Path)[N], ANSICHAR Char)
+	{
+		int32 Count = 0;
+		for (int32 Pos = 0; Pos < N - 1; ++Pos)
+		{
+			Count += Path[Pos] == Char ? 1 : 0;
+		}
+		return Count;
+	}
+	
+	// One step of a compile-time parsed path (offsets into the literal and the index table)
+	struct FStaticStep
+	{
+		int32 NameStart = 0;
+		int32 NameLen = 0;
+		int32 FirstIndex = 0;
+		int32 NumIndices = 0;
+	};
+	
+	/**
+	 * Step table filled in at compile time from a validated string literal
+	 */
+	template <int32 NumSteps, int32 NumIndices>
+	struct TStaticStepTable
+	{
+		FStaticStep Steps[NumSteps];
+		int32 Indices[NumIndices > 0 ? NumIndices : 1];
+		
+		template <int32 N>
+		constexpr explicit TStaticStepTable(const ANSICHAR (&Path)[N])
+			: Steps{}
+			, Indices{}
+		{
+			const int32 Len = N - 1;
+			int32 Pos = 0;
+			int32 StepCount = 0;
+			int32 IndexCount = 0;
+			while (Pos < Len)
+			{
+				FStaticStep& Step = Steps[StepCount++];
+				Step.NameStart = Pos;
+				while (Pos < Len && Path[Pos] != '[' && Path[Pos] != '.')
+				{
+					++Pos;
+				}
+				Step.NameLen = Pos - Step.NameStart;
+				Step.FirstIndex = IndexCount;
+				
+				while (Pos < Len && Path[Pos] == '[')
+				{
+					++Pos;
+					int32 Value = 0;
+					while (Path[Pos] != ']')
+					{
+						Value = Value * 10 + (Path[Pos] - '0');
+						++Pos;
+					}
+					++Pos;
+					Indices[IndexCount++] = Value;
+				}
+				Step.NumIndices = IndexCount - Step.FirstIndex;
+				
+				// Skip the separating dot
+				if (Pos < Len)
+				{
+					++Pos;
+				}
+			}
+		}
+	};
+	
+	/**
+	 * Convert a compile-time step table into a path usable with FEasyJsonObjectV2
+	 * @param Path The string literal the table was built from
+	 * @param Table The compile-time step table
+	 * @return Path sharing the regular navigation code
+	 */
+	template <int32 NumSteps, int32 NumIndices>
+	FEasyJsonPathV2 MakePath(const ANSICHAR* Path, const TStaticStepTable<NumSteps, NumIndices>& Table)
+	{
+		TArray<FAccessStep> Steps;
+		Steps.Reserve(NumSteps);
+		for (const FStaticStep& Step : Table.Steps)
+		{
+			const FString PropertyName(Step.NameLen, Path + Step.NameStart);
+			if (Step.NumIndices > 0)
+			{
+				Steps.Add(FAccessStep(PropertyName, TArray<int32>(Table.Indices + Step.FirstIndex, Step.NumIndices)));
+			}
+			else
+			{
+				Steps.Add(FAccessStep(PropertyName));
+			}
+		}
+		return FEasyJsonPathV2::FromSteps(FString(Path), MoveTemp(Steps));
+	}
+}
+
+/**
+ * Access path parsed and validated at compile time.
+ * Invalid paths fail to compile; the steps are built once per call site.
+ * Usage: JsonObject.ReadInt(EJ_PATH("users[0].age"))
+ */
+#define EJ_PATH(Literal) \
+	([]() -> const FEasyJsonPathV2& \
+	{ \
+		static_assert(EasyJsonStaticPath::IsValid(Literal), "EJ_PATH: invalid access string " Literal); \
+		static constexpr EasyJsonStaticPath::TStaticStepTable<EasyJsonStaticPath::CountChar(Literal, '.') + 1, EasyJsonStaticPath::CountChar(Literal, '[')> Table(Literal); \
+		static const FEasyJsonPathV2 Path = EasyJsonStaticPath::MakePath(Literal, Table); \
+		return Path; \
+	}())
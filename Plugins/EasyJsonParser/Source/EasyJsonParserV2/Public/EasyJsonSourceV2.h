@@ -0,0 +1,57 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/MappedFileHandle.h"
+
+/**
+ * Read-only JSON bytes that outlive parsing.
+ * Either an owned buffer or a memory-mapped file; values parsed from a source can keep
+ * views into it instead of copying, and hold a reference so the bytes stay valid.
+ */
+class EASYJSONPARSERV2_API FEasyJsonSourceV2
+{
+public:
+	~FEasyJsonSourceV2();
+
+	/**
+	 * Take ownership of a byte buffer
+	 * @param Bytes The file contents
+	 * @return The source
+	 */
+	static TSharedRef<FEasyJsonSourceV2, ESPMode::ThreadSafe> FromBuffer(TArray<uint8>&& Bytes);
+
+	/**
+	 * Map a whole file read-only. The OS pages the contents in as they are touched.
+	 * @param FilePath Absolute path of the file
+	 * @return The source, or null if the platform cannot map the file (e.g. it is empty)
+	 */
+	static TSharedPtr<FEasyJsonSourceV2, ESPMode::ThreadSafe> MapFile(const FString& FilePath);
+
+	// All bytes of the source (including any BOM)
+	FORCEINLINE TArrayView<const uint8> GetBytes() const { return TArrayView<const uint8>(Data, Size); }
+
+	// True if the bytes are a view into a mapped file
+	FORCEINLINE bool IsMapped() const { return MappedRegion.IsValid(); }
+
+	// True if the range lies inside the source bytes
+	FORCEINLINE bool Contains(const void* Begin, int64 Length) const
+	{
+		const uint8* Bytes = static_cast<const uint8*>(Begin);
+		return Bytes >= Data && Length >= 0 && Bytes + Length <= Data + Size;
+	}
+
+private:
+	FEasyJsonSourceV2() = default;
+
+	// Owned bytes (empty when mapped)
+	TArray<uint8> Buffer;
+
+	// Mapping (the region must be released before the handle)
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	const uint8* Data = nullptr;
+	int64 Size = 0;
+};
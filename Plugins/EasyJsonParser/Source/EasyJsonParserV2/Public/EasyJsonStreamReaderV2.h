@@ -0,0 +1,145 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+
+class FArchive;
+
+/**
+ * What the stream reader does after an event
+ */
+enum class EEasyJsonStreamActionV2 : uint8
+{
+	// Keep reading
+	Continue,
+	// Skip the value that was just begun (after OnBeginObject/OnBeginArray) or the value of the key (after OnKey)
+	Skip,
+	// Stop reading
+	Stop
+};
+
+/**
+ * Receives the events of FEasyJsonStreamReaderV2.
+ * Strings passed to the events are only valid during the call.
+ */
+class EASYJSONPARSERV2_API IEasyJsonStreamVisitorV2
+{
+public:
+	virtual ~IEasyJsonStreamVisitorV2() = default;
+
+	virtual EEasyJsonStreamActionV2 OnBeginObject() { return EEasyJsonStreamActionV2::Continue; }
+	virtual EEasyJsonStreamActionV2 OnEndObject() { return EEasyJsonStreamActionV2::Continue; }
+	virtual EEasyJsonStreamActionV2 OnBeginArray() { return EEasyJsonStreamActionV2::Continue; }
+	virtual EEasyJsonStreamActionV2 OnEndArray() { return EEasyJsonStreamActionV2::Continue; }
+	virtual EEasyJsonStreamActionV2 OnKey(FStringView Key) { return EEasyJsonStreamActionV2::Continue; }
+	virtual EEasyJsonStreamActionV2 OnString(FStringView Value) { return EEasyJsonStreamActionV2::Continue; }
+	virtual EEasyJsonStreamActionV2 OnNumber(double Value) { return EEasyJsonStreamActionV2::Continue; }
+	virtual EEasyJsonStreamActionV2 OnBool(bool bValue) { return EEasyJsonStreamActionV2::Continue; }
+	virtual EEasyJsonStreamActionV2 OnNull() { return EEasyJsonStreamActionV2::Continue; }
+};
+
+/**
+ * Event-based (SAX) reader for UTF-8 JSON of any size.
+ * The input is pulled from an archive in fixed-size chunks and no tree is built, so memory
+ * stays bounded by the chunk size, the longest string and the nesting depth, whatever the
+ * size of the input. Skipped values are scanned without decoding their strings or numbers.
+ */
+class EASYJSONPARSERV2_API FEasyJsonStreamReaderV2
+{
+public:
+	/**
+	 * @param InArchive A loading archive positioned at the start of the JSON text
+	 * @param InChunkSize Bytes read from the archive at a time
+	 */
+	explicit FEasyJsonStreamReaderV2(FArchive& InArchive, int32 InChunkSize = DefaultChunkSize);
+
+	/**
+	 * Read one JSON value (a leading BOM is skipped) and report it to the visitor
+	 * @param Visitor Receives the events
+	 * @return true if the input was valid up to its end, or up to where the visitor stopped
+	 */
+	bool Read(IEasyJsonStreamVisitorV2& Visitor);
+
+	/**
+	 * Stream a file through a visitor
+	 * @param FilePath Absolute path of the file
+	 * @param Visitor Receives the events
+	 * @param OutErrorMessage Receives the reason on failure
+	 * @param ChunkSize Bytes read from the file at a time
+	 * @return true if the file was read successfully
+	 */
+	static bool ReadFile(const FString& FilePath, IEasyJsonStreamVisitorV2& Visitor, FString& OutErrorMessage, int32 ChunkSize = DefaultChunkSize);
+
+	// Reason for the last failure
+	FORCEINLINE const FString& GetErrorMessage() const { return ErrorMessage; }
+
+	// True if the last read ended because the visitor returned Stop
+	FORCEINLINE bool WasStopped() const { return bStopped; }
+
+	// Bytes consumed from the archive by the last read
+	FORCEINLINE int64 GetBytesRead() const { return ChunkOffset + (Cursor - Chunk.GetData()); }
+
+	// Longest string (in UTF-8 bytes) a visited key or value may have
+	FORCEINLINE void SetMaxStringLength(int32 InMaxStringLength) { MaxStringLength = InMaxStringLength; }
+
+	static constexpr int32 DefaultChunkSize = 64 * 1024;
+	static constexpr int32 DefaultMaxStringLength = 16 * 1024 * 1024;
+
+private:
+	bool ReadValue(IEasyJsonStreamVisitorV2& Visitor, int32 Depth, bool bSkip);
+	bool ReadContainer(IEasyJsonStreamVisitorV2& Visitor, int32 Depth, bool bObject, bool bSkip);
+	bool ReadString(bool bSkip);
+	bool ReadNumber(bool bSkip, double& OutValue);
+	bool ReadLiteral(const ANSICHAR* Literal);
+	bool ReadHexDigits(uint32& OutCodePoint);
+	void AppendCodePoint(uint32 CodePoint);
+
+	// Report an event; false if the visitor stopped
+	bool Emit(EEasyJsonStreamActionV2 Action, bool& bOutSkip);
+
+	// Load the next chunk; false at the end of the input
+	bool Refill();
+
+	// Refill from an archive that reports no size (TotalSize() < 0), reading until it runs out
+	bool RefillUnknownSize();
+
+	// Skip whitespace and look at the next byte without consuming it; false at the end of the input
+	bool PeekToken(uint8& OutByte);
+
+	FORCEINLINE bool NextByte(uint8& OutByte)
+	{
+		if (Cursor == ChunkEnd && !Refill())
+		{
+			return false;
+		}
+		OutByte = *Cursor++;
+		return true;
+	}
+
+	bool Fail(const TCHAR* Reason);
+
+	FArchive& Archive;
+	int32 ChunkSize;
+	int32 MaxStringLength = DefaultMaxStringLength;
+
+	// Current chunk and the read position inside it
+	TArray<uint8> Chunk;
+	const uint8* Cursor = nullptr;
+	const uint8* ChunkEnd = nullptr;
+	int64 ChunkOffset = 0;
+
+	// Decoded string (UTF-8) and its TCHAR conversion, reused between tokens
+	TArray<UTF8CHAR> Utf8Token;
+	TArray<TCHAR> Token;
+
+	// Characters of the current number
+	TArray<ANSICHAR, TInlineAllocator<64>> NumberToken;
+
+	FString ErrorMessage;
+	bool bStopped = false;
+
+	// Set once an archive of unknown size has run out
+	bool bEndOfInput = false;
+};
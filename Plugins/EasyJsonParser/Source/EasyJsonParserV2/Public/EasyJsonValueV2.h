@@ -4,8 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "Dom/JsonValue.h"
+#include "EasyJsonDocumentV2.h"
 #include "EasyJsonValueV2.generated.h"
 
+struct FEasyJsonObjectV2;
+
 USTRUCT(BlueprintType)
 struct EASYJSONPARSERV2_API FEasyJsonValueV2
 {
@@ -16,6 +19,9 @@ public:
 	FEasyJsonValueV2();
 	FEasyJsonValueV2(TSharedPtr<FJsonValue> InJsonValue);
 	
+	// View of a value inside a document
+	FEasyJsonValueV2(const TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe>& InDocument, int32 InDocumentIndex);
+	
 	// Copy constructor and assignment
 	FEasyJsonValueV2(const FEasyJsonValueV2& Other);
 	FEasyJsonValueV2& operator=(const FEasyJsonValueV2& Other);
@@ -38,12 +44,29 @@ public:
 	bool IsArray() const;
 	bool IsObject() const;
 	
+	// Array access (size 0 / invalid values if this is not an array)
+	int32 GetArraySize() const;
+	FEasyJsonValueV2 GetArrayElement(int32 Index) const;
+	TArray<FEasyJsonValueV2> GetArrayElements() const;
+	
+	// Object held by this value (invalid if this is not an object)
+	FEasyJsonObjectV2 GetObjectValue() const;
+	
 	// Validity check
-	FORCEINLINE bool IsValid() const { return InnerValue.IsValid(); }
+	FORCEINLINE bool IsValid() const { return InnerValue.IsValid() || Document.IsValid(); }
 	
-	// Get underlying JSON value
-	TSharedPtr<FJsonValue> GetJsonValue() const { return InnerValue; }
+	// Get underlying JSON value (a value inside a document is copied into a new tree)
+	TSharedPtr<FJsonValue> GetJsonValue() const;
 
 private:
+	// Conversions shared by the getters; both backends convert like the engine's FJsonValue types
+	bool TryGetNumber(double& OutNumber) const;
+	bool TryGetString(FString& OutString) const;
+	bool TryGetBool(bool& OutBool) const;
+	
 	TSharedPtr<FJsonValue> InnerValue;
+	
+	// Set instead of InnerValue when this is a view into a document
+	TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> Document;
+	int32 DocumentIndex = INDEX_NONE;
 };
\ No newline at end of file
@@ -0,0 +1,117 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "EasyJsonObjectV2.h"
+#include "EasyJsonPathV2.h"
+
+/**
+ * Collects many writes and applies them to an object in one traversal.
+ * The writes are grouped in a trie of their access steps, so a parent path shared by many
+ * writes ("profile.stats.*") is resolved once instead of being walked from the root per write.
+ * Applying gives the same result as making the writes one by one in the order they were added
+ * (including the order of the fields). Writes that set a path and also write below it are
+ * applied one by one for that path.
+ * A batch can be applied any number of times; applied values are shared with the batch.
+ */
+class EASYJSONPARSERV2_API FEasyJsonWriteBatchV2
+{
+public:
+	FEasyJsonWriteBatchV2();
+	
+	// Queue writes (the same access strings as FEasyJsonObjectV2::WriteX)
+	void WriteInt(const FString& AccessString, int32 Value);
+	void WriteFloat(const FString& AccessString, float Value);
+	void WriteString(const FString& AccessString, const FString& Value);
+	void WriteBool(const FString& AccessString, bool Value);
+	void WriteObject(const FString& AccessString, const FEasyJsonObjectV2& Object);
+	
+	// Queue writes using a precompiled path
+	void WriteInt(const FEasyJsonPathV2& Path, int32 Value);
+	void WriteFloat(const FEasyJsonPathV2& Path, float Value);
+	void WriteString(const FEasyJsonPathV2& Path, const FString& Value);
+	void WriteBool(const FEasyJsonPathV2& Path, bool Value);
+	void WriteObject(const FEasyJsonPathV2& Path, const FEasyJsonObjectV2& Object);
+	
+	/**
+	 * Apply every queued write
+	 * @param Target The object to write to (a document view is copied first, an invalid object becomes an empty one)
+	 */
+	void Apply(FEasyJsonObjectV2& Target) const;
+	
+	// Number of queued writes
+	FORCEINLINE int32 Num() const { return Writes.Num(); }
+	
+	// Drop every queued write
+	void Reset();
+
+private:
+	void AddWrite(const FEasyJsonPathV2& Path, TSharedPtr<FJsonValue>&& Value);
+	
+	// Child of a node for a step, created if missing
+	int32 FindOrAddChild(int32 ParentIndex, const FAccessStep& Step, int32 Depth, int32 ElementIndex);
+	
+	void ApplyMembers(FEasyJsonObjectV2& Target, FJsonObject& Object, int32 NodeIndex) const;
+	void ApplyField(FEasyJsonObjectV2& Target, FJsonObject& Object, int32 NodeIndex) const;
+	
+	// Apply the writes at or below a node through FEasyJsonObjectV2, in order
+	void ApplyOneByOne(FEasyJsonObjectV2& Target, int32 NodeIndex) const;
+	
+	struct FWrite
+	{
+		FEasyJsonPathV2 Path;
+		TSharedPtr<FJsonValue> Value;
+		
+		// Node the path ends at
+		int32 NodeIndex;
+	};
+	
+	/**
+	 * A field of an object, or an element of the array stored in a field.
+	 * Node 0 is the root object.
+	 */
+	struct FNode
+	{
+		// Step naming the field (owned by a queued path)
+		const FAccessStep* Step = nullptr;
+		
+		// Position of the step in the paths, and the element index (INDEX_NONE for fields)
+		int32 Depth = INDEX_NONE;
+		int32 ElementIndex = INDEX_NONE;
+		
+		int32 ParentIndex = INDEX_NONE;
+		
+		// First write that reached the node, and the last one that set its value
+		int32 FirstWrite = INDEX_NONE;
+		int32 ValueWrite = INDEX_NONE;
+		
+		// Fields of the object stored here, and elements of the array stored here, in first-write order
+		TArray<int32> Members;
+		TArray<int32> Elements;
+	};
+	
+	// Identifies the child of a node (field names compare case-insensitively)
+	struct FChildKey
+	{
+		int32 ParentIndex;
+		int32 ElementIndex;
+		const FString* Name;
+		uint32 NameHash;
+		
+		FORCEINLINE bool operator==(const FChildKey& Other) const
+		{
+			return ParentIndex == Other.ParentIndex && ElementIndex == Other.ElementIndex && (ElementIndex != INDEX_NONE || *Name == *Other.Name);
+		}
+		
+		FORCEINLINE friend uint32 GetTypeHash(const FChildKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.ParentIndex), GetTypeHash(Key.ElementIndex)), Key.ElementIndex == INDEX_NONE ? Key.NameHash : 0);
+		}
+	};
+	
+	TArray<FWrite> Writes;
+	TArray<FNode> Nodes;
+	TMap<FChildKey, int32> Children;
+};
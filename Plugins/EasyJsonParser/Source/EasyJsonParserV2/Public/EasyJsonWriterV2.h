@@ -0,0 +1,117 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "EasyJsonObjectV2.h"
+
+class FArchive;
+class FEasyJsonDocumentV2;
+
+/**
+ * Serializes JSON straight into an archive as UTF-8.
+ * Output goes through a fixed-size buffer that is flushed to the archive whenever it fills, so
+ * memory stays flat whatever the size of the output and no intermediate FString is built.
+ * Document views are written from their tape without being copied into an engine tree.
+ * The layout follows TJsonWriter (tabs in pretty print, nothing between tokens when condensed).
+ */
+class EASYJSONPARSERV2_API FEasyJsonWriterV2
+{
+public:
+	/**
+	 * @param InArchive A saving archive the UTF-8 text is written to
+	 * @param bInPrettyPrint Indent the output
+	 * @param InBufferSize Bytes collected before they are handed to the archive
+	 */
+	explicit FEasyJsonWriterV2(FArchive& InArchive, bool bInPrettyPrint = true, int32 InBufferSize = DefaultBufferSize);
+	
+	// Flushes what is left in the buffer
+	~FEasyJsonWriterV2();
+	
+	// Write an object as the root value
+	void WriteObject(const FEasyJsonObjectV2& Object);
+	
+	// Write an engine JSON value as the root value
+	void WriteValue(const TSharedPtr<FJsonValue>& Value);
+	
+	// Hand the buffered bytes to the archive
+	void Flush();
+	
+	// True if the archive reported an error
+	bool IsError() const;
+	
+	// Bytes written so far (including those still buffered)
+	FORCEINLINE int64 GetBytesWritten() const { return BytesFlushed + BufferNum; }
+	
+	/**
+	 * Write an object to a file
+	 * @param Object The object to write
+	 * @param FilePath Absolute path of the file (its directory must exist)
+	 * @param bPrettyPrint Indent the output
+	 * @param OutErrorMessage Receives the reason on failure
+	 * @return true if the whole file was written
+	 */
+	static bool WriteToFile(const FEasyJsonObjectV2& Object, const FString& FilePath, bool bPrettyPrint, FString& OutErrorMessage);
+	
+	static constexpr int32 DefaultBufferSize = 64 * 1024;
+
+private:
+	void WriteJsonValue(const TSharedPtr<FJsonValue>& Value);
+	void WriteJsonObject(const TSharedPtr<FJsonObject>& Object);
+	void WriteDocumentValue(const FEasyJsonDocumentV2& Document, int32 Index);
+	
+	// Separators and layout, following TJsonWriter
+	void BeginObject();
+	void EndObject();
+	void BeginArray();
+	void EndArray();
+	void BeginElement(bool bContainer);
+	void WriteKey(FStringView Key);
+	void WriteNewLine();
+	
+	void WriteNumber(double Value);
+	void WriteString(FStringView Value);
+	
+	// Make room for Count more bytes in the buffer and return where they go
+	FORCEINLINE uint8* Reserve(int32 Count)
+	{
+		if (BufferNum + Count > Buffer.Num())
+		{
+			Flush();
+		}
+		return Buffer.GetData() + BufferNum;
+	}
+	
+	FORCEINLINE void WriteChar(ANSICHAR Char)
+	{
+		*Reserve(1) = static_cast<uint8>(Char);
+		++BufferNum;
+	}
+	
+	void WriteAnsi(const ANSICHAR* Chars, int32 Count);
+	
+	// What was written last, for the separators of the next token
+	enum class ELastToken : uint8
+	{
+		None,
+		Open,
+		Close,
+		ShortValue,
+		String,
+		Key
+	};
+	
+	FArchive& Archive;
+	bool bPrettyPrint;
+	
+	TArray<uint8> Buffer;
+	int32 BufferNum = 0;
+	int64 BytesFlushed = 0;
+	
+	int32 IndentLevel = 0;
+	ELastToken LastToken = ELastToken::None;
+	
+	// Scratch map for document objects: index of the last value of each key id
+	TMap<int32, int32> LastValueByKeyId;
+};
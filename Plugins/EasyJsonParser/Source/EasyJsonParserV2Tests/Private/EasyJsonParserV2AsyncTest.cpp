@@ -0,0 +1,124 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "EasyJsonObjectV2.h"
+#include "EasyJsonParseManagerV2.h"
+#include "EasyJsonAsyncLoadFromFileV2.h"
+#include "EasyJsonAsyncSaveToFileV2.h"
+#include "EasyJsonParserV2AsyncTestListener.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformFileManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace EasyJsonAsyncTest
+{
+	// How long to wait for the workers before checking anyway
+	static constexpr double TimeoutSeconds = 10.0;
+	
+	// A listener bound to a load node; both are rooted until the test ends
+	UEasyJsonAsyncTestListenerV2* StartLoad(UEasyJsonAsyncLoadFromFileV2* Action, bool bCancelFirst)
+	{
+		UEasyJsonAsyncTestListenerV2* Listener = NewObject<UEasyJsonAsyncTestListenerV2>();
+		Listener->AddToRoot();
+		Action->AddToRoot();
+		Action->OnCompleted.AddDynamic(Listener, &UEasyJsonAsyncTestListenerV2::OnLoadCompleted);
+		Action->OnFailed.AddDynamic(Listener, &UEasyJsonAsyncTestListenerV2::OnLoadFailed);
+		if (bCancelFirst)
+		{
+			Action->Cancel();
+		}
+		Action->Activate();
+		return Listener;
+	}
+	
+	UEasyJsonAsyncTestListenerV2* BindSave(UEasyJsonAsyncSaveToFileV2* Action)
+	{
+		UEasyJsonAsyncTestListenerV2* Listener = NewObject<UEasyJsonAsyncTestListenerV2>();
+		Listener->AddToRoot();
+		Action->AddToRoot();
+		Action->OnCompleted.AddDynamic(Listener, &UEasyJsonAsyncTestListenerV2::OnSaveCompleted);
+		Action->OnFailed.AddDynamic(Listener, &UEasyJsonAsyncTestListenerV2::OnSaveFailed);
+		return Listener;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2AsyncNodeTest, "EasyJsonParser.V2.AsyncNodes", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2AsyncNodeTest::RunTest(const FString& Parameters)
+{
+	using namespace EasyJsonAsyncTest;
+	
+	const FString TestDirectory = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyJsonParserTests"), TEXT("Async"));
+	const FString InputFile = FPaths::Combine(TestDirectory, TEXT("Input.json"));
+	const FString SavedFile = FPaths::Combine(TestDirectory, TEXT("Saved.json"));
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	FFileHelper::SaveStringToFile(TEXT("{\"name\": \"async\", \"count\": 3}"), *InputFile);
+	PlatformFile.DeleteFile(*SavedFile);
+	
+	// No world context: the nodes are kept alive by rooting them instead of the game instance
+	UEasyJsonAsyncLoadFromFileV2* LoadAction = UEasyJsonAsyncLoadFromFileV2::AsyncLoadFromFile(nullptr, InputFile, true);
+	UEasyJsonAsyncTestListenerV2* Loaded = StartLoad(LoadAction, false);
+	UEasyJsonAsyncLoadFromFileV2* MissingAction = UEasyJsonAsyncLoadFromFileV2::AsyncLoadFromFile(nullptr, FPaths::Combine(TestDirectory, TEXT("Missing.json")), true);
+	UEasyJsonAsyncTestListenerV2* Missing = StartLoad(MissingAction, false);
+	
+	// Cancelled before it runs: the worker skips the load and nothing is delivered
+	UEasyJsonAsyncLoadFromFileV2* CancelledAction = UEasyJsonAsyncLoadFromFileV2::AsyncLoadFromFile(nullptr, InputFile, true);
+	UEasyJsonAsyncTestListenerV2* Cancelled = StartLoad(CancelledAction, true);
+	TestTrue("Cancelled node reports it", CancelledAction->IsCancelled());
+	
+	// The save node takes its snapshot when it is called, so edits made afterwards are not written
+	bool bSuccess = false;
+	FEasyJsonObjectV2 Source = FEasyJsonObjectV2::CreateFromString(TEXT("{\"score\": 1, \"items\": [1]}"), bSuccess);
+	UEasyJsonAsyncSaveToFileV2* SaveAction = UEasyJsonAsyncSaveToFileV2::AsyncSaveToFile(nullptr, Source, SavedFile, true);
+	UEasyJsonAsyncTestListenerV2* Saved = BindSave(SaveAction);
+	Source.WriteInt(TEXT("score"), 2);
+	Source.AddIntToArray(TEXT("items"), 2);
+	SaveAction->Activate();
+	Source.WriteInt(TEXT("score"), 3);
+	
+	const TArray<UObject*> Rooted = {Loaded, LoadAction, Missing, MissingAction, Cancelled, CancelledAction, Saved, SaveAction};
+	
+	const double StartTime = FPlatformTime::Seconds();
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Rooted, Loaded, Missing, Cancelled, Saved, SavedFile, TestDirectory, StartTime]() -> bool
+	{
+		const bool bDone = Loaded->NumResults() > 0 && Missing->NumResults() > 0 && Saved->NumResults() > 0;
+		if (!bDone && FPlatformTime::Seconds() - StartTime < TimeoutSeconds)
+		{
+			return false;
+		}
+		
+		TestEqual("Load completes", Loaded->NumCompleted, 1);
+		TestEqual("Load does not fail", Loaded->NumFailed, 0);
+		TestEqual("Loaded string", Loaded->JsonObject.ReadString(TEXT("name")), FString(TEXT("async")));
+		TestEqual("Loaded number", Loaded->JsonObject.ReadInt(TEXT("count")), 3);
+		
+		TestEqual("Missing file fails", Missing->NumFailed, 1);
+		TestEqual("Missing file does not complete", Missing->NumCompleted, 0);
+		TestFalse("Failure has a reason", Missing->ErrorMessage.IsEmpty());
+		
+		TestEqual("Cancelled node delivers nothing", Cancelled->NumResults(), 0);
+		
+		TestEqual("Save completes", Saved->NumCompleted, 1);
+		TestEqual("Save does not fail", Saved->NumFailed, 0);
+		bool bLoaded = false;
+		FString ErrorMessage;
+		const FEasyJsonObjectV2 Written = UEasyJsonParseManagerV2::LoadFromFile(SavedFile, true, bLoaded, ErrorMessage);
+		TestTrue("Saved file loads", bLoaded);
+		TestEqual("Snapshot score", Written.ReadInt(TEXT("score")), 1);
+		TestEqual("Snapshot array", Written.GetArraySize(TEXT("items")), 1);
+		
+		for (UObject* Object : Rooted)
+		{
+			Object->RemoveFromRoot();
+		}
+		FPlatformFileManager::Get().GetPlatformFile().DeleteDirectoryRecursively(*TestDirectory);
+		return true;
+	}));
+	
+	return true;
+}
+
+#endif
@@ -0,0 +1,53 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "EasyJsonObjectV2.h"
+#include "EasyJsonParserV2AsyncTestListener.generated.h"
+
+/**
+ * Records what an async node delivered, for the async node tests
+ */
+UCLASS()
+class UEasyJsonAsyncTestListenerV2 : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION()
+	void OnLoadCompleted(const FEasyJsonObjectV2& InJsonObject, const FString& InErrorMessage)
+	{
+		++NumCompleted;
+		JsonObject = InJsonObject;
+	}
+	
+	UFUNCTION()
+	void OnLoadFailed(const FEasyJsonObjectV2& InJsonObject, const FString& InErrorMessage)
+	{
+		++NumFailed;
+		ErrorMessage = InErrorMessage;
+	}
+	
+	UFUNCTION()
+	void OnSaveCompleted(const FString& InErrorMessage)
+	{
+		++NumCompleted;
+	}
+	
+	UFUNCTION()
+	void OnSaveFailed(const FString& InErrorMessage)
+	{
+		++NumFailed;
+		ErrorMessage = InErrorMessage;
+	}
+	
+	// Number of results delivered either way
+	int32 NumResults() const { return NumCompleted + NumFailed; }
+	
+	int32 NumCompleted = 0;
+	int32 NumFailed = 0;
+	FEasyJsonObjectV2 JsonObject;
+	FString ErrorMessage;
+};
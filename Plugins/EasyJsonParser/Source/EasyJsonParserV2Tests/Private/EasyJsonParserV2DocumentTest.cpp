@@ -0,0 +1,406 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "EasyJsonObjectV2.h"
+#include "EasyJsonDocumentV2.h"
+#include "EasyJsonArenaV2.h"
+#include "EasyJsonDocumentCacheV2.h"
+#include "EasyJsonFileWatcherV2.h"
+#include "EasyJsonParseManagerV2.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformFileManager.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2DocumentTest, "EasyJsonParser.V2.Document", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2DocumentTest::RunTest(const FString& Parameters)
+{
+	const FString TestJson = TEXT(R"({
+		"name": "Escaped \"quote\" caf\u00e9",
+		"Count": 42,
+		"ratio": 0.5,
+		"enabled": true,
+		"nothing": null,
+		"dup": 1,
+		"DUP": 2,
+		"player": {"stats": {"level": 7}, "items": [{"id": 1}, {"id": 2}, {"id": 3}]},
+		"matrix": [[1, 2, 3], [4, 5, 6]],
+		"mixed": [1, "two", false, {}, []]
+	})");
+	
+	bool bDomSuccess = false;
+	const FEasyJsonObjectV2 DomObject = FEasyJsonObjectV2::CreateFromString(TestJson, bDomSuccess);
+	bool bDocumentSuccess = false;
+	const FEasyJsonObjectV2 DocumentObject = FEasyJsonObjectV2::CreateDocumentFromString(TestJson, bDocumentSuccess);
+	TestTrue("DOM parse should succeed", bDomSuccess);
+	TestTrue("Document parse should succeed", bDocumentSuccess);
+	TestTrue("Result should be a document view", DocumentObject.IsDocumentView());
+	
+	// Reads through the view must match reads through the engine tree
+	TestEqual("String", DocumentObject.ReadString(TEXT("name")), DomObject.ReadString(TEXT("name")));
+	TestEqual("Case-insensitive key", DocumentObject.ReadInt(TEXT("count")), 42);
+	TestEqual("Float", DocumentObject.ReadFloat(TEXT("ratio")), 0.5f);
+	TestTrue("Bool", DocumentObject.ReadBool(TEXT("enabled")));
+	TestEqual("Duplicate key keeps the last value", DocumentObject.ReadInt(TEXT("dup")), DomObject.ReadInt(TEXT("dup")));
+	TestEqual("Nested value", DocumentObject.ReadInt(TEXT("player.stats.level")), 7);
+	TestEqual("Array element field", DocumentObject.ReadInt(TEXT("player.items[2].id")), 3);
+	TestEqual("Number read as string", DocumentObject.ReadString(TEXT("Count")), DomObject.ReadString(TEXT("Count")));
+	TestEqual("Missing value uses the default", DocumentObject.ReadInt(TEXT("player.missing"), -1), -1);
+	TestEqual("Array size", DocumentObject.GetArraySize(TEXT("player.items")), 3);
+	TestEqual("2D access", DocumentObject.Read2DArrayInt(TEXT("matrix"), 1, 2), 6);
+	TestTrue("Dimension sizes", DocumentObject.GetArrayDimensionSizes(TEXT("matrix")) == DomObject.GetArrayDimensionSizes(TEXT("matrix")));
+	
+	bool bFound = false;
+	const TArray<FEasyJsonObjectV2> Items = DocumentObject.ReadObjects(TEXT("player.items"), bFound);
+	TestTrue("ReadObjects should find the array", bFound);
+	TestEqual("ReadObjects count", Items.Num(), 3);
+	if (Items.Num() == 3)
+	{
+		TestTrue("Elements should stay document views", Items[1].IsDocumentView());
+		TestEqual("Element field", Items[1].ReadInt(TEXT("id")), 2);
+	}
+	
+	const TArray<FEasyJsonValueV2> Mixed = DocumentObject.ReadArrayValues(TEXT("mixed"));
+	TestEqual("Mixed array count", Mixed.Num(), 5);
+	if (Mixed.Num() == 5)
+	{
+		TestTrue("Number element", Mixed[0].IsNumber());
+		TestEqual("String element", Mixed[1].GetStringValue(), FString(TEXT("two")));
+		TestTrue("Bool element", Mixed[2].IsBool());
+		TestTrue("Object element", Mixed[3].IsObject());
+		TestTrue("Array element", Mixed[4].IsArray());
+	}
+	
+	// Serializing the view gives the same text as the engine tree
+	TestEqual("ToString", DocumentObject.ToString(), DomObject.ToString());
+	
+	// Writing to a copy detaches it and leaves the shared document untouched
+	FEasyJsonObjectV2 Edited = DocumentObject;
+	Edited.WriteInt(TEXT("player.stats.level"), 8);
+	TestFalse("Written copy should no longer be a view", Edited.IsDocumentView());
+	TestEqual("Written value", Edited.ReadInt(TEXT("player.stats.level")), 8);
+	TestEqual("Other fields survive the copy", Edited.ReadString(TEXT("name")), DomObject.ReadString(TEXT("name")));
+	TestEqual("Original view is unchanged", DocumentObject.ReadInt(TEXT("player.stats.level")), 7);
+	
+	// UTF-8 input produces the same document
+	const FTCHARToUTF8 Utf8(*TestJson);
+	bool bUtf8Success = false;
+	const FEasyJsonObjectV2 Utf8Object = FEasyJsonObjectV2::CreateDocumentFromUtf8(TArrayView<const uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length()), bUtf8Success);
+	TestTrue("UTF-8 parse should succeed", bUtf8Success);
+	TestEqual("UTF-8 document matches", Utf8Object.ToString(), DomObject.ToString());
+	
+	// Invalid input and non-object roots fail
+	bool bInvalidSuccess = true;
+	FEasyJsonObjectV2::CreateDocumentFromString(TEXT("{\"value\": "), bInvalidSuccess);
+	TestFalse("Invalid JSON should fail", bInvalidSuccess);
+	FEasyJsonObjectV2::CreateDocumentFromString(TEXT("[1, 2]"), bInvalidSuccess);
+	TestFalse("Array root should fail", bInvalidSuccess);
+	
+	// The tape can be queried directly
+	FString ErrorMessage;
+	const TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> Document = FEasyJsonDocumentV2::Parse(FStringView(TEXT("[10, \"x\", [1, 2]]")), ErrorMessage);
+	TestTrue("Array document should parse", Document.IsValid());
+	if (Document.IsValid())
+	{
+		TestTrue("Root type", Document->GetType(FEasyJsonDocumentV2::RootIndex) == EEasyJsonTapeType::Array);
+		TestEqual("Root count", Document->GetNum(FEasyJsonDocumentV2::RootIndex), 3);
+		TestEqual("Element number", Document->GetNumber(Document->GetArrayElement(FEasyJsonDocumentV2::RootIndex, 0)), 10.0);
+		TestEqual("Element string", FString(Document->GetString(Document->GetArrayElement(FEasyJsonDocumentV2::RootIndex, 1))), FString(TEXT("x")));
+		TestEqual("Out of range", Document->GetArrayElement(FEasyJsonDocumentV2::RootIndex, 3), static_cast<int32>(INDEX_NONE));
+		TestEqual("Skip reaches the end", Document->GetNextIndex(FEasyJsonDocumentV2::RootIndex), Document->GetEndIndex(FEasyJsonDocumentV2::RootIndex));
+		TestTrue("Allocated size", Document->GetAllocatedSize() >= Document->GetTapeNum() * sizeof(uint64) + Document->GetStringsNum() * sizeof(TCHAR));
+	}
+	
+	// Keys are interned: each spelling is stored once and lookups ignore case
+	const TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> Records = FEasyJsonDocumentV2::Parse(FStringView(TEXT("[{\"id\": 1, \"Name\": \"a\"}, {\"id\": 2, \"name\": \"b\"}, {\"id\": 3, \"Name\": \"c\"}]")), ErrorMessage);
+	TestTrue("Records document should parse", Records.IsValid());
+	if (Records.IsValid())
+	{
+		TestEqual("Distinct key spellings", Records->GetNumKeys(), 3);
+		const int32 Second = Records->GetArrayElement(FEasyJsonDocumentV2::RootIndex, 1);
+		TestEqual("Lookup across spellings", FString(Records->GetString(Records->FindField(Second, TEXT("NAME")))), FString(TEXT("b")));
+		TestEqual("Lookup with a step hash", Records->GetNumber(Records->FindField(Second, TEXT("id"), FAccessStep(TEXT("ID")).PropertyNameHash)), 2.0);
+		TestEqual("Unknown key", Records->FindField(Second, TEXT("missing")), static_cast<int32>(INDEX_NONE));
+	}
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2ArenaTest, "EasyJsonParser.V2.Arena", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2ArenaTest::RunTest(const FString& Parameters)
+{
+	// A presized arena serves everything from one block
+	FEasyJsonArenaV2 Arena(10 * sizeof(uint64) + 20 * sizeof(TCHAR));
+	uint64* Entries = Arena.AllocateArray<uint64>(10);
+	TCHAR* Chars = Arena.AllocateArray<TCHAR>(20);
+	TestEqual("One block", Arena.GetNumBlocks(), 1);
+	TestTrue("Allocations are contiguous", reinterpret_cast<uint8*>(Chars) == reinterpret_cast<uint8*>(Entries + 10));
+	TestTrue("Allocation is null for zero bytes", Arena.Allocate(0) == nullptr);
+	
+	// Overflowing starts a new block, and alignment is honored
+	for (int32 Index = 1; Index < 1000; ++Index)
+	{
+		void* Memory = Arena.Allocate(Index % 13 + 1, 8);
+		TestTrue("Aligned", IsAligned(Memory, 8));
+	}
+	TestTrue("More blocks", Arena.GetNumBlocks() > 1);
+	TestTrue("Used size", Arena.GetUsedSize() <= Arena.GetAllocatedSize());
+	
+	Arena.Reset();
+	TestEqual("Reset keeps one block", Arena.GetNumBlocks(), 1);
+	TestTrue("Reset rewinds", Arena.GetUsedSize() == 0);
+	
+	FEasyJsonArenaV2 Moved = MoveTemp(Arena);
+	TestEqual("Moved-from arena is empty", Arena.GetNumBlocks(), 0);
+	TestEqual("Moved-to arena owns the block", Moved.GetNumBlocks(), 1);
+	
+	// A document with much unused reserved room (long strings of whitespace) is copied into an exact block
+	FString PaddedJson = TEXT("[");
+	for (int32 Index = 0; Index < 1000; ++Index)
+	{
+		PaddedJson += FString::Printf(TEXT("%s%d"), Index > 0 ? TEXT(",") : TEXT(""), Index);
+		PaddedJson += FString::ChrN(200, TEXT(' '));
+	}
+	PaddedJson += TEXT("]");
+	
+	FString ErrorMessage;
+	const TSharedPtr<const FEasyJsonDocumentV2, ESPMode::ThreadSafe> Document = FEasyJsonDocumentV2::Parse(FStringView(PaddedJson), ErrorMessage);
+	TestTrue("Padded document should parse", Document.IsValid());
+	if (Document.IsValid())
+	{
+		const SIZE_T UsedBytes = Document->GetTapeNum() * sizeof(uint64) + Document->GetStringsNum() * sizeof(TCHAR);
+		TestTrue("Storage is shrunk to the used size", Document->GetAllocatedSize() < UsedBytes * 2);
+		TestEqual("Values survive the shrink", Document->GetNumber(Document->GetArrayElement(FEasyJsonDocumentV2::RootIndex, 999)), 999.0);
+	}
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2LazyDocumentTest, "EasyJsonParser.V2.LazyDocument", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2LazyDocumentTest::RunTest(const FString& Parameters)
+{
+	const FString TestJson = TEXT(R"({
+		"name": "Escaped \"quote\" caf\u00e9",
+		"Count": 42,
+		"ratio": 0.5,
+		"enabled": true,
+		"dup": 1,
+		"DUP": 2,
+		"caf\u00e9": "escaped key",
+		"player": {"stats": {"level": 7}, "items": [{"id": 1}, {"id": 2}, {"id": 3}]},
+		"matrix": [[1, 2, 3], [4, 5, 6]],
+		"mixed": [1, "two", false, {}, []]
+	})");
+	
+	bool bDomSuccess = false;
+	const FEasyJsonObjectV2 DomObject = FEasyJsonObjectV2::CreateFromString(TestJson, bDomSuccess);
+	bool bLazySuccess = false;
+	const FEasyJsonObjectV2 LazyObject = FEasyJsonObjectV2::CreateLazyFromString(TestJson, bLazySuccess);
+	TestTrue("DOM parse should succeed", bDomSuccess);
+	TestTrue("Lazy parse should succeed", bLazySuccess);
+	TestTrue("Result should be a document view", LazyObject.IsDocumentView());
+	
+	// Reads parse only the visited values and match the engine tree
+	TestEqual("String", LazyObject.ReadString(TEXT("name")), DomObject.ReadString(TEXT("name")));
+	TestEqual("Case-insensitive key", LazyObject.ReadInt(TEXT("count")), 42);
+	TestEqual("Float", LazyObject.ReadFloat(TEXT("ratio")), 0.5f);
+	TestTrue("Bool", LazyObject.ReadBool(TEXT("enabled")));
+	TestEqual("Duplicate key keeps the last value", LazyObject.ReadInt(TEXT("dup")), DomObject.ReadInt(TEXT("dup")));
+	TestEqual("Escaped key", LazyObject.ReadString(TEXT("caf\u00e9")), FString(TEXT("escaped key")));
+	TestEqual("Nested value", LazyObject.ReadInt(TEXT("player.stats.level")), 7);
+	TestEqual("Array element field", LazyObject.ReadInt(TEXT("player.items[2].id")), 3);
+	TestEqual("Missing value uses the default", LazyObject.ReadInt(TEXT("player.missing"), -1), -1);
+	TestEqual("Array size", LazyObject.GetArraySize(TEXT("player.items")), 3);
+	TestEqual("2D access", LazyObject.Read2DArrayInt(TEXT("matrix"), 1, 2), 6);
+	
+	bool bFound = false;
+	const TArray<FEasyJsonObjectV2> Items = LazyObject.ReadObjects(TEXT("player.items"), bFound);
+	TestTrue("ReadObjects should find the array", bFound);
+	TestEqual("ReadObjects count", Items.Num(), 3);
+	if (Items.Num() == 3)
+	{
+		TestTrue("Elements should stay lazy views", Items[1].IsDocumentView());
+		TestEqual("Element field", Items[1].ReadInt(TEXT("id")), 2);
+	}
+	
+	const TArray<FEasyJsonValueV2> Mixed = LazyObject.ReadArrayValues(TEXT("mixed"));
+	TestEqual("Mixed array count", Mixed.Num(), 5);
+	if (Mixed.Num() == 5)
+	{
+		TestTrue("Number element", Mixed[0].IsNumber());
+		TestEqual("String element", Mixed[1].GetStringValue(), FString(TEXT("two")));
+		TestTrue("Bool element", Mixed[2].IsBool());
+		TestTrue("Object element", Mixed[3].IsObject());
+		TestTrue("Array element", Mixed[4].IsArray());
+	}
+	
+	TestEqual("ToString", LazyObject.ToString(), DomObject.ToString());
+	
+	// Writing detaches the copy, as with other documents
+	FEasyJsonObjectV2 Edited = LazyObject;
+	Edited.WriteInt(TEXT("player.stats.level"), 8);
+	TestFalse("Written copy should no longer be a view", Edited.IsDocumentView());
+	TestEqual("Written value", Edited.ReadInt(TEXT("player.stats.level")), 8);
+	TestEqual("Original view is unchanged", LazyObject.ReadInt(TEXT("player.stats.level")), 7);
+	
+	// UTF-8 source bytes are indexed in place
+	const FTCHARToUTF8 Utf8(*TestJson);
+	TArray<uint8> Utf8Bytes(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	bool bSourceSuccess = false;
+	const FEasyJsonObjectV2 SourceObject = FEasyJsonObjectV2::CreateLazyFromSource(FEasyJsonSourceV2::FromBuffer(MoveTemp(Utf8Bytes)), bSourceSuccess);
+	TestTrue("Source parse should succeed", bSourceSuccess);
+	TestEqual("Source escaped key", SourceObject.ReadString(TEXT("caf\u00e9")), FString(TEXT("escaped key")));
+	TestEqual("Source document matches", SourceObject.ToString(), DomObject.ToString());
+	
+	// Only the bracket structure is checked up front
+	bool bInvalidSuccess = true;
+	FEasyJsonObjectV2::CreateLazyFromString(TEXT("{\"a\": [1, 2}"), bInvalidSuccess);
+	TestFalse("Mismatched brackets should fail", bInvalidSuccess);
+	FEasyJsonObjectV2::CreateLazyFromString(TEXT("{\"a\": 1} {}"), bInvalidSuccess);
+	TestFalse("Trailing data should fail", bInvalidSuccess);
+	
+	// Malformed scalars are only found when read, and then read as missing
+	bool bMalformedSuccess = false;
+	const FEasyJsonObjectV2 Malformed = FEasyJsonObjectV2::CreateLazyFromString(TEXT(R"({"number": 12x, "word": tomato, "truth": trueish, "nothing": nul, "escape": "bad \q escape", "ok": 5, "values": [12x, tomato, nul, "bad \q"]})"), bMalformedSuccess);
+	TestTrue("Malformed scalars pass the structure check", bMalformedSuccess);
+	TestEqual("Malformed number", Malformed.ReadInt(TEXT("number"), -1), -1);
+	TestEqual("Malformed number as string", Malformed.ReadString(TEXT("number"), TEXT("default")), FString(TEXT("default")));
+	TestFalse("Word is not a bool", Malformed.ReadBool(TEXT("word"), false));
+	TestEqual("Word is not a number", Malformed.ReadInt(TEXT("word"), -1), -1);
+	TestFalse("Literal prefix is not a bool", Malformed.ReadBool(TEXT("truth"), false));
+	TestEqual("Bad escape", Malformed.ReadString(TEXT("escape"), TEXT("default")), FString(TEXT("default")));
+	TestEqual("Valid value next to malformed ones", Malformed.ReadInt(TEXT("ok"), -1), 5);
+	
+	const TArray<FEasyJsonValueV2> Values = Malformed.ReadArrayValues(TEXT("values"));
+	TestEqual("Malformed elements are still counted", Values.Num(), 4);
+	if (Values.Num() == 4)
+	{
+		bool bValue = true;
+		double Number = 0.0;
+		FString String;
+		TestFalse("TryGetNumber fails", Values[0].TryGetNumber(Number));
+		TestFalse("TryGetBool fails", Values[1].TryGetBool(bValue));
+		TestFalse("Misspelled null is not null", Values[2].IsNull());
+		TestFalse("TryGetString fails", Values[3].TryGetString(String));
+	}
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2DocumentCacheTest, "EasyJsonParser.V2.DocumentCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2DocumentCacheTest::RunTest(const FString& Parameters)
+{
+	const FString TestDirectory = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyJsonParserTests"), TEXT("Cache"));
+	const FString FirstFile = FPaths::Combine(TestDirectory, TEXT("First.json"));
+	const FString SecondFile = FPaths::Combine(TestDirectory, TEXT("Second.json"));
+	FFileHelper::SaveStringToFile(TEXT("{\"value\": 1, \"list\": [1, 2, 3]}"), *FirstFile);
+	FFileHelper::SaveStringToFile(TEXT("{\"value\": 2, \"list\": [4, 5, 6]}"), *SecondFile);
+	
+	FEasyJsonDocumentCacheV2 Cache;
+	bool bSuccess = false;
+	FString ErrorMessage;
+	
+	// The second load shares the first one's document
+	FEasyJsonObjectV2 First = Cache.LoadFile(FirstFile, bSuccess, ErrorMessage);
+	TestTrue("First load", bSuccess);
+	FEasyJsonObjectV2 Again = Cache.LoadFile(FirstFile, bSuccess, ErrorMessage);
+	TestTrue("Cached load", bSuccess);
+	TestTrue("Same document", First.GetDocument().IsValid() && First.GetDocument() == Again.GetDocument());
+	TestEqual("One miss", Cache.GetNumMisses(), static_cast<int64>(1));
+	TestEqual("One hit", Cache.GetNumHits(), static_cast<int64>(1));
+	TestTrue("Memory is counted", Cache.GetUsedBytes() > 0);
+	
+	// Writing to a returned object leaves the cached document alone
+	Again.WriteInt(TEXT("value"), 100);
+	TestEqual("Written copy", Again.ReadInt(TEXT("value")), 100);
+	TestEqual("Cached value unchanged", Cache.LoadFile(FirstFile, bSuccess, ErrorMessage).ReadInt(TEXT("value")), 1);
+	
+	// A changed file is parsed again
+	FFileHelper::SaveStringToFile(TEXT("{\"value\": 10, \"list\": [1, 2, 3, 4]}"), *FirstFile);
+	TestEqual("Changed file is reloaded", Cache.LoadFile(FirstFile, bSuccess, ErrorMessage).ReadInt(TEXT("value")), 10);
+	
+	// Invalidation forces a parse
+	const int64 MissesBefore = Cache.GetNumMisses();
+	Cache.Invalidate(FirstFile);
+	TestEqual("Invalidated file is dropped", Cache.Num(), 0);
+	Cache.LoadFile(FirstFile, bSuccess, ErrorMessage);
+	TestEqual("Invalidated file is parsed again", Cache.GetNumMisses(), MissesBefore + 1);
+	
+	// A budget for one document keeps only the most recently used file
+	Cache.SetMaxBytes(Cache.GetUsedBytes());
+	Cache.LoadFile(SecondFile, bSuccess, ErrorMessage);
+	TestEqual("Least recently used file is evicted", Cache.Num(), 1);
+	TestTrue("Budget is kept", Cache.GetUsedBytes() <= Cache.GetMaxBytes());
+	const int64 HitsBefore = Cache.GetNumHits();
+	Cache.LoadFile(SecondFile, bSuccess, ErrorMessage);
+	TestEqual("Most recent file is still cached", Cache.GetNumHits(), HitsBefore + 1);
+	
+	// Missing files fail and are not cached
+	Cache.LoadFile(FPaths::Combine(TestDirectory, TEXT("Missing.json")), bSuccess, ErrorMessage);
+	TestFalse("Missing file fails", bSuccess);
+	TestTrue("Missing file error", ErrorMessage.Contains(TEXT("File not found")));
+	
+	// The manager's cache
+	UEasyJsonParseManagerV2::ClearFileCache();
+	FEasyJsonObjectV2 Managed = UEasyJsonParseManagerV2::LoadFromFileCached(SecondFile, true, bSuccess, ErrorMessage);
+	TestTrue("Manager cached load", bSuccess && Managed.ReadInt(TEXT("value")) == 2);
+	UEasyJsonParseManagerV2::ClearFileCache();
+	
+	FPlatformFileManager::Get().GetPlatformFile().DeleteDirectoryRecursively(*TestDirectory);
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2FileWatcherTest, "EasyJsonParser.V2.FileWatcher", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2FileWatcherTest::RunTest(const FString& Parameters)
+{
+	const FString TestDirectory = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyJsonParserTests"), TEXT("Watcher"));
+	const FString TuningFile = FPaths::Combine(TestDirectory, TEXT("Tuning.json"));
+	const FString OtherFile = FPaths::Combine(TestDirectory, TEXT("Other.json"));
+	FFileHelper::SaveStringToFile(TEXT("{\"speed\": 1}"), *TuningFile);
+	FFileHelper::SaveStringToFile(TEXT("{\"speed\": 2}"), *OtherFile);
+	
+	TSharedRef<FEasyJsonFileWatcherV2, ESPMode::ThreadSafe> Watcher = FEasyJsonFileWatcherV2::Create();
+	FString ErrorMessage;
+	TestTrue("Watch tuning file", Watcher->Watch(TuningFile, ErrorMessage));
+	TestTrue("Watch other file", Watcher->Watch(OtherFile, ErrorMessage));
+	TestFalse("Missing file cannot be watched", Watcher->Watch(FPaths::Combine(TestDirectory, TEXT("Missing.json")), ErrorMessage));
+	
+	int32 Version = INDEX_NONE;
+	const FEasyJsonObjectV2 OldSnapshot = Watcher->GetSnapshot(TuningFile, &Version);
+	TestEqual("First snapshot", OldSnapshot.ReadInt(TEXT("speed")), 1);
+	TestEqual("First version", Version, 0);
+	TestEqual("Nothing changed", Watcher->CheckForChanges().Num(), 0);
+	
+	// Only the changed file is reloaded; a snapshot taken earlier keeps its document
+	FFileHelper::SaveStringToFile(TEXT("{\"speed\": 10, \"boost\": true}"), *TuningFile);
+	const TArray<FString> Reloaded = Watcher->CheckForChanges();
+	TestEqual("One file reloaded", Reloaded.Num(), 1);
+	const FEasyJsonObjectV2 NewSnapshot = Watcher->GetSnapshot(TuningFile, &Version);
+	TestEqual("New snapshot", NewSnapshot.ReadInt(TEXT("speed")), 10);
+	TestEqual("Version goes up", Version, 1);
+	TestEqual("Old snapshot unchanged", OldSnapshot.ReadInt(TEXT("speed")), 1);
+	TestEqual("Other file untouched", Watcher->GetSnapshot(OtherFile).ReadInt(TEXT("speed")), 2);
+	
+	// A broken save keeps the last good snapshot
+	FFileHelper::SaveStringToFile(TEXT("{\"speed\": 20, \"boost\": "), *TuningFile);
+	TestEqual("Broken file is not published", Watcher->CheckForChanges().Num(), 0);
+	TestEqual("Last good snapshot stays", Watcher->GetSnapshot(TuningFile).ReadInt(TEXT("speed")), 10);
+	TestFalse("Reload error is kept", Watcher->GetLastError(TuningFile).IsEmpty());
+	
+	Watcher->Unwatch(TuningFile);
+	TestFalse("Unwatched file has no snapshot", Watcher->GetSnapshot(TuningFile).IsValid());
+	
+	FPlatformFileManager::Get().GetPlatformFile().DeleteDirectoryRecursively(*TestDirectory);
+	
+	return true;
+}
+
+#endif
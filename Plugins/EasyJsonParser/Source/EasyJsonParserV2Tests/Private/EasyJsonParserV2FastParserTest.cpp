@@ -0,0 +1,412 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "EasyJsonObjectV2.h"
+#include "EasyJsonFastParserV2.h"
+#include "EasyJsonParseManagerV2.h"
+#include "EasyJsonBatchLoaderV2.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformFileManager.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace EasyJsonFastParserTest
+{
+	FString ToCondensedString(const TSharedPtr<FJsonObject>& JsonObject)
+	{
+		FString Output;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Output);
+		FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+		return Output;
+	}
+	
+	FString ParseWithEngine(const FString& Json)
+	{
+		TSharedPtr<FJsonObject> JsonObject;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+		return FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid() ? ToCondensedString(JsonObject) : FString();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2FastParserTest, "EasyJsonParser.V2.FastParser", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2FastParserTest::RunTest(const FString& Parameters)
+{
+	using namespace EasyJsonFastParserTest;
+	
+	// Long enough to span several 64 character blocks, with escapes and quotes near block edges
+	const FString TestJson = TEXT(R"({
+		"name": "Escaped \"quote\" and backslash \\ and \\\"mixed\\\"",
+		"unicode": "caf\u00e9 \u3042 \ud83d\ude00",
+		"path": "C:\\Program Files\\Game\\",
+		"numbers": [0, -1, 3.5, 1e3, -2.5E-2, 123456789012345678, 0.1],
+		"flags": [true, false, null],
+		"nested": {"empty": {}, "list": [], "deep": [[1, [2, [3]]]]},
+		"text with spaces": "  {not: [structural]}  ",
+		"last": "value"
+	})");
+	
+	const FString Expected = ParseWithEngine(TestJson);
+	TestFalse("Engine reader should parse the test document", Expected.IsEmpty());
+	
+	// Every instruction set tier must produce the same tree as the engine reader
+	const EEasyJsonSimdLevel Levels[] = { EEasyJsonSimdLevel::Scalar, EEasyJsonSimdLevel::SSE42, EEasyJsonSimdLevel::AVX2 };
+	for (const EEasyJsonSimdLevel Level : Levels)
+	{
+		FEasyJsonFastParserV2::SetMaxSimdLevel(Level);
+		
+		TSharedPtr<FJsonObject> JsonObject;
+		FString ErrorMessage;
+		const bool bParsed = FEasyJsonFastParserV2::ParseObject(TestJson, JsonObject, ErrorMessage);
+		TestTrue(FString::Printf(TEXT("Fast parse (level %d): %s"), (int32)Level, *ErrorMessage), bParsed);
+		if (bParsed)
+		{
+			TestEqual(FString::Printf(TEXT("Same tree as engine reader (level %d)"), (int32)Level), ToCondensedString(JsonObject), Expected);
+		}
+	}
+	FEasyJsonFastParserV2::SetMaxSimdLevel(EEasyJsonSimdLevel::AVX2);
+	
+	// Values through FEasyJsonObjectV2
+	bool bSuccess = false;
+	FString ErrorMessage;
+	FEasyJsonObjectV2 JsonObject = UEasyJsonParseManagerV2::LoadFromString(TestJson, bSuccess, ErrorMessage);
+	TestTrue("LoadFromString should succeed", bSuccess);
+	TestEqual("Escaped string", JsonObject.ReadString(TEXT("name")), FString(TEXT("Escaped \"quote\" and backslash \\ and \\\"mixed\\\"")));
+	TestEqual("Windows path", JsonObject.ReadString(TEXT("path")), FString(TEXT("C:\\Program Files\\Game\\")));
+	TestEqual("Integer", JsonObject.ReadInt(TEXT("numbers[3]")), 1000);
+	TestEqual("Negative exponent", JsonObject.ReadFloat(TEXT("numbers[4]")), -0.025f);
+	TestEqual("Text that looks structural", JsonObject.ReadString(TEXT("text with spaces")), FString(TEXT("  {not: [structural]}  ")));
+	TestEqual("Last value", JsonObject.ReadString(TEXT("last")), FString(TEXT("value")));
+	
+	// Root array and scalars
+	TSharedPtr<FJsonValue> RootValue;
+	TestTrue("Array root", FEasyJsonFastParserV2::ParseValue(TEXT(" [1, 2, 3] "), RootValue, ErrorMessage));
+	TestEqual("Array root size", RootValue->AsArray().Num(), 3);
+	TestTrue("Scalar root", FEasyJsonFastParserV2::ParseValue(TEXT("42"), RootValue, ErrorMessage));
+	TestEqual("Scalar root value", RootValue->AsNumber(), 42.0);
+	
+	// Invalid documents are rejected
+	const TCHAR* InvalidDocuments[] = {
+		TEXT(""),
+		TEXT("   "),
+		TEXT("{"),
+		TEXT("{\"a\":}"),
+		TEXT("{\"a\" 1}"),
+		TEXT("{\"a\":1,}"),
+		TEXT("[1 2]"),
+		TEXT("[01]"),
+		TEXT("[1.]"),
+		TEXT("[tru]"),
+		TEXT("[truex]"),
+		TEXT("{\"a\":\"unterminated}"),
+		TEXT("{\"a\":\"bad \\q escape\"}"),
+		TEXT("{} {}"),
+		TEXT("{a:1}"),
+	};
+	for (const TCHAR* Invalid : InvalidDocuments)
+	{
+		TestFalse(FString::Printf(TEXT("Reject: %s"), Invalid), FEasyJsonFastParserV2::ParseValue(Invalid, RootValue, ErrorMessage));
+	}
+	
+	// Not an object
+	TSharedPtr<FJsonObject> Object;
+	TestFalse("ParseObject rejects array root", FEasyJsonFastParserV2::ParseObject(TEXT("[1]"), Object, ErrorMessage));
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2Utf8ParseTest, "EasyJsonParser.V2.Utf8Parse", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2Utf8ParseTest::RunTest(const FString& Parameters)
+{
+	using namespace EasyJsonFastParserTest;
+	
+	const FString TestJson = TEXT("{\"name\": \"caf\u00e9 \u3042\", \"escaped\": \"\\u00e9\\ud83d\\ude00\", \"values\": [1, 2.5, true, null], \"nested\": {\"key\": \"value\"}}");
+	
+	// UTF-8 bytes parse to the same tree as the TCHAR string
+	FTCHARToUTF8 Utf8(*TestJson);
+	TArrayView<const uint8> Utf8Bytes(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	
+	TSharedPtr<FJsonObject> FromUtf8;
+	TSharedPtr<FJsonObject> FromString;
+	FString ErrorMessage;
+	TestTrue("Parse UTF-8", FEasyJsonFastParserV2::ParseObject(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Utf8.Get()), Utf8.Length()), FromUtf8, ErrorMessage));
+	TestTrue("Parse TCHAR", FEasyJsonFastParserV2::ParseObject(TestJson, FromString, ErrorMessage));
+	if (FromUtf8.IsValid() && FromString.IsValid())
+	{
+		TestEqual("UTF-8 and TCHAR trees match", ToCondensedString(FromUtf8), ToCondensedString(FromString));
+	}
+	
+	bool bSuccess = false;
+	FEasyJsonObjectV2 JsonObject = UEasyJsonParseManagerV2::LoadFromUtf8(Utf8Bytes, bSuccess, ErrorMessage);
+	TestTrue("LoadFromUtf8 should succeed", bSuccess);
+	TestEqual("Non-ASCII string", JsonObject.ReadString(TEXT("name")), FString(TEXT("caf\u00e9 \u3042")));
+	TestEqual("Escaped surrogate pair", JsonObject.ReadString(TEXT("escaped")).Len(), 3);
+	TestEqual("Nested value", JsonObject.ReadString(TEXT("nested.key")), FString(TEXT("value")));
+	
+	// Leading BOM is skipped
+	TArray<uint8> WithBom = { 0xEF, 0xBB, 0xBF };
+	WithBom.Append(Utf8Bytes.GetData(), Utf8Bytes.Num());
+	JsonObject = UEasyJsonParseManagerV2::LoadFromUtf8(WithBom, bSuccess, ErrorMessage);
+	TestTrue("LoadFromUtf8 with BOM should succeed", bSuccess);
+	TestEqual("Value after BOM", JsonObject.ReadInt(TEXT("values[0]")), 1);
+	
+	// Empty input
+	UEasyJsonParseManagerV2::LoadFromUtf8(TArrayView<const uint8>(), bSuccess, ErrorMessage);
+	TestFalse("Empty UTF-8 input should fail", bSuccess);
+	
+	// Files are read as bytes; UTF-8 and UTF-16 files both load
+	const FString Utf8File = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyJsonParserTests"), TEXT("Utf8Parse_utf8.json"));
+	const FString Utf16File = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyJsonParserTests"), TEXT("Utf8Parse_utf16.json"));
+	FFileHelper::SaveStringToFile(TestJson, *Utf8File, FFileHelper::EEncodingOptions::ForceUTF8);
+	FFileHelper::SaveStringToFile(TestJson, *Utf16File, FFileHelper::EEncodingOptions::ForceUnicode);
+	
+	JsonObject = UEasyJsonParseManagerV2::LoadFromFile(Utf8File, true, bSuccess, ErrorMessage);
+	TestTrue("UTF-8 file should load", bSuccess);
+	TestEqual("UTF-8 file value", JsonObject.ReadString(TEXT("name")), FString(TEXT("caf\u00e9 \u3042")));
+	
+	JsonObject = UEasyJsonParseManagerV2::LoadFromFile(Utf16File, true, bSuccess, ErrorMessage);
+	TestTrue("UTF-16 file should load", bSuccess);
+	TestEqual("UTF-16 file value", JsonObject.ReadString(TEXT("name")), FString(TEXT("caf\u00e9 \u3042")));
+	
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.DeleteFile(*Utf8File);
+	PlatformFile.DeleteFile(*Utf16File);
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2MemoryMappedTest, "EasyJsonParser.V2.MemoryMapped", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2MemoryMappedTest::RunTest(const FString& Parameters)
+{
+	using namespace EasyJsonFastParserTest;
+	
+	const FString TestJson = TEXT("{\"name\": \"caf\u00e9\", \"escaped\": \"a\\\"b\", \"values\": [1, -2.5, 1e3, true, null], \"nested\": {\"key\": \"value\", \"number\": \"42\"}}");
+	const FString TestFile = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyJsonParserTests"), TEXT("MemoryMapped.json"));
+	FFileHelper::SaveStringToFile(TestJson, *TestFile, FFileHelper::EEncodingOptions::ForceUTF8);
+	
+	bool bSuccess = false;
+	FString ErrorMessage;
+	const FEasyJsonObjectV2 Buffered = UEasyJsonParseManagerV2::LoadFromFile(TestFile, true, bSuccess, ErrorMessage);
+	TestTrue("Buffered load should succeed", bSuccess);
+	
+	// The mapping is released when the last value referring to it goes away, so the
+	// object stays readable after LoadFromFile returns
+	FEasyJsonObjectV2 Mapped = UEasyJsonParseManagerV2::LoadFromFile(TestFile, true, bSuccess, ErrorMessage, true);
+	TestTrue("Mapped load should succeed", bSuccess);
+	TestEqual("Mapped tree matches buffered tree", ToCondensedString(Mapped.ToJsonObject()), ToCondensedString(Buffered.ToJsonObject()));
+	TestEqual("View string", Mapped.ReadString(TEXT("name")), FString(TEXT("caf\u00e9")));
+	TestEqual("Escaped string", Mapped.ReadString(TEXT("escaped")), FString(TEXT("a\"b")));
+	TestEqual("View integer", Mapped.ReadInt(TEXT("values[0]")), 1);
+	TestEqual("View float", Mapped.ReadFloat(TEXT("values[1]")), -2.5f);
+	TestEqual("View exponent", Mapped.ReadInt(TEXT("values[2]")), 1000);
+	TestEqual("Number read as string", Mapped.ReadString(TEXT("values[0]")), Buffered.ReadString(TEXT("values[0]")));
+	TestEqual("String read as number", Mapped.ReadInt(TEXT("nested.number")), 42);
+	
+	// Views from an owned buffer behave the same
+	TArray<uint8> Bytes;
+	FFileHelper::LoadFileToArray(Bytes, *TestFile);
+	TSharedPtr<FJsonValue> RootValue;
+	TestTrue("Parse source", FEasyJsonFastParserV2::ParseValue(FEasyJsonSourceV2::FromBuffer(MoveTemp(Bytes)), RootValue, ErrorMessage));
+	if (RootValue.IsValid())
+	{
+		TestEqual("Source tree matches buffered tree", ToCondensedString(RootValue->AsObject()), ToCondensedString(Buffered.ToJsonObject()));
+	}
+	
+	// Writes replace the view with an owned value
+	Mapped.WriteString(TEXT("name"), TEXT("changed"));
+	TestEqual("Write over a view", Mapped.ReadString(TEXT("name")), FString(TEXT("changed")));
+	
+	RootValue.Reset();
+	Mapped = FEasyJsonObjectV2();
+	FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*TestFile);
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2ParallelParseTest, "EasyJsonParser.V2.ParallelParse", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2ParallelParseTest::RunTest(const FString& Parameters)
+{
+	using namespace EasyJsonFastParserTest;
+	
+	// A root object with two large arrays (one of them one level down) and a few small members
+	FString TestJson = TEXT("{\"meta\": {\"version\": 2, \"name\": \"export\"}, \"rows\": [");
+	for (int32 Row = 0; Row < 2000; ++Row)
+	{
+		TestJson += FString::Printf(TEXT("%s{\"id\": %d, \"name\": \"row \\\"%d\\\" caf\u00e9\", \"cells\": [%d, %d.5, true, null], \"tags\": {}}"), Row > 0 ? TEXT(", ") : TEXT(""), Row, Row, Row, -Row);
+	}
+	TestJson += TEXT("], \"payload\": {\"values\": [");
+	for (int32 Value = 0; Value < 3000; ++Value)
+	{
+		TestJson += FString::Printf(TEXT("%s%d"), Value > 0 ? TEXT(",") : TEXT(""), Value * 7);
+	}
+	TestJson += TEXT("]}, \"last\": [[]]}");
+	
+	FEasyJsonFastParserV2::SetParallelThreshold(MAX_int32);
+	TSharedPtr<FJsonObject> SequentialObject;
+	FString ErrorMessage;
+	TestTrue("Sequential parse", FEasyJsonFastParserV2::ParseObject(TestJson, SequentialObject, ErrorMessage));
+	const FString Expected = SequentialObject.IsValid() ? ToCondensedString(SequentialObject) : FString();
+	
+	// A low threshold forces the split on this small document; the tree must not change
+	FEasyJsonFastParserV2::SetParallelThreshold(64);
+	
+	TSharedPtr<FJsonObject> ParallelObject;
+	TestTrue("Parallel parse", FEasyJsonFastParserV2::ParseObject(TestJson, ParallelObject, ErrorMessage));
+	TestEqual("Parallel tree", ParallelObject.IsValid() ? ToCondensedString(ParallelObject) : FString(), Expected);
+	
+	const FTCHARToUTF8 Utf8(*TestJson);
+	TestTrue("Parallel UTF-8 parse", FEasyJsonFastParserV2::ParseObject(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Utf8.Get()), Utf8.Length()), ParallelObject, ErrorMessage));
+	TestEqual("Parallel UTF-8 tree", ParallelObject.IsValid() ? ToCondensedString(ParallelObject) : FString(), Expected);
+	
+	// Root arrays are split too
+	FString RootArray = TEXT("[");
+	for (int32 Value = 0; Value < 1000; ++Value)
+	{
+		RootArray += FString::Printf(TEXT("%s[%d, \"%d\"]"), Value > 0 ? TEXT(",") : TEXT(""), Value, Value);
+	}
+	RootArray += TEXT("]");
+	TSharedPtr<FJsonValue> RootValue;
+	TestTrue("Parallel root array", FEasyJsonFastParserV2::ParseValue(RootArray, RootValue, ErrorMessage));
+	TestTrue("Root array elements keep their order", RootValue.IsValid() && RootValue->AsArray().Num() == 1000 && RootValue->AsArray()[999]->AsArray()[0]->AsNumber() == 999.0);
+	
+	// An error inside a chunk is reported like the sequential parser reports it
+	const FString InvalidJson = TestJson.Replace(TEXT("\"id\": 1500,"), TEXT("\"id\": 1500"));
+	FString ParallelError;
+	TestFalse("Invalid element fails", FEasyJsonFastParserV2::ParseObject(InvalidJson, ParallelObject, ParallelError));
+	FEasyJsonFastParserV2::SetParallelThreshold(MAX_int32);
+	FString SequentialError;
+	TestFalse("Invalid element fails sequentially", FEasyJsonFastParserV2::ParseObject(InvalidJson, SequentialObject, SequentialError));
+	TestEqual("Same error message", ParallelError, SequentialError);
+	
+	FEasyJsonFastParserV2::SetParallelThreshold(FEasyJsonFastParserV2::DefaultParallelThreshold);
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2JsonLinesTest, "EasyJsonParser.V2.JsonLines", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2JsonLinesTest::RunTest(const FString& Parameters)
+{
+	// Enough lines to be split across workers, with CRLF endings and blank lines in between
+	FString JsonLines;
+	const int32 NumLines = 1000;
+	for (int32 LineIndex = 0; LineIndex < NumLines; ++LineIndex)
+	{
+		JsonLines += FString::Printf(TEXT("{\"id\": %d, \"name\": \"caf\u00e9 %d\"}\r\n"), LineIndex, LineIndex);
+		if (LineIndex % 100 == 0)
+		{
+			JsonLines += TEXT("   \n");
+		}
+	}
+	
+	bool bSuccess = false;
+	FString ErrorMessage;
+	TArray<FEasyJsonObjectV2> Objects = UEasyJsonParseManagerV2::LoadJsonLinesFromString(JsonLines, bSuccess, ErrorMessage);
+	TestTrue("String lines should parse", bSuccess);
+	TestEqual("Blank lines are skipped", Objects.Num(), NumLines);
+	if (Objects.Num() == NumLines)
+	{
+		TestEqual("Lines keep their order", Objects[NumLines - 1].ReadInt(TEXT("id")), NumLines - 1);
+		TestEqual("Line value", Objects[500].ReadString(TEXT("name")), FString(TEXT("caf\u00e9 500")));
+	}
+	
+	// Files are parsed as UTF-8 bytes (the BOM written here is skipped)
+	const FString TestFile = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyJsonParserTests"), TEXT("Lines.jsonl"));
+	FFileHelper::SaveStringToFile(JsonLines, *TestFile, FFileHelper::EEncodingOptions::ForceUTF8);
+	
+	Objects = UEasyJsonParseManagerV2::LoadJsonLines(TestFile, true, bSuccess, ErrorMessage);
+	TestTrue("File lines should parse", bSuccess);
+	TestEqual("File line count", Objects.Num(), NumLines);
+	if (Objects.Num() == NumLines)
+	{
+		TestEqual("First file line", Objects[0].ReadString(TEXT("name")), FString(TEXT("caf\u00e9 0")));
+	}
+	
+	// Callback mode does not keep the objects
+	std::atomic<int64> IdSum(0);
+	bSuccess = UEasyJsonParseManagerV2::LoadJsonLines(TestFile, true, [&IdSum](int32 LineIndex, FEasyJsonObjectV2&& Object)
+	{
+		IdSum += Object.ReadInt(TEXT("id"));
+	}, ErrorMessage);
+	TestTrue("Callback mode should succeed", bSuccess);
+	TestEqual("Every line is visited once", static_cast<int64>(IdSum.load()), static_cast<int64>(NumLines) * (NumLines - 1) / 2);
+	
+	// The first failing line is reported
+	Objects = UEasyJsonParseManagerV2::LoadJsonLinesFromString(TEXT("{\"a\": 1}\n\n{\"a\": }\n{\"a\": 3}\n{bad"), bSuccess, ErrorMessage);
+	TestFalse("Invalid line should fail", bSuccess);
+	TestTrue("Error names the line", ErrorMessage.Contains(TEXT("line 3")));
+	TestTrue("Other lines still parse", Objects.Num() == 4 && Objects[0].IsValid() && !Objects[1].IsValid() && Objects[2].ReadInt(TEXT("a")) == 3);
+	
+	FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*TestFile);
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2BatchLoaderTest, "EasyJsonParser.V2.BatchLoader", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2BatchLoaderTest::RunTest(const FString& Parameters)
+{
+	// More files than workers, with one invalid file and one missing file
+	const FString TestDirectory = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyJsonParserTests"), TEXT("Batch"));
+	const int32 NumFiles = 40;
+	TArray<FString> FilePaths;
+	for (int32 FileIndex = 0; FileIndex < NumFiles; ++FileIndex)
+	{
+		const FString FilePath = FPaths::Combine(TestDirectory, FString::Printf(TEXT("File%d.json"), FileIndex));
+		FilePaths.Add(FilePath);
+		if (FileIndex == 7)
+		{
+			continue;
+		}
+		FFileHelper::SaveStringToFile(FileIndex == 3 ? FString(TEXT("{\"id\": }")) : FString::Printf(TEXT("{\"id\": %d}"), FileIndex), *FilePath);
+	}
+	
+	const FEasyJsonBatchLoaderV2 Loader(4);
+	TArray<FEasyJsonBatchFileResultV2> Results = Loader.LoadAll(FilePaths);
+	TestEqual("One result per file", Results.Num(), NumFiles);
+	if (Results.Num() == NumFiles)
+	{
+		for (int32 FileIndex = 0; FileIndex < NumFiles; ++FileIndex)
+		{
+			const FEasyJsonBatchFileResultV2& Result = Results[FileIndex];
+			const bool bExpectSuccess = FileIndex != 3 && FileIndex != 7;
+			TestEqual(FString::Printf(TEXT("Result order %d"), FileIndex), Result.FileIndex, FileIndex);
+			TestEqual(FString::Printf(TEXT("Success %d"), FileIndex), Result.bSuccess, bExpectSuccess);
+			if (bExpectSuccess)
+			{
+				TestEqual(FString::Printf(TEXT("Value %d"), FileIndex), Result.Object.ReadInt(TEXT("id")), FileIndex);
+				TestTrue(FString::Printf(TEXT("Size %d"), FileIndex), Result.FileSize > 0);
+				TestTrue(FString::Printf(TEXT("Timings %d"), FileIndex), Result.ReadSeconds >= 0.0 && Result.ParseSeconds >= 0.0);
+			}
+		}
+		TestTrue("Missing file is reported", Results[7].ErrorMessage.Contains(TEXT("File not found")));
+		TestFalse("Invalid file is reported", Results[3].ErrorMessage.IsEmpty());
+	}
+	
+	// Callback mode sees every file once
+	std::atomic<int32> NumLoaded(0);
+	std::atomic<int64> IdSum(0);
+	const bool bAllLoaded = Loader.Load(FilePaths, [&NumLoaded, &IdSum](FEasyJsonBatchFileResultV2&& Result)
+	{
+		++NumLoaded;
+		IdSum += Result.bSuccess ? Result.Object.ReadInt(TEXT("id")) : 0;
+	});
+	TestFalse("A failed file fails the batch", bAllLoaded);
+	TestEqual("Every file is reported", NumLoaded.load(), NumFiles);
+	TestEqual("Every value is read", static_cast<int64>(IdSum.load()), static_cast<int64>(NumFiles) * (NumFiles - 1) / 2 - 3 - 7);
+	
+	FPlatformFileManager::Get().GetPlatformFile().DeleteDirectoryRecursively(*TestDirectory);
+	
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,215 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/Engine.h"
+#include "EasyJsonObjectV2.h"
+#include "EasyJsonPathV2.h"
+#include "EasyJsonParseManagerV2.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2CompiledPathTest, "EasyJsonParser.V2.CompiledPath", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2CompiledPathTest::RunTest(const FString& Parameters)
+{
+	const FString TestJson = TEXT(R"({
+		"name": "TestUser",
+		"settings": { "volume": 0.5, "muted": false },
+		"scores": [100, 85, 92],
+		"friends": [
+			{"name": "Alice", "age": 23},
+			{"name": "Bob", "age": 27}
+		],
+		"matrix": [[1, 2], [3, 4]]
+	})");
+	
+	bool bSuccess = false;
+	FString ErrorMessage;
+	FEasyJsonObjectV2 JsonObject = UEasyJsonParseManagerV2::LoadFromString(TestJson, bSuccess, ErrorMessage);
+	TestTrue("JSON should load successfully", bSuccess);
+	
+	// Compiled paths
+	const FEasyJsonPathV2 NamePath(TEXT("name"));
+	const FEasyJsonPathV2 VolumePath(TEXT("settings.volume"));
+	const FEasyJsonPathV2 FriendAgePath(TEXT("friends[1].age"));
+	const FEasyJsonPathV2 MatrixPath(TEXT("matrix[1][0]"));
+	
+	TestTrue("Path should be valid", NamePath.IsValid());
+	TestEqual("Path step count", FriendAgePath.Num(), 2);
+	TestEqual("Path max array depth", MatrixPath.GetMaxArrayDepth(), 2);
+	TestFalse("Empty path should be invalid", FEasyJsonPathV2(TEXT("")).IsValid());
+	
+	// Same results as the string overloads
+	TestEqual("Read string via path", JsonObject.ReadString(NamePath), JsonObject.ReadString(TEXT("name")));
+	TestEqual("Read float via path", JsonObject.ReadFloat(VolumePath), 0.5f);
+	TestEqual("Read int via path", JsonObject.ReadInt(FriendAgePath), 27);
+	TestEqual("Read matrix via path", JsonObject.ReadInt(MatrixPath), 3);
+	TestEqual("Read bool via path", JsonObject.ReadBool(FEasyJsonPathV2(TEXT("settings.muted")), true), false);
+	TestEqual("Missing path returns default", JsonObject.ReadInt(FEasyJsonPathV2(TEXT("missing.value")), 42), 42);
+	
+	// Repeated reads through the same path
+	for (int32 i = 0; i < 100; ++i)
+	{
+		JsonObject.ReadInt(FriendAgePath);
+	}
+	TestEqual("Repeated read stays stable", JsonObject.ReadInt(FriendAgePath), 27);
+	
+	// Array helpers
+	const FEasyJsonPathV2 ScoresPath(TEXT("scores"));
+	TestEqual("Array size via path", JsonObject.GetArraySize(ScoresPath), 3);
+	TestTrue("IsArray via path", JsonObject.IsArray(ScoresPath));
+	TestEqual("Array values via path", JsonObject.ReadArrayValues(ScoresPath).Num(), 3);
+	TestEqual("2D read via path", JsonObject.Read2DArrayInt(FEasyJsonPathV2(TEXT("matrix")), 0, 1), 2);
+	
+	// Objects
+	bool bFound = false;
+	FEasyJsonObjectV2 Settings = JsonObject.ReadObject(FEasyJsonPathV2(TEXT("settings")), bFound);
+	TestTrue("Object found via path", bFound);
+	TestEqual("Read from object found via path", Settings.ReadFloat(TEXT("volume")), 0.5f);
+	
+	// Writes
+	FEasyJsonObjectV2 Written = FEasyJsonObjectV2::CreateEmpty();
+	const FEasyJsonPathV2 LevelPath(TEXT("player.stats.level"));
+	const FEasyJsonPathV2 ItemsPath(TEXT("player.items"));
+	Written.WriteInt(LevelPath, 10);
+	Written.AddStringToArray(ItemsPath, TEXT("Sword"));
+	Written.AddStringToArray(ItemsPath, TEXT("Shield"));
+	Written.WriteString(FEasyJsonPathV2(TEXT("player.slots[2]")), TEXT("Potion"));
+	
+	TestEqual("Written int via path", Written.ReadInt(LevelPath), 10);
+	TestEqual("Written array via path", Written.GetArraySize(ItemsPath), 2);
+	TestEqual("Written array element via path", Written.ReadString(TEXT("player.items[1]")), FString(TEXT("Shield")));
+	TestEqual("Written indexed element via path", Written.ReadString(TEXT("player.slots[2]")), FString(TEXT("Potion")));
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2StaticPathTest, "EasyJsonParser.V2.StaticPath", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2StaticPathTest::RunTest(const FString& Parameters)
+{
+	static_assert(EasyJsonStaticPath::IsValid("users[0].contacts[1][2].name"), "Valid path");
+	static_assert(!EasyJsonStaticPath::IsValid("users[x]"), "Non-numeric index");
+	static_assert(!EasyJsonStaticPath::IsValid("a..b"), "Empty component");
+	static_assert(!EasyJsonStaticPath::IsValid(""), "Empty path");
+	
+	const FString TestJson = TEXT(R"({
+		"users": [
+			{"name": "Alice", "age": 23},
+			{"name": "Bob", "age": 27}
+		],
+		"matrix": [[1, 2], [3, 4]]
+	})");
+	
+	bool bSuccess = false;
+	FString ErrorMessage;
+	FEasyJsonObjectV2 JsonObject = UEasyJsonParseManagerV2::LoadFromString(TestJson, bSuccess, ErrorMessage);
+	TestTrue("JSON should load successfully", bSuccess);
+	
+	const FEasyJsonPathV2& AgePath = EJ_PATH("users[1].age");
+	TestEqual("Static path step count", AgePath.Num(), 2);
+	TestEqual("Static path keeps access string", AgePath.GetAccessString(), FString(TEXT("users[1].age")));
+	TestEqual("Static path property name", AgePath.GetSteps()[0].PropertyName, FString(TEXT("users")));
+	
+	TestEqual("Read via static path", JsonObject.ReadInt(AgePath), 27);
+	TestEqual("Read string via static path", JsonObject.ReadString(EJ_PATH("users[0].name")), FString(TEXT("Alice")));
+	TestEqual("Read matrix via static path", JsonObject.ReadInt(EJ_PATH("matrix[1][1]")), 4);
+	TestEqual("Static path max array depth", EJ_PATH("matrix[1][1]").GetMaxArrayDepth(), 2);
+	
+	// Same call site returns the same path instance
+	const FEasyJsonPathV2* First = nullptr;
+	for (int32 i = 0; i < 2; ++i)
+	{
+		const FEasyJsonPathV2& Path = EJ_PATH("users[0].age");
+		TestTrue("Static path is built once per call site", First == nullptr || First == &Path);
+		First = &Path;
+	}
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2AccessStringCacheTest, "EasyJsonParser.V2.AccessStringCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2AccessStringCacheTest::RunTest(const FString& Parameters)
+{
+	FAdvancedAccessParser::ResetCache(64);
+	
+	FAccessStepsRef First = FAdvancedAccessParser::ParseAccessStringCached(TEXT("users[0].contacts[1].name"));
+	FAccessStepsRef Second = FAdvancedAccessParser::ParseAccessStringCached(TEXT("users[0].contacts[1].name"));
+	
+	TestEqual("Cached step count", First->Num(), 3);
+	TestTrue("Second lookup should share the cached steps", &First.Get() == &Second.Get());
+	
+	FAccessStringCacheStats Stats = FAdvancedAccessParser::GetCacheStats();
+	TestEqual("One miss recorded", Stats.Misses, (uint64)1);
+	TestEqual("One hit recorded", Stats.Hits, (uint64)1);
+	TestEqual("One entry cached", Stats.NumEntries, 1);
+	
+	// Case matters for cached access strings
+	FAccessStepsRef Upper = FAdvancedAccessParser::ParseAccessStringCached(TEXT("Users[0].contacts[1].name"));
+	TestEqual("Case-sensitive lookup keeps original property name", (*Upper)[0].PropertyName, FString(TEXT("Users")));
+	
+	// Fill beyond capacity to force evictions
+	for (int32 i = 0; i < 200; ++i)
+	{
+		FAdvancedAccessParser::ParseAccessStringCached(FString::Printf(TEXT("items[%d].value"), i));
+	}
+	Stats = FAdvancedAccessParser::GetCacheStats();
+	TestTrue("Cache stays bounded", Stats.NumEntries <= Stats.Capacity);
+	TestTrue("Evictions recorded", Stats.Evictions > 0);
+	
+	// Disabled cache still parses
+	FAdvancedAccessParser::ResetCache(0);
+	TestEqual("Disabled cache still parses", FAdvancedAccessParser::ParseAccessStringCached(TEXT("a.b"))->Num(), 2);
+	TestEqual("Disabled cache stores nothing", FAdvancedAccessParser::GetCacheStats().NumEntries, 0);
+	
+	FAdvancedAccessParser::ResetCache();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2AccessStringTokenizerTest, "EasyJsonParser.V2.AccessStringTokenizer", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2AccessStringTokenizerTest::RunTest(const FString& Parameters)
+{
+	FAccessTokenArray Tokens;
+	FAccessStringTokenizer::Tokenize(TEXT("users[0].contacts[1][2].name"), Tokens);
+	
+	TestEqual("Token count", Tokens.Num(), 3);
+	TestTrue("First token name", Tokens[0].PropertyName == TEXT("users"));
+	TestEqual("First token index", Tokens[0].ArrayIndices[0], 0);
+	TestEqual("Second token indices", Tokens[1].ArrayIndices.Num(), 2);
+	TestEqual("Second token second index", Tokens[1].ArrayIndices[1], 2);
+	TestFalse("Last token is not array access", Tokens[2].IsArrayAccess());
+	TestTrue("Tokens are well formed", Tokens[0].bWellFormed && Tokens[1].bWellFormed && Tokens[2].bWellFormed);
+	
+	// Whitespace and empty components are skipped
+	FAccessTokenArray Spaced;
+	FAccessStringTokenizer::Tokenize(TEXT(" array[ 3 ] .. value "), Spaced);
+	TestEqual("Spaced token count", Spaced.Num(), 2);
+	TestTrue("Spaced name trimmed", Spaced[0].PropertyName == TEXT("array"));
+	TestEqual("Spaced index", Spaced[0].ArrayIndices[0], 3);
+	TestFalse("Spaced component is not well formed", Spaced[0].bWellFormed);
+	
+	// Non-numeric brackets keep the full component as property name
+	FAccessToken Token;
+	FAccessStringTokenizer::TokenizeComponent(TEXT("a[x]"), Token);
+	TestTrue("Non-numeric bracket keeps name", Token.PropertyName == TEXT("a[x]"));
+	TestFalse("Non-numeric bracket is not array access", Token.IsArrayAccess());
+	
+	// Oversized indices are clamped instead of overflowing
+	FAccessStringTokenizer::TokenizeComponent(TEXT("a[99999999999]"), Token);
+	TestEqual("Oversized index clamped", Token.ArrayIndices[0], MAX_int32);
+	
+	// Validation
+	TestTrue("Valid access string", FAdvancedAccessParser::IsValidAccessString(TEXT("a_1.b[0][1].c")));
+	TestFalse("Empty access string", FAdvancedAccessParser::IsValidAccessString(TEXT("")));
+	TestFalse("Trailing dot", FAdvancedAccessParser::IsValidAccessString(TEXT("a.b.")));
+	TestFalse("Leading digit", FAdvancedAccessParser::IsValidAccessString(TEXT("1a")));
+	TestFalse("Empty brackets", FAdvancedAccessParser::IsValidAccessString(TEXT("a[]")));
+	TestFalse("Unclosed bracket", FAdvancedAccessParser::IsValidAccessString(TEXT("a[0")));
+	
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
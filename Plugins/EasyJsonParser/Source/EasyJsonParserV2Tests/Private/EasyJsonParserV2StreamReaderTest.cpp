@@ -0,0 +1,252 @@
+// Copyright 2025 ayumax. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "EasyJsonStreamReaderV2.h"
+#include "EasyJsonPathExtractorV2.h"
+#include "EasyJsonObjectV2.h"
+#include "Serialization/MemoryReader.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace EasyJsonStreamReaderTest
+{
+	// Records every event as text
+	class FRecordingVisitor : public IEasyJsonStreamVisitorV2
+	{
+	public:
+		virtual EEasyJsonStreamActionV2 OnBeginObject() override { return Record(TEXT("{")); }
+		virtual EEasyJsonStreamActionV2 OnEndObject() override { return Record(TEXT("}")); }
+		virtual EEasyJsonStreamActionV2 OnBeginArray() override { return Record(TEXT("[")); }
+		virtual EEasyJsonStreamActionV2 OnEndArray() override { return Record(TEXT("]")); }
+		virtual EEasyJsonStreamActionV2 OnString(FStringView Value) override { return Record(TEXT("s:") + FString(Value) + TEXT(" ")); }
+		virtual EEasyJsonStreamActionV2 OnNumber(double Value) override { return Record(FString::Printf(TEXT("n:%g "), Value)); }
+		virtual EEasyJsonStreamActionV2 OnBool(bool bValue) override { return Record(bValue ? TEXT("true ") : TEXT("false ")); }
+		virtual EEasyJsonStreamActionV2 OnNull() override { return Record(TEXT("null ")); }
+		
+		virtual EEasyJsonStreamActionV2 OnKey(FStringView Key) override
+		{
+			if (Key.Equals(SkipKey))
+			{
+				Events += TEXT("skip ");
+				return EEasyJsonStreamActionV2::Skip;
+			}
+			return Record(TEXT("k:") + FString(Key) + TEXT(" "));
+		}
+		
+		FString Events;
+		FString SkipKey;
+		int32 StopAfter = INDEX_NONE;
+	
+	private:
+		EEasyJsonStreamActionV2 Record(const FString& Event)
+		{
+			Events += Event;
+			return ++NumEvents == StopAfter ? EEasyJsonStreamActionV2::Stop : EEasyJsonStreamActionV2::Continue;
+		}
+		
+		int32 NumEvents = 0;
+	};
+	
+	// Archive that does not know its size and reports the end by falling short
+	class FUnknownSizeReader : public FArchive
+	{
+	public:
+		explicit FUnknownSizeReader(TArrayView<const uint8> InBytes)
+			: Bytes(InBytes)
+		{
+			SetIsLoading(true);
+		}
+		
+		virtual void Serialize(void* Data, int64 Num) override
+		{
+			const int64 Available = FMath::Min<int64>(Num, Bytes.Num() - Offset);
+			FMemory::Memcpy(Data, Bytes.GetData() + Offset, Available);
+			Offset += Available;
+			if (Available < Num)
+			{
+				SetError();
+			}
+		}
+		
+		virtual int64 Tell() override { return Offset; }
+		virtual int64 TotalSize() override { return -1; }
+	
+	private:
+		TArrayView<const uint8> Bytes;
+		int64 Offset = 0;
+	};
+	
+	bool ReadJson(const FString& Json, int32 ChunkSize, FRecordingVisitor& Visitor, FString& OutErrorMessage)
+	{
+		const FTCHARToUTF8 Utf8(*Json);
+		const TArray<uint8> Bytes(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		FMemoryReader Archive(Bytes);
+		FEasyJsonStreamReaderV2 Reader(Archive, ChunkSize);
+		const bool bSuccess = Reader.Read(Visitor);
+		OutErrorMessage = Reader.GetErrorMessage();
+		return bSuccess;
+	}
+	
+	bool Extract(const FEasyJsonPathExtractorV2& Extractor, const FString& Json, TArray<TArray<FEasyJsonValueV2>>& OutValues)
+	{
+		const FTCHARToUTF8 Utf8(*Json);
+		const TArray<uint8> Bytes(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		FMemoryReader Archive(Bytes);
+		FString ErrorMessage;
+		return Extractor.Extract(Archive, OutValues, ErrorMessage);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2StreamReaderTest, "EasyJsonParser.V2.StreamReader", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2StreamReaderTest::RunTest(const FString& Parameters)
+{
+	using namespace EasyJsonStreamReaderTest;
+	
+	const FString TestJson = TEXT(R"( {"name": "a\"b\u00e9", "skip": {"x": [1, {"y": "]}"}]}, "arr": [1, -2.5e3, true, false, null, [], {}], "z": 0} )");
+	const FString Expected = TEXT("{k:name s:a\"b\u00e9 k:skip {k:x [n:1 {k:y s:]} }]}k:arr [n:1 n:-2500 true false null []{}]k:z n:0 }");
+	
+	// Small chunks split tokens across reads; the events must not change
+	for (const int32 ChunkSize : {16, 17, 23, FEasyJsonStreamReaderV2::DefaultChunkSize})
+	{
+		FRecordingVisitor Visitor;
+		FString ErrorMessage;
+		TestTrue(FString::Printf(TEXT("Read with %d-byte chunks"), ChunkSize), ReadJson(TestJson, ChunkSize, Visitor, ErrorMessage));
+		TestEqual(FString::Printf(TEXT("Events with %d-byte chunks"), ChunkSize), Visitor.Events, Expected);
+	}
+	
+	// A skipped value produces no events
+	{
+		FRecordingVisitor Visitor;
+		Visitor.SkipKey = TEXT("skip");
+		FString ErrorMessage;
+		TestTrue("Read with skip", ReadJson(TestJson, 16, Visitor, ErrorMessage));
+		TestEqual("Skipped events", Visitor.Events, FString(TEXT("{k:name s:a\"b\u00e9 skip k:arr [n:1 n:-2500 true false null []{}]k:z n:0 }")));
+	}
+	
+	// Stopping ends the read early without an error
+	{
+		FRecordingVisitor Visitor;
+		Visitor.StopAfter = 3;
+		FString ErrorMessage;
+		TestTrue("Stopped read succeeds", ReadJson(TestJson, 16, Visitor, ErrorMessage));
+		TestEqual("Events up to the stop", Visitor.Events, FString(TEXT("{k:name s:a\"b\u00e9 ")));
+	}
+	
+	// Surrogate pairs are combined
+	{
+		FRecordingVisitor Visitor;
+		FString ErrorMessage;
+		TestTrue("Surrogate pair", ReadJson(TEXT(R"(["\ud83d\ude00"])"), 16, Visitor, ErrorMessage));
+		TestEqual("Surrogate pair length", Visitor.Events.Len(), FString(TEXT("[s:\U0001F600 ]")).Len());
+	}
+	
+	// Archives of unknown size are read until they run out
+	for (const int32 ChunkSize : {16, FEasyJsonStreamReaderV2::DefaultChunkSize})
+	{
+		const FTCHARToUTF8 Utf8(*TestJson);
+		FUnknownSizeReader Archive(TArrayView<const uint8>(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length()));
+		FEasyJsonStreamReaderV2 Reader(Archive, ChunkSize);
+		FRecordingVisitor Visitor;
+		TestTrue(FString::Printf(TEXT("Unknown size with %d-byte chunks"), ChunkSize), Reader.Read(Visitor));
+		TestEqual(FString::Printf(TEXT("Unknown size events with %d-byte chunks"), ChunkSize), Visitor.Events, Expected);
+	}
+	
+	// Characters from escapes count towards the string length limit
+	{
+		const FTCHARToUTF8 Utf8(TEXT(R"(["\u0041\u0041\u0041\u0041\u0041\u0041\u0041\u0041\u0041\u0041", "ok"])"));
+		const TArray<uint8> Bytes(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+		FMemoryReader Archive(Bytes);
+		FEasyJsonStreamReaderV2 Reader(Archive, 16);
+		Reader.SetMaxStringLength(8);
+		FRecordingVisitor Visitor;
+		TestFalse("Escaped string over the limit", Reader.Read(Visitor));
+		TestTrue("Limit error", Reader.GetErrorMessage().Contains(TEXT("String too long")));
+	}
+	
+	// Invalid input fails with a message
+	for (const TCHAR* InvalidJson : {TEXT(R"({"a": 01})"), TEXT(R"({"a": [1,]})"), TEXT(R"({"a": 1} x)"), TEXT(R"({"a": "abc)"), TEXT("[1 2]"), TEXT("tru"), TEXT("")})
+	{
+		FRecordingVisitor Visitor;
+		FString ErrorMessage;
+		TestFalse(FString::Printf(TEXT("Invalid: %s"), InvalidJson), ReadJson(InvalidJson, 16, Visitor, ErrorMessage));
+		TestFalse(FString::Printf(TEXT("Error message: %s"), InvalidJson), ErrorMessage.IsEmpty());
+	}
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2PathExtractorTest, "EasyJsonParser.V2.PathExtractor", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2PathExtractorTest::RunTest(const FString& Parameters)
+{
+	using namespace EasyJsonStreamReaderTest;
+	
+	const FString TestJson = TEXT(R"({
+		"meta": {"version": 3, "name": "export"},
+		"items": [{"id": 1, "blob": [1, 2, 3]}, {"ID": 2}, {"other": 0}],
+		"rows": [[1, 2], [3, 4]],
+		"payload": {"items": [{"id": 99}]}
+	})");
+	
+	const FEasyJsonPathExtractorV2 Extractor({TEXT("meta.version"), TEXT("items[*].id"), TEXT("rows[1][0]"), TEXT("items[0]"), TEXT("missing.value")});
+	TestTrue("Paths compile", Extractor.IsValid());
+	
+	TArray<TArray<FEasyJsonValueV2>> Values;
+	TestTrue("Extract succeeds", Extract(Extractor, TestJson, Values));
+	TestEqual("One result list per path", Values.Num(), 5);
+	if (Values.Num() == 5)
+	{
+		TestEqual("Single match", Values[0].Num(), 1);
+		TestEqual("meta.version", Values[0].Num() == 1 ? Values[0][0].GetIntValue() : -1, 3);
+		
+		// Wildcards match every element that has the key (case-insensitively), and nothing under other keys
+		TestEqual("Wildcard matches", Values[1].Num(), 2);
+		TestEqual("First id", Values[1].Num() == 2 ? Values[1][0].GetIntValue() : -1, 1);
+		TestEqual("Second id", Values[1].Num() == 2 ? Values[1][1].GetIntValue() : -1, 2);
+		
+		TestEqual("Nested index", Values[2].Num() == 1 ? Values[2][0].GetIntValue() : -1, 3);
+		
+		// A matched container is built with everything below it
+		TestTrue("Object match", Values[3].Num() == 1 && Values[3][0].IsObject());
+		if (Values[3].Num() == 1)
+		{
+			const TSharedPtr<FJsonObject> Item = Values[3][0].GetJsonValue()->AsObject();
+			TestEqual("Built object", Item->GetArrayField(TEXT("blob")).Num(), 3);
+		}
+		
+		TestEqual("No match", Values[4].Num(), 0);
+	}
+	
+	// Paths resolve like FEasyJsonObjectV2 reads: a key followed by more steps goes into element 0 of an array,
+	// [0] also matches a single value, and the last step yields arrays whole
+	bool bSuccess = false;
+	const FEasyJsonObjectV2 Object = FEasyJsonObjectV2::CreateFromString(TestJson, bSuccess);
+	const FEasyJsonPathExtractorV2 ReadRuleExtractor({TEXT("items.id"), TEXT("meta[0].version"), TEXT("rows"), TEXT("rows.missing")});
+	TestTrue("Read rule extract succeeds", Extract(ReadRuleExtractor, TestJson, Values));
+	if (Values.Num() == 4)
+	{
+		TestEqual("Implicit first element", Values[0].Num() == 1 ? Values[0][0].GetIntValue() : -1, Object.ReadInt(TEXT("items.id")));
+		TestEqual("Index 0 of an object", Values[1].Num() == 1 ? Values[1][0].GetIntValue() : -1, Object.ReadInt(TEXT("meta[0].version")));
+		TestTrue("Whole array", Values[2].Num() == 1 && Values[2][0].IsArray());
+		TestEqual("No match below a scalar element", Values[3].Num(), 0);
+	}
+	
+	// Root arrays are addressed with a leading index group
+	const FEasyJsonPathExtractorV2 RootExtractor({TEXT("[*].id")});
+	TestTrue("Root array extract succeeds", Extract(RootExtractor, TEXT(R"([{"id": 5}, {"id": 6}, 7])"), Values));
+	TestEqual("Root array matches", Values.Num() == 1 ? Values[0].Num() : 0, 2);
+	
+	// Invalid paths and invalid input fail
+	const FEasyJsonPathExtractorV2 InvalidExtractor({TEXT("items[x].id")});
+	TestFalse("Invalid path", InvalidExtractor.IsValid());
+	TestFalse("Invalid path does not extract", Extract(InvalidExtractor, TestJson, Values));
+	TestFalse("Text between index groups", FEasyJsonPathExtractorV2({TEXT("rows[1]x[0]")}).IsValid());
+	TestFalse("Index group after a dot", FEasyJsonPathExtractorV2({TEXT("items.[0]")}).IsValid());
+	TestFalse("Invalid JSON", Extract(Extractor, TEXT(R"({"meta": {"version": 3})"), Values));
+	
+	return true;
+}
+
+#endif
@@ -4,7 +4,13 @@
 #include "Misc/AutomationTest.h"
 #include "Engine/Engine.h"
 #include "EasyJsonObjectV2.h"
+#include "EasyJsonBuilderV2.h"
 #include "EasyJsonParseManagerV2.h"
+#include "EasyJsonWriterV2.h"
+#include "EasyJsonWriteBatchV2.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryWriter.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -122,6 +128,35 @@ bool FEasyJsonParserV2ArrayManipulationTest::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2RejectedWritePathTest, "EasyJsonParser.V2.RejectedWritePaths", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2RejectedWritePathTest::RunTest(const FString& Parameters)
+{
+	bool bSuccess = false;
+	FEasyJsonObjectV2 JsonObject = FEasyJsonObjectV2::CreateFromString(TEXT(R"({"items": [1], "m": [[0, 0]]})"), bSuccess);
+	TestTrue("Parse", bSuccess);
+	const FString Original = JsonObject.ToString();
+	
+	// Appends address the array by name; an indexed path is rejected instead of creating a literal "items[0]" key
+	JsonObject.AddIntToArray(TEXT("items[0]"), 5);
+	JsonObject.AddStringToArray(TEXT("list[2]"), TEXT("x"));
+	JsonObject.AddIntToArray(TEXT("m[0][1]"), 5);
+	TestEqual("Indexed appends write nothing", JsonObject.ToString(), Original);
+	
+	// Multi-dimensional writes are rejected instead of writing into a field named "m[0]"
+	JsonObject.WriteInt(TEXT("m[0][1]"), 7);
+	JsonObject.WriteInt(TEXT("grid[1][2]"), 7);
+	JsonObject.WriteInt(TEXT("m[0][1].x"), 7);
+	TestEqual("Multi-dimensional writes write nothing", JsonObject.ToString(), Original);
+	TestEqual("Element untouched", JsonObject.ReadInt(TEXT("m[0][1]"), -1), 0);
+	
+	// One index per step is still written
+	JsonObject.WriteInt(TEXT("items[1]"), 2);
+	TestEqual("Single index written", JsonObject.ReadInt(TEXT("items[1]")), 2);
+	
+	return true;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2ComplexWriteTest, "EasyJsonParser.V2.ComplexWrite", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
 
 bool FEasyJsonParserV2ComplexWriteTest::RunTest(const FString& Parameters)
@@ -375,4 +410,348 @@ bool FEasyJsonParserV2PathAutoCreationTest::RunTest(const FString& Parameters)
 	return true;
 }
 
-#endif // WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2StreamingWriterTest, "EasyJsonParser.V2.StreamingWriter", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2StreamingWriterTest::RunTest(const FString& Parameters)
+{
+	const FString TestJson = TEXT(R"({"name": "Escaped \"quote\" caf\u00e9 \ud83d\ude00\n", "count": 42, "ratio": 0.1, "big": 1e300, "flags": [true, false, null], "rows": [[1, 2], [], {"id": -3}], "empty": {}})");
+	
+	auto WriteToUtf8 = [](const FEasyJsonObjectV2& Object, bool bPrettyPrint, int32 BufferSize)
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Archive(Bytes);
+		{
+			FEasyJsonWriterV2 Writer(Archive, bPrettyPrint, BufferSize);
+			Writer.WriteObject(Object);
+		}
+		return FString(FUTF8ToTCHAR(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num()));
+	};
+	
+	bool bSuccess = false;
+	const FEasyJsonObjectV2 DomObject = FEasyJsonObjectV2::CreateFromString(TestJson, bSuccess);
+	TestTrue("DOM parse", bSuccess);
+	const FEasyJsonObjectV2 DocumentObject = FEasyJsonObjectV2::CreateDocumentFromString(TestJson, bSuccess);
+	TestTrue("Document parse", bSuccess);
+	
+	// Engine trees and document views, condensed and pretty, through buffers that flush many times
+	for (const FEasyJsonObjectV2* Object : {&DomObject, &DocumentObject})
+	{
+		for (const bool bPrettyPrint : {false, true})
+		{
+			const FString Written = WriteToUtf8(*Object, bPrettyPrint, 64);
+			const FEasyJsonObjectV2 Reloaded = FEasyJsonObjectV2::CreateFromString(Written, bSuccess);
+			TestTrue(FString::Printf(TEXT("Output parses (document: %d, pretty: %d)"), Object->IsDocumentView(), bPrettyPrint), bSuccess);
+			TestTrue(FString::Printf(TEXT("Output round-trips (document: %d, pretty: %d)"), Object->IsDocumentView(), bPrettyPrint), Reloaded == DomObject);
+		}
+	}
+	
+	TestEqual("Condensed layout", WriteToUtf8(FEasyJsonObjectV2::CreateFromString(TEXT(R"({"a": [1, "x"], "b": {}})"), bSuccess), false, 64), FString(TEXT(R"({"a":[1,"x"],"b":{}})")));
+	TestEqual("Non-ASCII survives", DomObject.ReadString(TEXT("name")), FEasyJsonObjectV2::CreateFromString(WriteToUtf8(DocumentObject, false, 64), bSuccess).ReadString(TEXT("name")));
+	TestEqual("Doubles keep their value", FEasyJsonObjectV2::CreateFromString(WriteToUtf8(DocumentObject, false, 64), bSuccess).ReadFloat(TEXT("ratio")), 0.1f);
+	
+	// Duplicate keys in a document view are written once, with the last value
+	const FEasyJsonObjectV2 Duplicates = FEasyJsonObjectV2::CreateDocumentFromString(TEXT(R"({"a": 1, "b": {"x": 1, "X": 2}, "A": 3})"), bSuccess);
+	TestEqual("Duplicate keys", WriteToUtf8(Duplicates, false, 64), FString(TEXT(R"({"b":{"X":2},"A":3})")));
+	
+	// Wide objects are written in one pass over their fields
+	FString WideJson = TEXT("{");
+	for (int32 FieldIndex = 0; FieldIndex < 50000; ++FieldIndex)
+	{
+		WideJson += FString::Printf(TEXT("%s\"field%d\": %d"), FieldIndex > 0 ? TEXT(", ") : TEXT(""), FieldIndex, FieldIndex);
+	}
+	WideJson += TEXT(", \"field7\": -7}");
+	const FEasyJsonObjectV2 WideDocument = FEasyJsonObjectV2::CreateDocumentFromString(WideJson, bSuccess);
+	const FEasyJsonObjectV2 WideReloaded = FEasyJsonObjectV2::CreateFromString(WriteToUtf8(WideDocument, false, FEasyJsonWriterV2::DefaultBufferSize), bSuccess);
+	TestTrue("Wide object round-trips", bSuccess && WideReloaded == FEasyJsonObjectV2::CreateFromString(WideJson, bSuccess));
+	TestEqual("Wide object field", WideReloaded.ReadInt(TEXT("field49999")), 49999);
+	TestEqual("Wide object duplicate", WideReloaded.ReadInt(TEXT("field7")), -7);
+	
+	// Files are written as UTF-8 and load back
+	const FString TestFile = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyJsonParserTests"), TEXT("StreamingWriter.json"));
+	FString ErrorMessage;
+	TestTrue("Save document view", UEasyJsonParseManagerV2::SaveToFile(DocumentObject, TestFile, true, ErrorMessage));
+	const FEasyJsonObjectV2 Loaded = UEasyJsonParseManagerV2::LoadFromFile(TestFile, true, bSuccess, ErrorMessage);
+	TestTrue("Saved file loads", bSuccess && Loaded == DomObject);
+	IFileManager::Get().Delete(*TestFile);
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2ArrayAppendTest, "EasyJsonParser.V2.ArrayAppend", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2ArrayAppendTest::RunTest(const FString& Parameters)
+{
+	FEasyJsonObjectV2 JsonObject = FEasyJsonObjectV2::CreateEmpty();
+	
+	// Single appends grow the stored array in place
+	const FEasyJsonPathV2 SamplesPath(TEXT("telemetry.samples"));
+	for (int32 Index = 0; Index < 10000; ++Index)
+	{
+		JsonObject.AddIntToArray(SamplesPath, Index);
+	}
+	TestEqual("Appended count", JsonObject.GetArraySize(TEXT("telemetry.samples")), 10000);
+	TestEqual("First sample", JsonObject.ReadInt(TEXT("telemetry.samples[0]")), 0);
+	TestEqual("Last sample", JsonObject.ReadInt(TEXT("telemetry.samples[9999]")), 9999);
+	
+	// Bulk appends add after the existing elements
+	const TArray<int32> Ints = {1, 2, 3};
+	const TArray<float> Floats = {0.5f, 1.5f};
+	const TArray<FString> Strings = {TEXT("a"), TEXT("b")};
+	JsonObject.AddIntsToArray(TEXT("telemetry.samples"), Ints);
+	TestEqual("Bulk ints count", JsonObject.GetArraySize(TEXT("telemetry.samples")), 10003);
+	TestEqual("Bulk ints last", JsonObject.ReadInt(TEXT("telemetry.samples[10002]")), 3);
+	JsonObject.AddFloatsToArray(TEXT("floats"), Floats);
+	TestEqual("Bulk floats", JsonObject.ReadFloat(TEXT("floats[1]")), 1.5f);
+	JsonObject.AddStringsToArray(TEXT("strings"), Strings);
+	JsonObject.AddStringToArray(TEXT("strings"), TEXT("c"));
+	TestEqual("Bulk strings then single", JsonObject.ReadString(TEXT("strings[2]")), FString(TEXT("c")));
+	JsonObject.AddIntsToArray(TEXT("empty"), TArrayView<const int32>());
+	TestTrue("Empty bulk append creates the array", JsonObject.IsArray(TEXT("empty")));
+	
+	// A field of another type is replaced by a new array
+	JsonObject.WriteInt(TEXT("scalar"), 5);
+	JsonObject.AddIntToArray(TEXT("scalar"), 7);
+	TestEqual("Replaced scalar", JsonObject.GetArraySize(TEXT("scalar")), 1);
+	
+	// Appending to a document view writes to a copy
+	bool bSuccess = false;
+	const FEasyJsonObjectV2 Document = FEasyJsonObjectV2::CreateDocumentFromString(TEXT(R"({"list": [1, 2]})"), bSuccess);
+	FEasyJsonObjectV2 Copy = Document;
+	Copy.AddIntsToArray(TEXT("list"), Ints);
+	TestEqual("Copy appended", Copy.GetArraySize(TEXT("list")), 5);
+	TestEqual("Document unchanged", Document.GetArraySize(TEXT("list")), 2);
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2IndexedWriteTest, "EasyJsonParser.V2.IndexedWrite", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2IndexedWriteTest::RunTest(const FString& Parameters)
+{
+	FEasyJsonObjectV2 JsonObject = FEasyJsonObjectV2::CreateEmpty();
+	
+	// Filling arrays by index writes into the stored arrays
+	const int32 NumElements = 10000;
+	for (int32 Index = 0; Index < NumElements; ++Index)
+	{
+		JsonObject.WriteInt(FString::Printf(TEXT("values[%d]"), Index), Index * 2);
+		JsonObject.WriteInt(FString::Printf(TEXT("rows[%d].id"), Index), Index);
+	}
+	TestEqual("Values count", JsonObject.GetArraySize(TEXT("values")), NumElements);
+	TestEqual("Last value", JsonObject.ReadInt(TEXT("values[9999]")), 19998);
+	TestEqual("Rows count", JsonObject.GetArraySize(TEXT("rows")), NumElements);
+	TestEqual("Row field", JsonObject.ReadInt(TEXT("rows[1234].id")), 1234);
+	
+	// Writing another field of an element keeps the element
+	JsonObject.WriteString(TEXT("rows[1234].name"), TEXT("row"));
+	TestEqual("Element keeps its fields", JsonObject.ReadInt(TEXT("rows[1234].id")), 1234);
+	TestEqual("Element gets the new field", JsonObject.ReadString(TEXT("rows[1234].name")), FString(TEXT("row")));
+	
+	// Overwriting and sparse writes
+	JsonObject.WriteInt(TEXT("values[5]"), -1);
+	TestEqual("Overwritten element", JsonObject.ReadInt(TEXT("values[5]")), -1);
+	JsonObject.WriteInt(TEXT("sparse[3]"), 3);
+	TestEqual("Sparse array is padded", JsonObject.GetArraySize(TEXT("sparse")), 4);
+	TestTrue("Padding is null", JsonObject.SafeReadArrayElement(TEXT("sparse"), 1).IsNull());
+	
+	// A scalar element is replaced by an object when a field is written below it
+	JsonObject.WriteInt(TEXT("values[6].nested"), 6);
+	TestEqual("Replaced element", JsonObject.ReadInt(TEXT("values[6].nested")), 6);
+	TestEqual("Neighbour untouched", JsonObject.ReadInt(TEXT("values[7]")), 14);
+	
+	// A field of another type is replaced by an array
+	JsonObject.WriteInt(TEXT("scalar"), 1);
+	JsonObject.WriteInt(TEXT("scalar[1]"), 2);
+	TestEqual("Scalar became an array", JsonObject.GetArraySize(TEXT("scalar")), 2);
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2WriteBatchTest, "EasyJsonParser.V2.WriteBatch", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2WriteBatchTest::RunTest(const FString& Parameters)
+{
+	// Every write goes both into the batch and straight into a reference object
+	FEasyJsonWriteBatchV2 Batch;
+	bool bSuccess = false;
+	FEasyJsonObjectV2 Expected = FEasyJsonObjectV2::CreateFromString(TEXT(R"({"existing": {"keep": 1}, "list": [0, {"a": 1}], "scalar": 5})"), bSuccess);
+	FEasyJsonObjectV2 Target = FEasyJsonObjectV2::CreateFromString(Expected.ToString(), bSuccess);
+	
+	auto WriteInt = [&](const FString& Path, int32 Value)
+	{
+		Batch.WriteInt(Path, Value);
+		Expected.WriteInt(Path, Value);
+	};
+	auto WriteString = [&](const FString& Path, const FString& Value)
+	{
+		Batch.WriteString(Path, Value);
+		Expected.WriteString(Path, Value);
+	};
+	
+	// A profile with many fields under shared parents
+	for (int32 Index = 0; Index < 100; ++Index)
+	{
+		WriteInt(FString::Printf(TEXT("profile.stats.stat%d"), Index), Index);
+		WriteString(FString::Printf(TEXT("profile.info.field%d"), Index), FString::FromInt(Index));
+		WriteInt(FString::Printf(TEXT("profile.inventory[%d].id"), Index % 10), Index);
+	}
+	
+	// Overwrites, existing content, arrays and sparse elements
+	WriteInt(TEXT("profile.stats.stat3"), -3);
+	WriteInt(TEXT("existing.added"), 2);
+	WriteInt(TEXT("list[1].b"), 2);
+	WriteInt(TEXT("list[0].c"), 3);
+	WriteInt(TEXT("list[4]"), 4);
+	WriteInt(TEXT("sparse[2]"), 2);
+	WriteInt(TEXT("deep[2].a.b"), 1);
+	Batch.WriteBool(TEXT("flag"), true);
+	Expected.WriteBool(TEXT("flag"), true);
+	Batch.WriteFloat(TEXT("ratio"), 0.5f);
+	Expected.WriteFloat(TEXT("ratio"), 0.5f);
+	
+	// Writes that depend on their order
+	WriteInt(TEXT("mixed"), 1);
+	WriteInt(TEXT("mixed.child"), 2);
+	WriteInt(TEXT("scalar.child"), 3);
+	
+	TestEqual("Queued writes", Batch.Num(), 312);
+	Batch.Apply(Target);
+	TestEqual("Batch matches one-by-one writes", Target.ToString(), Expected.ToString());
+	TestEqual("Shared parent", Target.ReadInt(TEXT("profile.stats.stat99")), 99);
+	TestEqual("Last write wins", Target.ReadInt(TEXT("profile.stats.stat3")), -3);
+	TestEqual("Existing field kept", Target.ReadInt(TEXT("existing.keep")), 1);
+	
+	// A batch can be applied again, to a document view or an empty object
+	const FEasyJsonObjectV2 Document = FEasyJsonObjectV2::CreateDocumentFromString(TEXT(R"({"existing": {"keep": 7}})"), bSuccess);
+	FEasyJsonObjectV2 Copy = Document;
+	Batch.Apply(Copy);
+	TestEqual("Applied to a copy of the document", Copy.ReadInt(TEXT("existing.keep")), 7);
+	TestEqual("Applied values", Copy.ReadInt(TEXT("profile.inventory[9].id")), 99);
+	TestFalse("Document unchanged", Document.ReadInt(TEXT("existing.added")) == 2);
+	
+	FEasyJsonObjectV2 Empty;
+	Batch.Apply(Empty);
+	TestTrue("Invalid object becomes valid", Empty.IsValid());
+	
+	Batch.Reset();
+	TestEqual("Reset", Batch.Num(), 0);
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2CursorTest, "EasyJsonParser.V2.Cursor", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2CursorTest::RunTest(const FString& Parameters)
+{
+	bool bSuccess = false;
+	FEasyJsonObjectV2 Profile = FEasyJsonObjectV2::CreateFromString(TEXT(R"({"name": "hero", "stats": {"combat": {"attack": 5}}, "level": 3})"), bSuccess);
+	
+	// Relative reads and writes go to the nested object
+	FEasyJsonObjectV2 Combat = Profile.Cursor(TEXT("stats.combat"));
+	TestTrue("Cursor is valid", Combat.IsValid());
+	TestEqual("Relative read", Combat.ReadInt(TEXT("attack")), 5);
+	Combat.WriteInt(TEXT("defense"), 7);
+	Combat.WriteInt(TEXT("skills.slash"), 2);
+	TestEqual("Relative write seen from the root", Profile.ReadInt(TEXT("stats.combat.defense")), 7);
+	TestEqual("Nested relative write", Profile.ReadInt(TEXT("stats.combat.skills.slash")), 2);
+	
+	// Writes to siblings and through the root keep the cursor attached
+	Profile.WriteInt(TEXT("level"), 4);
+	Profile.WriteInt(TEXT("stats.magic"), 9);
+	Profile.WriteInt(TEXT("stats.combat.speed"), 1);
+	TestEqual("Root write seen by the cursor", Combat.ReadInt(TEXT("speed")), 1);
+	Combat.WriteInt(TEXT("attack"), 6);
+	TestEqual("Cursor still attached", Profile.ReadInt(TEXT("stats.combat.attack")), 6);
+	
+	// Missing paths are created, array elements included
+	FEasyJsonObjectV2 Slot = Profile.Cursor(TEXT("inventory[2]"));
+	Slot.WriteString(TEXT("item"), TEXT("sword"));
+	TestEqual("Created element", Profile.ReadString(TEXT("inventory[2].item")), FString(TEXT("sword")));
+	TestEqual("Created array", Profile.GetArraySize(TEXT("inventory")), 3);
+	
+	// A value of another type on the path fails without changing anything
+	Profile.WriteInt(TEXT("scores[0]"), 1);
+	const FString Before = Profile.ToString();
+	TestFalse("Scalar on the path", Profile.Cursor(TEXT("level.sub")).IsValid());
+	TestFalse("Scalar at the path", Profile.Cursor(TEXT("name")).IsValid());
+	TestFalse("Object indexed as an array", Profile.Cursor(TEXT("stats[0]")).IsValid());
+	TestFalse("Scalar element", Profile.Cursor(TEXT("scores[0]")).IsValid());
+	TestEqual("Failed cursors leave the object alone", Profile.ToString(), Before);
+	
+	// A cursor into a document view works on a copy
+	const FEasyJsonObjectV2 Document = FEasyJsonObjectV2::CreateDocumentFromString(TEXT(R"({"stats": {"combat": {"attack": 5}}})"), bSuccess);
+	FEasyJsonObjectV2 Copy = Document;
+	Copy.Cursor(TEXT("stats.combat")).WriteInt(TEXT("attack"), 8);
+	TestEqual("Copy written", Copy.ReadInt(TEXT("stats.combat.attack")), 8);
+	TestEqual("Document unchanged", Document.ReadInt(TEXT("stats.combat.attack")), 5);
+	
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyJsonParserV2BuilderTest, "EasyJsonParser.V2.Builder", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FEasyJsonParserV2BuilderTest::RunTest(const FString& Parameters)
+{
+	FEasyJsonBuilderV2 Builder(64);
+	Builder.BeginObject()
+		.Key(TEXT("event")).Value(TEXT("match_end"))
+		.Key(TEXT("player")).Value(FString(TEXT("caf\u00e9 \"q\"\n")))
+		.Key(TEXT("score")).Value(1200)
+		.Key(TEXT("big")).Value(int64(1) << 40)
+		.Key(TEXT("ratio")).Value(0.1)
+		.Key(TEXT("bad")).Value(TNumericLimits<double>::Quiet_NaN())
+		.Key(TEXT("won")).Value(true)
+		.Key(TEXT("none")).Null()
+		.Key(TEXT("rounds")).BeginArray().Value(3).BeginObject().Key(TEXT("id")).Value(1).EndObject().BeginArray().EndArray().EndArray()
+		.Key(TEXT("empty")).BeginObject().EndObject()
+		.EndObject();
+	TestTrue("Complete", Builder.IsComplete());
+	TestEqual("Condensed text", Builder.ToString(), FString(TEXT(R"({"event":"match_end","player":")") TEXT("caf\u00e9") TEXT(R"( \"q\"\n","score":1200,"big":1099511627776,"ratio":0.1,"bad":null,"won":true,"none":null,"rounds":[3,{"id":1},[]],"empty":{}})")));
+	
+	// The text matches what the DOM path produces
+	bool bSuccess = false;
+	const FEasyJsonObjectV2 Parsed = FEasyJsonObjectV2::CreateFromString(Builder.ToString(), bSuccess);
+	TestTrue("Output parses", bSuccess);
+	TestEqual("Non-ASCII string", Parsed.ReadString(TEXT("player")), FString(TEXT("caf\u00e9 \"q\"\n")));
+	TestEqual("UTF-8 size", Builder.GetUtf8().Num(), Builder.Num());
+	
+	// Reset keeps the capacity, so a reused builder does not allocate again
+	Builder.Reset();
+	Builder.Reserve(4096);
+	const uint8* const Data = Builder.GetUtf8().GetData();
+	for (int32 Payload = 0; Payload < 10; ++Payload)
+	{
+		Builder.Reset();
+		Builder.BeginArray();
+		for (int32 Index = 0; Index < 100; ++Index)
+		{
+			Builder.Value(Index);
+		}
+		Builder.EndArray();
+	}
+	TestTrue("Reused builder complete", Builder.IsComplete());
+	TestTrue("Buffer reused", Builder.GetUtf8().GetData() == Data);
+	TestEqual("Reused builder text", FEasyJsonObjectV2::CreateFromString(TEXT("{\"a\":") + Builder.ToString() + TEXT("}"), bSuccess).GetArraySize(TEXT("a")), 100);
+	
+	// Unsigned counters keep their full range
+	Builder.Reset();
+	Builder.BeginArray().Value(uint32(4000000000u)).Value(TNumericLimits<uint64>::Max()).Value(int64(-5)).EndArray();
+	TestEqual("Unsigned values", Builder.ToString(), FString(TEXT("[4000000000,18446744073709551615,-5]")));
+	
+	// Calls out of place fail without writing
+	Builder.Reset();
+	TestTrue("Value without a key", Builder.BeginObject().Value(1).IsError());
+	Builder.Reset();
+	TestTrue("Key in an array", Builder.BeginArray().Key(TEXT("a")).IsError());
+	Builder.Reset();
+	TestTrue("Unbalanced end", Builder.BeginArray().EndObject().IsError());
+	Builder.Reset();
+	TestTrue("Second root", Builder.Value(1).Value(2).IsError());
+	TestEqual("Nothing written after the error", Builder.ToString(), FString(TEXT("1")));
+	Builder.Reset();
+	TestFalse("Open container is incomplete", Builder.BeginObject().Key(TEXT("a")).IsComplete());
+	
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS